@@ -0,0 +1,415 @@
+/*  ==================================================================
+ *  IMPRESSÃO DIGITAL DO AMBIENTE E FONTES DE RUÍDO
+ *  Etapa de pré-voo executada antes de cada bateria de medições:
+ *    - identifica a máquina e o build: modelo da CPU, governador de
+ *      frequência, turbo, SMT, compilador, flags e commit do git;
+ *    - fixa a thread do benchmark no núcleo em que ela está
+ *      (sched_setaffinity), para que a verificação abaixo valha para toda
+ *      a execução; as threads do pool voltam à máscara original;
+ *    - mede o ruído: carga do sistema, ocupação do núcleo do benchmark
+ *      (e dos irmãos SMT) por outros processos e resolução do relógio;
+ *    - avisa quando o governador não é "performance" ou quando o núcleo
+ *      está ocupado; com ORDENACAO_ESTRITO=1, recusa a execução.
+ *  ambienteCabecalho() grava tudo como linhas "# chave: valor" no início
+ *  dos arquivos de resultados, que os leitores (pandas com comment='#',
+ *  compararResultados, varrer_variantes.py) ignoram ou comparam.
+ *  ==================================================================*/
+#ifndef AMBIENTE_H
+#define AMBIENTE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#ifndef ORDENACAO_FLAGS
+#define ORDENACAO_FLAGS "desconhecidas" /* Definido pelo Makefile com o CFLAGS da compilação */
+#endif
+
+#if defined(__clang__)
+#define AMBIENTE_COMPILADOR "clang " __VERSION__
+#elif defined(__GNUC__)
+#define AMBIENTE_COMPILADOR "gcc " __VERSION__
+#else
+#define AMBIENTE_COMPILADOR "desconhecido"
+#endif
+
+#define AMBIENTE_MAX_CPUS 256
+#define AMBIENTE_AMOSTRA_MS 200         /* Janela em que a ocupação do núcleo é medida */
+#define AMBIENTE_LIMIAR_OCUPACAO 0.10   /* Ocupação por outros processos acima disto gera aviso */
+#define AMBIENTE_AMOSTRAS_RELOGIO 1000  /* Leituras seguidas usadas na resolução efetiva do relógio */
+#define AMBIENTE_MAX_AVISOS 8
+#define AMBIENTE_BITS_PALAVRA (8 * (int)sizeof(unsigned long))
+
+typedef struct
+{
+    int coletado;
+    char programa[32];
+    char data[32];
+    char host[64];
+    char cpu[128];
+    int nucleo;            /* Núcleo do benchmark (o da coleta, em que a thread é fixada) */
+    int fixado;            /* A thread do benchmark foi fixada no núcleo (sched_setaffinity) */
+    char irmaos[64];       /* Irmãos SMT do núcleo (thread_siblings_list) */
+    char governador[32];
+    long frequencia_mhz;   /* -1 se indisponível */
+    char turbo[16];
+    char smt[16];
+    char commit[64];
+    double carga_1min;
+    int outros_executando; /* procs_running menos este processo */
+    double ocupacao;       /* Fração do núcleo e irmãos ocupada por outros na janela (-1 se indisponível) */
+    long resolucao_ns;     /* clock_getres(CLOCK_MONOTONIC) */
+    long resolucao_efetiva_ns; /* Menor diferença positiva entre leituras seguidas */
+    int num_avisos;
+    int recusar;           /* Algum aviso impede a execução no modo estrito */
+    char avisos[AMBIENTE_MAX_AVISOS][128];
+} AmbienteExecucao;
+
+static AmbienteExecucao ambienteAtual;
+
+/* Máscara de afinidade do processo antes da fixação (sched_getaffinity, no formato do kernel) */
+static unsigned long ambienteMascaraOriginal[AMBIENTE_MAX_CPUS / AMBIENTE_BITS_PALAVRA];
+static int ambienteMascaraSalva;
+
+/**
+ * @brief Lê a primeira linha de um arquivo (sem o '\n').
+ * @return 1 se a linha foi lida.
+ */
+static inline int ambienteLerLinha(const char *caminho, char *valor, size_t tamanho)
+{
+    FILE *f = fopen(caminho, "r");
+    if (!f)
+        return 0;
+    int lido = fgets(valor, (int)tamanho, f) != NULL;
+    fclose(f);
+    if (lido)
+        valor[strcspn(valor, "\n")] = '\0';
+    return lido;
+}
+
+/**
+ * @brief Núcleo em que o processo está executando (campo 39 de /proc/self/stat), ou 0.
+ */
+static inline int ambienteNucleoAtual()
+{
+    char linha[1024];
+    if (!ambienteLerLinha("/proc/self/stat", linha, sizeof(linha)))
+        return 0;
+
+    /* Os campos contam a partir do fim do nome do comando, que pode conter espaços */
+    char *p = strrchr(linha, ')');
+    int campo = 2;
+    while (p && *p)
+    {
+        if (*p == ' ' && ++campo == 39)
+            return atoi(p + 1);
+        p++;
+    }
+    return 0;
+}
+
+/**
+ * @brief Fixa a thread chamadora (a do benchmark) em um núcleo. Na primeira chamada, guarda a
+ *        máscara de afinidade original para ambienteLiberarNucleo(). Usa as chamadas de sistema
+ *        diretamente, sem depender de _GNU_SOURCE.
+ * @return 1 se a thread foi fixada, 0 se a afinidade não pôde ser alterada.
+ */
+static inline int ambienteFixarNucleo(int nucleo)
+{
+    if (nucleo < 0 || nucleo >= AMBIENTE_MAX_CPUS)
+        return 0;
+    if (!ambienteMascaraSalva)
+    {
+        if (syscall(SYS_sched_getaffinity, 0, sizeof(ambienteMascaraOriginal), ambienteMascaraOriginal) < 0)
+            return 0;
+        ambienteMascaraSalva = 1;
+    }
+
+    unsigned long mascara[AMBIENTE_MAX_CPUS / AMBIENTE_BITS_PALAVRA] = {0};
+    mascara[nucleo / AMBIENTE_BITS_PALAVRA] = 1UL << (nucleo % AMBIENTE_BITS_PALAVRA);
+    return syscall(SYS_sched_setaffinity, 0, sizeof(mascara), mascara) == 0;
+}
+
+/**
+ * @brief Devolve a thread chamadora à máscara de afinidade original (threads de trabalho criadas
+ *        depois da fixação herdam o núcleo único). Sem fixação anterior, não faz nada.
+ */
+static inline void ambienteLiberarNucleo()
+{
+    if (ambienteMascaraSalva)
+        syscall(SYS_sched_setaffinity, 0, sizeof(ambienteMascaraOriginal), ambienteMascaraOriginal);
+}
+
+/**
+ * @brief Marca em nucleos[] os núcleos de uma lista do sysfs ("0", "0,4", "0-1,8-9").
+ */
+static inline void ambienteMarcarLista(const char *lista, int nucleos[])
+{
+    const char *p = lista;
+    while (*p)
+    {
+        char *fim;
+        long a = strtol(p, &fim, 10), b = a;
+        if (fim == p)
+            break;
+        if (*fim == '-')
+            b = strtol(fim + 1, &fim, 10);
+        for (long c = a; c <= b && c < AMBIENTE_MAX_CPUS; c++)
+            if (c >= 0)
+                nucleos[c] = 1;
+        p = *fim == ',' ? fim + 1 : fim;
+        if (*fim != ',')
+            break;
+    }
+}
+
+/**
+ * @brief Soma, para os núcleos marcados, o tempo total e o ocioso (idle + iowait) de /proc/stat.
+ */
+static inline void ambienteTemposCPU(const int nucleos[], unsigned long long *total, unsigned long long *ocioso)
+{
+    FILE *f = fopen("/proc/stat", "r");
+    char linha[512];
+
+    *total = *ocioso = 0;
+    while (f && fgets(linha, sizeof(linha), f))
+    {
+        int cpu;
+        unsigned long long t[8] = {0};
+        if (strncmp(linha, "cpu", 3) != 0 || sscanf(linha + 3, "%d %llu %llu %llu %llu %llu %llu %llu %llu", &cpu,
+                                                   &t[0], &t[1], &t[2], &t[3], &t[4], &t[5], &t[6], &t[7]) < 5)
+            continue;
+        if (cpu < 0 || cpu >= AMBIENTE_MAX_CPUS || !nucleos[cpu])
+            continue;
+        for (int i = 0; i < 8; i++)
+            *total += t[i];
+        *ocioso += t[3] + t[4];
+    }
+    if (f)
+        fclose(f);
+}
+
+/**
+ * @brief Processos em execução no sistema (procs_running de /proc/stat), ou -1.
+ */
+static inline int ambienteProcessosExecutando()
+{
+    FILE *f = fopen("/proc/stat", "r");
+    char linha[512];
+    int executando = -1;
+
+    while (f && fgets(linha, sizeof(linha), f))
+        if (sscanf(linha, "procs_running %d", &executando) == 1)
+            break;
+    if (f)
+        fclose(f);
+    return executando;
+}
+
+/**
+ * @brief Commit do código-fonte (git describe --always --dirty na pasta atual), ou "desconhecido".
+ *        Lido na execução, e não gravado no binário, para não invalidar o cache de resultados a cada commit.
+ */
+static inline void ambienteCommit(char *commit, size_t tamanho)
+{
+    FILE *git = popen("git describe --always --dirty 2>/dev/null", "r");
+    snprintf(commit, tamanho, "desconhecido");
+    if (!git)
+        return;
+    char linha[64];
+    if (fgets(linha, sizeof(linha), git) && linha[0] != '\n')
+    {
+        linha[strcspn(linha, "\n")] = '\0';
+        snprintf(commit, tamanho, "%s", linha);
+    }
+    pclose(git);
+}
+
+static inline void ambienteAvisar(AmbienteExecucao *a, int impede, const char *mensagem)
+{
+    if (a->num_avisos < AMBIENTE_MAX_AVISOS)
+        snprintf(a->avisos[a->num_avisos++], sizeof(a->avisos[0]), "%s", mensagem);
+    a->recusar = a->recusar || impede;
+}
+
+/**
+ * @brief Coleta a impressão digital do ambiente e mede as fontes de ruído (leva AMBIENTE_AMOSTRA_MS).
+ * @param programa Nome do programa que grava os resultados.
+ */
+static inline void ambienteColetar(const char *programa)
+{
+    AmbienteExecucao *a = &ambienteAtual;
+    char caminho[128], valor[128];
+
+    memset(a, 0, sizeof(*a));
+    snprintf(a->programa, sizeof(a->programa), "%s", programa);
+
+    time_t agora = time(NULL);
+    strftime(a->data, sizeof(a->data), "%Y-%m-%d %H:%M:%S", localtime(&agora));
+    if (gethostname(a->host, sizeof(a->host)) != 0)
+        snprintf(a->host, sizeof(a->host), "desconhecido");
+    a->host[sizeof(a->host) - 1] = '\0';
+
+    /* Modelo da CPU */
+    FILE *f = fopen("/proc/cpuinfo", "r");
+    char linha[256];
+    snprintf(a->cpu, sizeof(a->cpu), "desconhecida");
+    while (f && fgets(linha, sizeof(linha), f))
+        if (strncmp(linha, "model name", 10) == 0 && strchr(linha, ':'))
+        {
+            char *inicio = strchr(linha, ':') + 1;
+            while (*inicio == ' ')
+                inicio++;
+            inicio[strcspn(inicio, "\n")] = '\0';
+            snprintf(a->cpu, sizeof(a->cpu), "%s", inicio);
+            break;
+        }
+    if (f)
+        fclose(f);
+
+    /* Núcleo (a thread fica nele até o fim da execução), governador, frequência, turbo e SMT */
+    a->nucleo = ambienteNucleoAtual();
+    a->fixado = ambienteFixarNucleo(a->nucleo);
+    snprintf(caminho, sizeof(caminho), "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", a->nucleo);
+    if (!ambienteLerLinha(caminho, a->irmaos, sizeof(a->irmaos)))
+        snprintf(a->irmaos, sizeof(a->irmaos), "%d", a->nucleo);
+
+    snprintf(caminho, sizeof(caminho), "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_governor", a->nucleo);
+    if (!ambienteLerLinha(caminho, a->governador, sizeof(a->governador)))
+        snprintf(a->governador, sizeof(a->governador), "indisponivel");
+
+    snprintf(caminho, sizeof(caminho), "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_cur_freq", a->nucleo);
+    a->frequencia_mhz = ambienteLerLinha(caminho, valor, sizeof(valor)) ? atol(valor) / 1000 : -1;
+
+    if (ambienteLerLinha("/sys/devices/system/cpu/intel_pstate/no_turbo", valor, sizeof(valor)))
+        snprintf(a->turbo, sizeof(a->turbo), "%s", atoi(valor) ? "desativado" : "ativo");
+    else if (ambienteLerLinha("/sys/devices/system/cpu/cpufreq/boost", valor, sizeof(valor)))
+        snprintf(a->turbo, sizeof(a->turbo), "%s", atoi(valor) ? "ativo" : "desativado");
+    else
+        snprintf(a->turbo, sizeof(a->turbo), "indisponivel");
+
+    if (ambienteLerLinha("/sys/devices/system/cpu/smt/active", valor, sizeof(valor)))
+        snprintf(a->smt, sizeof(a->smt), "%s", atoi(valor) ? "ativo" : "inativo");
+    else
+        snprintf(a->smt, sizeof(a->smt), "indisponivel");
+
+    ambienteCommit(a->commit, sizeof(a->commit));
+
+    /* Carga do sistema e ocupação do núcleo por outros processos (este dorme durante a janela) */
+    a->carga_1min = -1.0;
+    if (ambienteLerLinha("/proc/loadavg", valor, sizeof(valor)))
+        a->carga_1min = atof(valor);
+    int executando = ambienteProcessosExecutando();
+    a->outros_executando = executando > 0 ? executando - 1 : 0;
+
+    int nucleos[AMBIENTE_MAX_CPUS] = {0};
+    ambienteMarcarLista(a->irmaos, nucleos);
+    unsigned long long total0, ocioso0, total1, ocioso1;
+    ambienteTemposCPU(nucleos, &total0, &ocioso0);
+    struct timespec espera = {0, AMBIENTE_AMOSTRA_MS * 1000000L};
+    nanosleep(&espera, NULL);
+    ambienteTemposCPU(nucleos, &total1, &ocioso1);
+    a->ocupacao = total1 > total0 ? 1.0 - (double)(ocioso1 - ocioso0) / (double)(total1 - total0) : -1.0;
+
+    /* Resolução do relógio: declarada e efetiva */
+    struct timespec res, t0, t1;
+    a->resolucao_ns = clock_getres(CLOCK_MONOTONIC, &res) == 0 ? res.tv_sec * 1000000000L + res.tv_nsec : -1;
+    a->resolucao_efetiva_ns = -1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < AMBIENTE_AMOSTRAS_RELOGIO; i++)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        long diferenca = (t1.tv_sec - t0.tv_sec) * 1000000000L + (t1.tv_nsec - t0.tv_nsec);
+        if (diferenca > 0 && (a->resolucao_efetiva_ns < 0 || diferenca < a->resolucao_efetiva_ns))
+            a->resolucao_efetiva_ns = diferenca;
+        t0 = t1;
+    }
+
+    /* Avisos: governador e ocupação impedem a execução no modo estrito */
+    if (strcmp(a->governador, "indisponivel") == 0)
+        ambienteAvisar(a, 0, "governador de frequencia indisponivel (nao verificado)");
+    else if (strcmp(a->governador, "performance") != 0)
+    {
+        snprintf(valor, sizeof(valor), "governador '%.24s' (esperado 'performance')", a->governador);
+        ambienteAvisar(a, 1, valor);
+    }
+    if (!a->fixado)
+        ambienteAvisar(a, 0, "thread nao fixada no nucleo: a ocupacao medida pode nao valer para a execucao");
+    if (a->ocupacao > AMBIENTE_LIMIAR_OCUPACAO)
+    {
+        snprintf(valor, sizeof(valor), "nucleo %d (irmaos %.40s) %d%% ocupado por outros processos",
+                 a->nucleo, a->irmaos, (int)(a->ocupacao * 100.0 + 0.5));
+        ambienteAvisar(a, 1, valor);
+    }
+    if (strcmp(a->turbo, "ativo") == 0)
+        ambienteAvisar(a, 0, "turbo ativo: a frequencia varia com a temperatura e a carga");
+    if (a->resolucao_efetiva_ns > 1000)
+    {
+        snprintf(valor, sizeof(valor), "resolucao efetiva do relogio de %ld ns", a->resolucao_efetiva_ns);
+        ambienteAvisar(a, 0, valor);
+    }
+    a->coletado = 1;
+}
+
+/**
+ * @brief Grava a impressão digital do ambiente como linhas "# chave: valor" (coleta se preciso).
+ */
+static inline void ambienteCabecalho(FILE *saida)
+{
+    AmbienteExecucao *a = &ambienteAtual;
+    if (!a->coletado)
+        ambienteColetar(a->programa[0] ? a->programa : "ordenacao");
+
+    fprintf(saida, "# programa: %s\n", a->programa);
+    fprintf(saida, "# data: %s\n", a->data);
+    fprintf(saida, "# host: %s\n", a->host);
+    fprintf(saida, "# cpu: %s\n", a->cpu);
+    fprintf(saida, "# nucleo: %d (irmaos SMT: %s)\n", a->nucleo, a->irmaos);
+    fprintf(saida, "# afinidade: %s\n", a->fixado ? "fixada no nucleo (sched_setaffinity)" : "nao fixada");
+    fprintf(saida, "# governador: %s\n", a->governador);
+    fprintf(saida, "# frequencia_mhz: %ld\n", a->frequencia_mhz);
+    fprintf(saida, "# turbo: %s\n", a->turbo);
+    fprintf(saida, "# smt: %s\n", a->smt);
+    fprintf(saida, "# compilador: %s\n", AMBIENTE_COMPILADOR);
+    fprintf(saida, "# flags: %s\n", ORDENACAO_FLAGS);
+    fprintf(saida, "# commit: %s\n", a->commit);
+    fprintf(saida, "# carga_1min: %.2f\n", a->carga_1min);
+    fprintf(saida, "# outros_executando: %d\n", a->outros_executando);
+    fprintf(saida, "# ocupacao_nucleo: %.3f\n", a->ocupacao);
+    fprintf(saida, "# resolucao_relogio_ns: %ld (efetiva %ld)\n", a->resolucao_ns, a->resolucao_efetiva_ns);
+    for (int i = 0; i < a->num_avisos; i++)
+        fprintf(saida, "# aviso: %s\n", a->avisos[i]);
+}
+
+/**
+ * @brief Pré-voo de uma bateria de medições: coleta o ambiente, exibe o resumo e os avisos.
+ * @param programa Nome do programa que grava os resultados.
+ * @return 1 se a execução pode seguir; 0 se há avisos impeditivos e ORDENACAO_ESTRITO=1.
+ */
+static inline int ambientePreparar(const char *programa)
+{
+    const char *estrito = getenv("ORDENACAO_ESTRITO");
+    int modo_estrito = estrito && strcmp(estrito, "0") != 0;
+    AmbienteExecucao *a = &ambienteAtual;
+
+    ambienteColetar(programa);
+    printf("Ambiente: %s | nucleo %d%s | governador %s | turbo %s | SMT %s | commit %s\n", a->cpu, a->nucleo,
+           a->fixado ? " (fixado)" : "", a->governador, a->turbo, a->smt, a->commit);
+    printf("Ruido: carga %.2f | %d outro(s) processo(s) executando | nucleo %.1f%% ocupado | relogio %ld ns\n",
+           a->carga_1min, a->outros_executando, a->ocupacao < 0 ? 0.0 : a->ocupacao * 100.0,
+           a->resolucao_efetiva_ns);
+    for (int i = 0; i < a->num_avisos; i++)
+        printf("AVISO: %s\n", a->avisos[i]);
+
+    if (modo_estrito && a->recusar)
+    {
+        printf("Erro: ambiente inadequado para medicoes (ORDENACAO_ESTRITO=1). Execucao cancelada.\n");
+        return 0;
+    }
+    return 1;
+}
+
+#endif
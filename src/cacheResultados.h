@@ -0,0 +1,381 @@
+/*  ==================================================================
+ *  CACHE DE RESULTADOS ENDEREÇADO POR CONTEÚDO
+ *  Guarda as medições de cada célula do teste geral (algoritmo, cenário,
+ *  tamanho) em ../results/cache/<programa>/<chave>.cache, em que a chave
+ *  é o hash FNV-1a de tudo o que pode mudar o resultado:
+ *    - variante do kernel, hash do próprio executável (código e flags de
+ *      compilação), flags informadas pelo Makefile e versão do compilador;
+ *    - modelo da CPU, governador de frequência e turbo (ambiente.h);
+ *    - algoritmo, cenário, tamanho, semente e política de repetições;
+ *    - perfil de ajuste ativo (sequência de gaps, variante etc.), quando o
+ *      programa tem um.
+ *  Uma nova compilação de um programa invalida só as células dele: as do
+ *  outro programa continuam válidas. O conteúdo (bytes da medição) é opaco
+ *  para o cache; cada programa define a estrutura que guarda. Cada entrada
+ *  guarda também a impressão digital do ambiente em que foi medida, que os
+ *  programas gravam como "# reaproveitada: ..." nos resultados.
+ *  ORDENACAO_CACHE=0 desliga o cache (tudo é medido e nada é gravado).
+ *  ==================================================================*/
+#ifndef CACHE_RESULTADOS_H
+#define CACHE_RESULTADOS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "ambiente.h"
+
+#ifndef ORDENACAO_FLAGS
+#define ORDENACAO_FLAGS "desconhecidas" /* Definido pelo Makefile com o CFLAGS da compilação */
+#endif
+
+#define CACHE_VERSAO 4
+#define CACHE_MAGICA "ORDCACHE"
+#define CACHE_DESCRICAO 512
+#define CACHE_AMBIENTE 384
+
+typedef struct
+{
+    char magica[8];
+    unsigned int versao;
+    unsigned int reservado;
+    unsigned long long chave;
+    long long criado_em;           /* time() da gravação */
+    unsigned long long tamanho_dados;
+    unsigned long long hash_dados; /* FNV-1a do conteúdo, conferido na leitura */
+    char build[17];                /* Hash do executável que mediu (hexadecimal) */
+    char descricao[CACHE_DESCRICAO];
+    char ambiente[CACHE_AMBIENTE]; /* Impressão digital do ambiente da medição (cacheDescreverAmbiente) */
+} CabecalhoCache;
+
+/* Identifica uma célula de medição */
+typedef struct
+{
+    const char *variante;
+    const char *algoritmo;
+    const char *cenario;
+    int tamanho;
+    unsigned int semente;
+    int repeticoes;
+    int descartes;
+    const char *perfil; /* Perfil de ajuste ativo, em texto ("" se o programa não usa perfil) */
+} CelulaCache;
+
+typedef struct
+{
+    int ativo;
+    char pasta[256];
+    char build[17];
+    char cpu[128];
+} EstadoCache;
+
+static EstadoCache cacheEstado = {0, "", "", ""};
+
+/**
+ * @brief FNV-1a de 64 bits, continuando a partir de hash (use 0xcbf29ce484222325 para começar).
+ */
+static inline unsigned long long fnv1a64(unsigned long long hash, const void *dados, size_t n)
+{
+    const unsigned char *p = (const unsigned char *)dados;
+    for (size_t i = 0; i < n; i++)
+    {
+        hash ^= p[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static inline unsigned long long fnv1a64Texto(unsigned long long hash, const char *texto)
+{
+    hash = fnv1a64(hash, texto, strlen(texto));
+    return fnv1a64(hash, "|", 1); /* Separador: "ab"+"c" e "a"+"bc" geram chaves diferentes */
+}
+
+/**
+ * @brief Hash do conteúdo do executável em execução (/proc/self/exe).
+ * @return 0 se o arquivo não puder ser lido.
+ */
+static inline unsigned long long cacheHashExecutavel()
+{
+    FILE *f = fopen("/proc/self/exe", "rb");
+    unsigned char bloco[65536];
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    size_t lidos;
+
+    if (!f)
+        return 0;
+    while ((lidos = fread(bloco, 1, sizeof(bloco), f)) > 0)
+        hash = fnv1a64(hash, bloco, lidos);
+    fclose(f);
+    return hash;
+}
+
+/**
+ * @brief Modelo da CPU ("model name" de /proc/cpuinfo), ou "desconhecida".
+ */
+static inline void cacheModeloCPU(char *modelo, size_t tamanho)
+{
+    FILE *f = fopen("/proc/cpuinfo", "r");
+    char linha[256];
+
+    snprintf(modelo, tamanho, "desconhecida");
+    while (f && fgets(linha, sizeof(linha), f))
+        if (strncmp(linha, "model name", 10) == 0 && strchr(linha, ':'))
+        {
+            char *inicio = strchr(linha, ':') + 1;
+            while (*inicio == ' ')
+                inicio++;
+            inicio[strcspn(inicio, "\n")] = '\0';
+            snprintf(modelo, tamanho, "%s", inicio);
+            break;
+        }
+    if (f)
+        fclose(f);
+}
+
+/**
+ * @brief Prepara o cache do programa: identifica o build e a CPU e cria a pasta do cache.
+ * @param programa Nome da subpasta (shellSort, cycleSort).
+ * @return 1 se o cache está ativo.
+ */
+static inline int cacheIniciar(const char *programa)
+{
+    const char *ambiente = getenv("ORDENACAO_CACHE");
+    unsigned long long build = cacheHashExecutavel();
+
+    cacheEstado.ativo = !(ambiente && strcmp(ambiente, "0") == 0) && build != 0;
+    snprintf(cacheEstado.build, sizeof(cacheEstado.build), "%016llx", build);
+    cacheModeloCPU(cacheEstado.cpu, sizeof(cacheEstado.cpu));
+    snprintf(cacheEstado.pasta, sizeof(cacheEstado.pasta), "../results/cache/%s", programa);
+
+    if (cacheEstado.ativo)
+    {
+        mkdir("../results/cache", 0755);
+        mkdir(cacheEstado.pasta, 0755);
+    }
+    return cacheEstado.ativo;
+}
+
+/**
+ * @brief Impressão digital do ambiente atual (ambiente.h) guardada em cada entrada gravada.
+ */
+static inline void cacheDescreverAmbiente(char *texto, size_t tamanho)
+{
+    AmbienteExecucao *a = &ambienteAtual;
+    if (!a->coletado)
+        ambienteColetar(a->programa[0] ? a->programa : "ordenacao");
+
+    snprintf(texto, tamanho,
+             "data=%.31s, host=%.63s, nucleo=%d, governador=%.31s, frequencia_mhz=%ld, turbo=%.15s, smt=%.15s, "
+             "commit=%.63s, carga=%.2f",
+             a->data, a->host, a->nucleo, a->governador, a->frequencia_mhz, a->turbo, a->smt, a->commit,
+             a->carga_1min);
+}
+
+/**
+ * @brief Chave da célula: hash de build, flags, compilador, CPU, governador, turbo, parâmetros da
+ *        medição e perfil de ajuste.
+ */
+static inline unsigned long long cacheChave(const CelulaCache *celula)
+{
+    char numeros[64];
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    AmbienteExecucao *a = &ambienteAtual;
+
+    if (!a->coletado)
+        ambienteColetar(a->programa[0] ? a->programa : "ordenacao");
+
+    hash = fnv1a64Texto(hash, celula->variante);
+    hash = fnv1a64Texto(hash, cacheEstado.build);
+    hash = fnv1a64Texto(hash, ORDENACAO_FLAGS);
+    hash = fnv1a64Texto(hash, __VERSION__);
+    hash = fnv1a64Texto(hash, cacheEstado.cpu);
+    hash = fnv1a64Texto(hash, a->governador);
+    hash = fnv1a64Texto(hash, a->turbo);
+    hash = fnv1a64Texto(hash, celula->algoritmo);
+    hash = fnv1a64Texto(hash, celula->cenario);
+    snprintf(numeros, sizeof(numeros), "%d|%u|%d|%d", celula->tamanho, celula->semente,
+             celula->repeticoes, celula->descartes);
+    hash = fnv1a64Texto(hash, numeros);
+    return fnv1a64Texto(hash, celula->perfil ? celula->perfil : "");
+}
+
+static inline void cacheCaminho(unsigned long long chave, char *caminho, size_t tamanho)
+{
+    snprintf(caminho, tamanho, "%s/%016llx.cache", cacheEstado.pasta, chave);
+}
+
+/**
+ * @brief Procura a célula no cache e, se existir e estiver íntegra, copia o conteúdo para dados.
+ * @param ambiente Recebe a data e o ambiente da medição gravada (CACHE_AMBIENTE bytes; pode ser NULL).
+ * @return 1 em caso de acerto, 0 caso contrário (ausente, corrompida ou cache desligado).
+ */
+static inline int cacheCarregar(const CelulaCache *celula, void *dados, size_t tamanho, char *ambiente)
+{
+    char caminho[320];
+    CabecalhoCache cabecalho;
+    unsigned long long chave;
+    int acerto = 0;
+
+    if (!cacheEstado.ativo)
+        return 0;
+
+    chave = cacheChave(celula);
+    cacheCaminho(chave, caminho, sizeof(caminho));
+    FILE *f = fopen(caminho, "rb");
+    if (!f)
+        return 0;
+
+    if (fread(&cabecalho, sizeof(cabecalho), 1, f) == 1 && memcmp(cabecalho.magica, CACHE_MAGICA, 8) == 0 &&
+        cabecalho.versao == CACHE_VERSAO && cabecalho.chave == chave && cabecalho.tamanho_dados == tamanho &&
+        fread(dados, 1, tamanho, f) == tamanho)
+        acerto = fnv1a64(0xcbf29ce484222325ULL, dados, tamanho) == cabecalho.hash_dados;
+    fclose(f);
+
+    if (acerto && ambiente)
+    {
+        cabecalho.ambiente[CACHE_AMBIENTE - 1] = '\0';
+        snprintf(ambiente, CACHE_AMBIENTE, "%s", cabecalho.ambiente);
+    }
+    return acerto;
+}
+
+/**
+ * @brief Marca nos resultados uma célula reaproveitada do cache, com o ambiente em que foi medida
+ *        (o cabeçalho de ambienteCabecalho() descreve apenas a execução atual).
+ * @param ambiente Ambiente devolvido por cacheCarregar(); "" ou NULL se a célula foi medida agora (nada é gravado).
+ */
+static inline void cacheCabecalhoReaproveitada(FILE *saida, const char *algoritmo, const char *cenario, int tamanho,
+                                               const char *ambiente)
+{
+    if (ambiente && *ambiente)
+        fprintf(saida, "# reaproveitada: %s;%s;%d | %s\n", algoritmo, cenario, tamanho, ambiente);
+}
+
+/**
+ * @brief Grava a célula no cache (arquivo temporário + rename, para nunca deixar uma entrada pela metade).
+ */
+static inline void cacheSalvar(const CelulaCache *celula, const void *dados, size_t tamanho)
+{
+    char caminho[320], temporario[336];
+    CabecalhoCache cabecalho;
+
+    if (!cacheEstado.ativo)
+        return;
+
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.magica, CACHE_MAGICA, 8);
+    cabecalho.versao = CACHE_VERSAO;
+    cabecalho.chave = cacheChave(celula);
+    cabecalho.criado_em = (long long)time(NULL);
+    cabecalho.tamanho_dados = tamanho;
+    cabecalho.hash_dados = fnv1a64(0xcbf29ce484222325ULL, dados, tamanho);
+    snprintf(cabecalho.build, sizeof(cabecalho.build), "%s", cacheEstado.build);
+    snprintf(cabecalho.descricao, sizeof(cabecalho.descricao),
+             "%s;%s;%d;%s;semente=%u;repeticoes=%d/%d;perfil=%s;flags=%s;cpu=%s", celula->algoritmo,
+             celula->cenario, celula->tamanho, celula->variante, celula->semente, celula->repeticoes,
+             celula->descartes, celula->perfil && *celula->perfil ? celula->perfil : "-", ORDENACAO_FLAGS,
+             cacheEstado.cpu);
+    cacheDescreverAmbiente(cabecalho.ambiente, sizeof(cabecalho.ambiente));
+
+    cacheCaminho(cabecalho.chave, caminho, sizeof(caminho));
+    snprintf(temporario, sizeof(temporario), "%s.tmp", caminho);
+    FILE *f = fopen(temporario, "wb");
+    if (!f)
+    {
+        printf("Erro ao gravar o cache em %s\n", temporario);
+        return;
+    }
+    int ok = fwrite(&cabecalho, sizeof(cabecalho), 1, f) == 1 && fwrite(dados, 1, tamanho, f) == tamanho;
+    ok = fclose(f) == 0 && ok;
+    if (!ok || rename(temporario, caminho) != 0)
+    {
+        printf("Erro ao gravar o cache em %s\n", caminho);
+        remove(temporario);
+    }
+}
+
+/**
+ * @brief Percorre as entradas do cache: lista (remover = 0) ou remove as que casam com o filtro.
+ * @param filtro Trecho procurado na descrição da entrada (NULL ou "" = todas).
+ * @param somente_obsoletas Considera apenas entradas gravadas por outro build deste programa.
+ * @return Número de entradas listadas ou removidas.
+ */
+static inline int cachePercorrer(const char *filtro, int somente_obsoletas, int remover)
+{
+    DIR *pasta = opendir(cacheEstado.pasta);
+    struct dirent *entrada;
+    int total = 0;
+    long long bytes = 0;
+
+    if (!pasta)
+    {
+        printf("Cache vazio (%s nao existe).\n", cacheEstado.pasta);
+        return 0;
+    }
+
+    if (!remover)
+    {
+        printf("\nCache: %s (build atual %s)\n", cacheEstado.pasta, cacheEstado.build);
+        printf("%-16s  %-19s  %-16s  %s\n", "chave", "gravada em", "build", "descricao");
+    }
+
+    while ((entrada = readdir(pasta)) != NULL)
+    {
+        size_t n = strlen(entrada->d_name);
+        if (n < 6 || strcmp(entrada->d_name + n - 6, ".cache") != 0)
+            continue;
+
+        char caminho[600];
+        CabecalhoCache cabecalho;
+        snprintf(caminho, sizeof(caminho), "%s/%s", cacheEstado.pasta, entrada->d_name);
+        FILE *f = fopen(caminho, "rb");
+        int valido = f && fread(&cabecalho, sizeof(cabecalho), 1, f) == 1 &&
+                     memcmp(cabecalho.magica, CACHE_MAGICA, 8) == 0 && cabecalho.versao == CACHE_VERSAO;
+        if (f)
+            fclose(f);
+        if (!valido)
+        {
+            memset(&cabecalho, 0, sizeof(cabecalho));
+            snprintf(cabecalho.descricao, sizeof(cabecalho.descricao), "(entrada ilegivel)");
+        }
+        cabecalho.descricao[CACHE_DESCRICAO - 1] = '\0';
+        cabecalho.ambiente[CACHE_AMBIENTE - 1] = '\0';
+        cabecalho.build[16] = '\0';
+
+        if (filtro && *filtro && !strstr(cabecalho.descricao, filtro))
+            continue;
+        if (somente_obsoletas && valido && strcmp(cabecalho.build, cacheEstado.build) == 0)
+            continue;
+
+        if (remover)
+        {
+            if (remove(caminho) == 0)
+                total++;
+            continue;
+        }
+
+        char data[32] = "-";
+        time_t criado = (time_t)cabecalho.criado_em;
+        struct tm *tm_info = localtime(&criado);
+        if (valido && tm_info)
+            strftime(data, sizeof(data), "%Y-%m-%d %H:%M:%S", tm_info);
+        printf("%.16s  %-19s  %-16s  %s%s\n", entrada->d_name, data, cabecalho.build, cabecalho.descricao,
+               strcmp(cabecalho.build, cacheEstado.build) == 0 ? "" : "  [outro build]");
+        if (valido)
+            printf("%-16s  ambiente: %s\n", "", cabecalho.ambiente);
+        bytes += sizeof(cabecalho) + cabecalho.tamanho_dados;
+        total++;
+    }
+    closedir(pasta);
+
+    if (remover)
+        printf("%d entrada(s) removida(s) de %s\n", total, cacheEstado.pasta);
+    else
+        printf("%d entrada(s), %.1f KiB\n", total, bytes / 1024.0);
+    return total;
+}
+
+#endif
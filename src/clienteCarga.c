@@ -0,0 +1,305 @@
+/*  ==================================================================
+ *  GERADOR DE CARGA DO SERVIÇO DE ORDENAÇÃO
+ *  Cria um segmento de memória compartilhada dividido em "janelas" (uma
+ *  por pedido em voo), mantém todas ocupadas em laço fechado e mede, para
+ *  cada pedido, o tempo entre o envio e a resposta do servicoOrdenacao.
+ *  Cada trecho devolvido é conferido (ordem) antes de ser reabastecido.
+ *  Uso: ./clienteCarga [pedidos] [elementos] [em_voo] [algoritmo]
+ *  ==================================================================*/
+
+/*  ============================ BIBLIOTECAS ===========================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "ordenacao.h"
+#include "servicoOrdenacao.h"
+#include "ambiente.h"
+
+/*  ============================ CONSTANTES ===========================*/
+#define PEDIDOS_PADRAO 20000
+#define ELEMENTOS_PADRAO 1024
+#define EM_VOO_PADRAO 32
+#define MAX_EM_VOO 1024
+#define ENTRADAS_DISTINTAS 16 /* Vetores aleatórios pré-gerados, copiados em rodízio para as janelas */
+
+/* ================= ESTRUTURAS ================= */
+typedef struct
+{
+    uint64_t envio_ns;
+    int ocupada;
+} Janela;
+
+/* ================= FUNÇÕES AUXILIARES ================= */
+/**
+ * @brief Função de comparação de uint64_t para qsort.
+ */
+int compararUint64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Percentil (0-100) de um vetor ordenado de latências.
+ */
+double percentil(const uint64_t ordenadas[], long n, double p)
+{
+    long indice = (long)(p / 100.0 * (double)(n - 1) + 0.5);
+    return (double)ordenadas[indice];
+}
+
+/**
+ * @brief Conecta ao socket do serviço.
+ * @return Descritor conectado, ou -1 em caso de erro.
+ */
+int conectarServico(const char *caminho)
+{
+    struct sockaddr_un endereco = {.sun_family = AF_UNIX};
+    if (strlen(caminho) >= sizeof(endereco.sun_path))
+        return -1;
+    strcpy(endereco.sun_path, caminho);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        return -1;
+    if (connect(fd, (struct sockaddr *)&endereco, sizeof(endereco)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Copia uma das entradas pré-geradas para a janela e envia o pedido de ordenação.
+ * @return 1 em caso de sucesso, 0 se a conexão falhou.
+ */
+int enviarPedido(int fd, int32_t *segmento, const int32_t *entradas, int janela, int elementos, int algoritmo,
+                 uint64_t id, Janela *estado)
+{
+    int64_t inicio = (int64_t)janela * elementos;
+    memcpy(segmento + inicio, entradas + (id % ENTRADAS_DISTINTAS) * (uint64_t)elementos,
+           (size_t)elementos * sizeof(int32_t));
+
+    PedidoServico p = {.magica = SERVICO_MAGICA,
+                       .operacao = SERVICO_ORDENAR,
+                       .id = id * MAX_EM_VOO + (uint64_t)janela,
+                       .algoritmo = algoritmo,
+                       .tipo = SERVICO_TIPO_INT32,
+                       .inicio = inicio,
+                       .quantidade = elementos};
+    estado->envio_ns = servicoAgoraNs();
+    estado->ocupada = 1;
+    return servicoEscreverTudo(fd, &p, sizeof(p));
+}
+
+/**
+ * @brief Grava o resumo da carga em ../results/files/servico/ com o cabeçalho do ambiente.
+ */
+void salvarCSVCarga(long pedidos, int elementos, int em_voo, int algoritmo, double segundos,
+                    const uint64_t latencias[], double lote_medio, double fila_media_us, double ordenacao_media_us)
+{
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    mkdir("../results/files/servico", 0755);
+    sprintf(nomeCSV, "../results/files/servico/servico_carga_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV.\n");
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "algoritmo;elementos;em_voo;pedidos;pedidos_s;melementos_s;lote_medio;fila_us;ordenacao_us;"
+                 "p50_us;p90_us;p99_us;p999_us;max_us\n");
+    fprintf(csv, "%d;%d;%d;%ld;%.1f;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f\n", algoritmo, elementos, em_voo,
+            pedidos, pedidos / segundos, pedidos * (double)elementos / segundos / 1e6, lote_medio, fila_media_us,
+            ordenacao_media_us, percentil(latencias, pedidos, 50) / 1e3, percentil(latencias, pedidos, 90) / 1e3,
+            percentil(latencias, pedidos, 99) / 1e3, percentil(latencias, pedidos, 99.9) / 1e3,
+            latencias[pedidos - 1] / 1e3);
+    fclose(csv);
+    printf("Resultados salvos em %s\n", nomeCSV);
+}
+
+/**
+ * @brief Sessão de carga: anexa o segmento, mantém em_voo pedidos em voo até completar
+ *        `pedidos`, confere cada trecho devolvido e exibe vazão e latências.
+ * @return Código de saída do programa (0 se todos os pedidos foram ordenados corretamente).
+ */
+int executarCarga(const char *nome_shm, int32_t *segmento, const int32_t *entradas, uint64_t latencias[],
+                  Janela janelas[], long pedidos, int elementos, int em_voo, int algoritmo)
+{
+    const char *caminho = servicoCaminhoSocket();
+    int fd = conectarServico(caminho);
+    if (fd < 0)
+    {
+        printf("Erro: servico indisponivel em %s (inicie ./servicoOrdenacao).\n", caminho);
+        return 1;
+    }
+
+    /* Anexa o segmento: o servidor passa a enxergar os mesmos dados, sem cópias */
+    PedidoServico anexar = {.magica = SERVICO_MAGICA,
+                            .operacao = SERVICO_ANEXAR,
+                            .quantidade = (int64_t)elementos * em_voo};
+    strncpy(anexar.nome_shm, nome_shm, sizeof(anexar.nome_shm) - 1);
+    RespostaServico resposta;
+    if (!servicoEscreverTudo(fd, &anexar, sizeof(anexar)) || !servicoLerTudo(fd, &resposta, sizeof(resposta)) ||
+        resposta.codigo != ORDENACAO_OK)
+    {
+        printf("Erro: o servico nao anexou o segmento %s.\n", nome_shm);
+        close(fd);
+        return 1;
+    }
+    /* Os dois mapeamentos mantêm o segmento vivo; sem o nome, nada sobra se o cliente for interrompido */
+    shm_unlink(nome_shm);
+
+    printf("Carga: %ld pedidos de %d elementos, %d em voo, algoritmo %d\n", pedidos, elementos, em_voo, algoritmo);
+
+    long enviados = 0, concluidos = 0, falhas = 0;
+    double soma_lote = 0.0, soma_fila_ns = 0.0, soma_ordenacao_ns = 0.0;
+    int conectado = 1;
+    uint64_t comeco = servicoAgoraNs();
+
+    for (int j = 0; j < em_voo && conectado; j++)
+        conectado = enviarPedido(fd, segmento, entradas, j, elementos, algoritmo, (uint64_t)enviados++, &janelas[j]);
+
+    while (conectado && concluidos < pedidos)
+    {
+        if (!servicoLerTudo(fd, &resposta, sizeof(resposta)))
+        {
+            conectado = 0;
+            break;
+        }
+        uint64_t chegada = servicoAgoraNs();
+        int j = (int)(resposta.id % MAX_EM_VOO);
+        if (j >= em_voo || !janelas[j].ocupada)
+        {
+            printf("Erro: resposta com id desconhecido (%llu).\n", (unsigned long long)resposta.id);
+            close(fd);
+            return 1;
+        }
+        janelas[j].ocupada = 0;
+        latencias[concluidos++] = chegada - janelas[j].envio_ns;
+        soma_lote += resposta.lote;
+        soma_fila_ns += (double)resposta.fila_ns;
+        soma_ordenacao_ns += (double)resposta.ordenacao_ns;
+        if (resposta.codigo != ORDENACAO_OK ||
+            ordenacaoPrimeiraInversao(segmento + (int64_t)j * elementos, elementos) >= 0)
+            falhas++;
+
+        if (enviados < pedidos)
+            conectado = enviarPedido(fd, segmento, entradas, j, elementos, algoritmo, (uint64_t)enviados++,
+                                     &janelas[j]);
+    }
+    close(fd);
+    if (!conectado)
+    {
+        printf("Erro: conexao com o servico perdida.\n");
+        return 1;
+    }
+
+    double segundos = (double)(servicoAgoraNs() - comeco) / 1e9;
+    qsort(latencias, (size_t)pedidos, sizeof(uint64_t), compararUint64);
+
+    printf("------------------------------------------------------------\n");
+    printf("Vazao:     %.0f pedidos/s | %.2f M elementos/s (%.3f s)\n", pedidos / segundos,
+           pedidos * (double)elementos / segundos / 1e6, segundos);
+    printf("Latencia:  p50 %.1f us | p90 %.1f us | p99 %.1f us | p99.9 %.1f us | max %.1f us\n",
+           percentil(latencias, pedidos, 50) / 1e3, percentil(latencias, pedidos, 90) / 1e3,
+           percentil(latencias, pedidos, 99) / 1e3, percentil(latencias, pedidos, 99.9) / 1e3,
+           latencias[pedidos - 1] / 1e3);
+    printf("Servidor:  %.1f pedidos/lote | fila %.1f us | ordenacao %.1f us (medias)\n", soma_lote / pedidos,
+           soma_fila_ns / pedidos / 1e3, soma_ordenacao_ns / pedidos / 1e3);
+    printf("Verificacao: %s (%ld falha(s))\n", falhas ? "FALHOU" : "OK", falhas);
+
+    salvarCSVCarga(pedidos, elementos, em_voo, algoritmo, segundos, latencias, soma_lote / pedidos,
+                   soma_fila_ns / pedidos / 1e3, soma_ordenacao_ns / pedidos / 1e3);
+    return falhas ? 1 : 0;
+}
+
+void exibirUso(const char *programa)
+{
+    printf("Uso: %s [pedidos] [elementos] [em_voo] [algoritmo]\n", programa);
+    printf("  pedidos   : total de pedidos de ordenacao (padrao %d)\n", PEDIDOS_PADRAO);
+    printf("  elementos : elementos int32 por pedido (padrao %d)\n", ELEMENTOS_PADRAO);
+    printf("  em_voo    : pedidos simultaneos, cada um em sua janela do segmento (padrao %d, maximo %d)\n",
+           EM_VOO_PADRAO, MAX_EM_VOO);
+    printf("  algoritmo : %d - Shell Sort, %d - Cycle Sort, %d - Shell Sort paralelo (padrao %d)\n",
+           ORDENACAO_SHELL, ORDENACAO_CYCLE, SERVICO_PARALELO, ORDENACAO_SHELL);
+    printf("Socket: ORDENACAO_SERVICO (padrao %s)\n", SERVICO_SOCKET_PADRAO);
+}
+
+/* ================= PROGRAMA PRINCIPAL ================= */
+int main(int argc, char *argv[])
+{
+    long pedidos = argc > 1 ? atol(argv[1]) : PEDIDOS_PADRAO;
+    int elementos = argc > 2 ? atoi(argv[2]) : ELEMENTOS_PADRAO;
+    int em_voo = argc > 3 ? atoi(argv[3]) : EM_VOO_PADRAO;
+    int algoritmo = argc > 4 ? atoi(argv[4]) : ORDENACAO_SHELL;
+
+    if (pedidos < 1 || elementos < 1 || em_voo < 1 || em_voo > MAX_EM_VOO || algoritmo < 0 ||
+        algoritmo > SERVICO_PARALELO || (int64_t)elementos * em_voo > INT32_MAX)
+    {
+        exibirUso(argv[0]);
+        return 1;
+    }
+    if (em_voo > pedidos)
+        em_voo = (int)pedidos;
+
+    if (!ambientePreparar("clienteCarga"))
+        return 1;
+
+    /* Segmento compartilhado: uma janela de `elementos` por pedido em voo */
+    char nome_shm[SERVICO_NOME_SHM];
+    snprintf(nome_shm, sizeof(nome_shm), "/ordenacao_carga_%d", (int)getpid());
+    int64_t total = (int64_t)elementos * em_voo;
+    size_t bytes = (size_t)total * sizeof(int32_t);
+    int shm = shm_open(nome_shm, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (shm < 0 || ftruncate(shm, (off_t)bytes) != 0)
+    {
+        printf("Erro ao criar a memoria compartilhada %s.\n", nome_shm);
+        if (shm >= 0)
+        {
+            close(shm);
+            shm_unlink(nome_shm);
+        }
+        return 1;
+    }
+    int32_t *segmento = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, shm, 0);
+    close(shm);
+    int32_t *entradas = malloc((size_t)ENTRADAS_DISTINTAS * elementos * sizeof(int32_t));
+    uint64_t *latencias = malloc((size_t)pedidos * sizeof(uint64_t));
+    Janela *janelas = calloc((size_t)em_voo, sizeof(Janela));
+    if (segmento == MAP_FAILED || !entradas || !latencias || !janelas)
+    {
+        printf("Erro de alocacao de memoria.\n");
+        if (segmento != MAP_FAILED)
+            munmap(segmento, bytes);
+        shm_unlink(nome_shm);
+        free(entradas);
+        free(latencias);
+        free(janelas);
+        return 1;
+    }
+    for (int i = 0; i < ENTRADAS_DISTINTAS; i++)
+        ordenacaoGerarVetor(entradas + (size_t)i * elementos, elementos, 3, 1000u + (unsigned int)i);
+
+    int codigo_saida = executarCarga(nome_shm, segmento, entradas, latencias, janelas, pedidos, elementos, em_voo,
+                                     algoritmo);
+
+    munmap(segmento, bytes);
+    shm_unlink(nome_shm);
+    free(entradas);
+    free(latencias);
+    free(janelas);
+    return codigo_saida;
+}
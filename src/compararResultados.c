@@ -0,0 +1,683 @@
+/*  ============================ BIBLIOTECAS ===========================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+/*  ============================ CONSTANTES ===========================*/
+#define QTD_DESCARTES 1        /* Repetições de warm-up ignoradas (mesmo valor usado pelos programas de ordenação) */
+#define LIMIAR_PADRAO 5.0      /* Regressão mínima (%) para falhar a comparação */
+#define ALFA_PADRAO 0.05       /* Nível de significância padrão do teste */
+#define TAM_LINHA 512          /* Tamanho máximo de uma linha do CSV */
+#define MAX_EXATO 40           /* Até n1 + n2 amostras sem empates, usa a distribuição exata de U */
+#define MAX_AMBIENTE 48        /* Linhas "# chave: valor" do ambiente guardadas por arquivo */
+
+/* Códigos de saída */
+#define SAIDA_OK 0
+#define SAIDA_REGRESSAO 1
+#define SAIDA_ERRO 2
+
+/* ================= ESTRUTURAS ================= */
+typedef struct
+{
+    char algoritmo[50];
+    char cenario[20];
+    int tamanho;
+    double *tempos;
+    int num_tempos;
+    int capacidade;
+} GrupoMedicoes;
+
+typedef struct
+{
+    GrupoMedicoes *grupos;
+    int num_grupos;
+    int capacidade;
+    char variante[20]; /* Variante dos kernels registrada no CSV (vazia em arquivos antigos) */
+    char ambiente[MAX_AMBIENTE][TAM_LINHA]; /* Cabeçalho "# chave: valor" gravado por ambiente.h */
+    int num_ambiente;
+} ConjuntoResultados;
+
+typedef struct
+{
+    double mediana_base;
+    double mediana_novo;
+    double razao;          /* Estimador de Hodges-Lehmann para tempo_novo / tempo_base */
+    double ic_inferior;
+    double ic_superior;
+    double u;
+    double p_valor;
+    int exato;
+} ResultadoComparacao;
+
+/* ================= FUNÇÕES AUXILIARES ================= */
+/**
+ * @brief Função de comparação de doubles para qsort.
+ * @param a Ponteiro para o primeiro valor.
+ * @param b Ponteiro para o segundo valor.
+ * @return Negativo, zero ou positivo conforme a ordem dos valores.
+ */
+int compararDouble(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Calcula a mediana de um vetor de doubles (o vetor é ordenado no processo).
+ * @param valores Vetor de valores.
+ * @param n Quantidade de valores.
+ * @return Mediana dos valores.
+ */
+double calcularMediana(double valores[], int n)
+{
+    qsort(valores, n, sizeof(double), compararDouble);
+    if (n % 2 == 1)
+        return valores[n / 2];
+    return (valores[n / 2 - 1] + valores[n / 2]) / 2.0;
+}
+
+/**
+ * @brief Calcula o quantil da distribuição normal padrão por bissecção sobre erfc.
+ * @param p Probabilidade acumulada desejada (0 < p < 1).
+ * @return Valor z tal que P(Z <= z) = p.
+ */
+double quantilNormal(double p)
+{
+    double inf = -10.0, sup = 10.0;
+    for (int i = 0; i < 100; i++)
+    {
+        double meio = (inf + sup) / 2.0;
+        if (0.5 * erfc(-meio / sqrt(2.0)) < p)
+            inf = meio;
+        else
+            sup = meio;
+    }
+    return (inf + sup) / 2.0;
+}
+
+/**
+ * @brief Separa uma linha do CSV em campos usando ';' como delimitador.
+ * @param linha Linha a ser separada (modificada no processo).
+ * @param campos Vetor que recebe os ponteiros para cada campo.
+ * @param max_campos Quantidade máxima de campos.
+ * @return Número de campos encontrados.
+ */
+int separarCampos(char *linha, char *campos[], int max_campos)
+{
+    int n = 0;
+    char *inicio = linha;
+
+    linha[strcspn(linha, "\r\n")] = '\0';
+    while (n < max_campos)
+    {
+        campos[n++] = inicio;
+        char *sep = strchr(inicio, ';');
+        if (!sep)
+            break;
+        *sep = '\0';
+        inicio = sep + 1;
+    }
+    return n;
+}
+
+/**
+ * @brief Retorna o índice de uma coluna no cabeçalho do CSV.
+ * @param campos Campos do cabeçalho.
+ * @param num_campos Número de campos.
+ * @param nome Nome da coluna procurada.
+ * @return Índice da coluna ou -1 se não existir.
+ */
+int indiceColuna(char *campos[], int num_campos, const char *nome)
+{
+    for (int i = 0; i < num_campos; i++)
+        if (strcmp(campos[i], nome) == 0)
+            return i;
+    return -1;
+}
+
+/**
+ * @brief Localiza (ou cria) o grupo de medições de uma combinação algoritmo/cenário/tamanho.
+ * @param conjunto Conjunto de resultados.
+ * @param algoritmo Nome do algoritmo.
+ * @param cenario Nome do cenário.
+ * @param tamanho Tamanho do vetor.
+ * @param criar Se diferente de zero, cria o grupo quando não existir.
+ * @return Ponteiro para o grupo ou NULL.
+ */
+GrupoMedicoes *buscarGrupo(ConjuntoResultados *conjunto, const char *algoritmo, const char *cenario,
+                           int tamanho, int criar)
+{
+    for (int i = 0; i < conjunto->num_grupos; i++)
+    {
+        GrupoMedicoes *g = &conjunto->grupos[i];
+        if (g->tamanho == tamanho && strcmp(g->algoritmo, algoritmo) == 0 && strcmp(g->cenario, cenario) == 0)
+            return g;
+    }
+
+    if (!criar)
+        return NULL;
+
+    if (conjunto->num_grupos == conjunto->capacidade)
+    {
+        int nova_capacidade = conjunto->capacidade ? conjunto->capacidade * 2 : 16;
+        GrupoMedicoes *novos = realloc(conjunto->grupos, nova_capacidade * sizeof(GrupoMedicoes));
+        if (!novos)
+            return NULL;
+        conjunto->grupos = novos;
+        conjunto->capacidade = nova_capacidade;
+    }
+
+    GrupoMedicoes *g = &conjunto->grupos[conjunto->num_grupos++];
+    memset(g, 0, sizeof(GrupoMedicoes));
+    snprintf(g->algoritmo, sizeof(g->algoritmo), "%s", algoritmo);
+    snprintf(g->cenario, sizeof(g->cenario), "%s", cenario);
+    g->tamanho = tamanho;
+    return g;
+}
+
+/**
+ * @brief Adiciona um tempo a um grupo de medições.
+ * @param g Grupo de medições.
+ * @param tempo Tempo em milissegundos.
+ * @return 1 em caso de sucesso, 0 se faltar memória.
+ */
+int adicionarTempo(GrupoMedicoes *g, double tempo)
+{
+    if (g->num_tempos == g->capacidade)
+    {
+        int nova_capacidade = g->capacidade ? g->capacidade * 2 : 16;
+        double *novos = realloc(g->tempos, nova_capacidade * sizeof(double));
+        if (!novos)
+            return 0;
+        g->tempos = novos;
+        g->capacidade = nova_capacidade;
+    }
+    g->tempos[g->num_tempos++] = tempo;
+    return 1;
+}
+
+/**
+ * @brief Libera a memória de um conjunto de resultados.
+ * @param conjunto Conjunto de resultados.
+ * @return void
+ */
+void liberarConjunto(ConjuntoResultados *conjunto)
+{
+    for (int i = 0; i < conjunto->num_grupos; i++)
+        free(conjunto->grupos[i].tempos);
+    free(conjunto->grupos);
+    conjunto->grupos = NULL;
+    conjunto->num_grupos = conjunto->capacidade = 0;
+}
+
+/**
+ * @brief Lê as medições individuais de um CSV gerado por salvarCSVGeral().
+ *        A leitura para no bloco de estatísticas e ignora as repetições de warm-up.
+ * @param caminho Caminho do arquivo CSV.
+ * @param conjunto Conjunto que recebe as medições.
+ * @return 1 em caso de sucesso, 0 em caso de erro.
+ */
+int carregarCSV(const char *caminho, ConjuntoResultados *conjunto)
+{
+    FILE *csv = fopen(caminho, "r");
+    if (!csv)
+    {
+        printf("Erro ao abrir o arquivo CSV: %s\n", caminho);
+        return 0;
+    }
+
+    char linha[TAM_LINHA];
+    char *campos[16];
+
+    /* Cabeçalho do ambiente: linhas "# chave: valor" antes das colunas */
+    int lida;
+    while ((lida = fgets(linha, sizeof(linha), csv) != NULL) && linha[0] == '#')
+    {
+        if (conjunto->num_ambiente < MAX_AMBIENTE)
+        {
+            linha[strcspn(linha, "\r\n")] = '\0';
+            snprintf(conjunto->ambiente[conjunto->num_ambiente++], TAM_LINHA, "%s", linha + (linha[1] == ' ' ? 2 : 1));
+        }
+    }
+
+    if (!lida)
+    {
+        printf("Arquivo CSV vazio: %s\n", caminho);
+        fclose(csv);
+        return 0;
+    }
+
+    int num_campos = separarCampos(linha, campos, 16);
+    int col_algoritmo = indiceColuna(campos, num_campos, "algoritmo");
+    int col_cenario = indiceColuna(campos, num_campos, "cenario");
+    int col_tamanho = indiceColuna(campos, num_campos, "tamanho");
+    int col_repeticao = indiceColuna(campos, num_campos, "repeticao");
+    int col_tempo = indiceColuna(campos, num_campos, "tempo_ms");
+    int col_variante = indiceColuna(campos, num_campos, "variante");
+
+    if (col_algoritmo < 0 || col_cenario < 0 || col_tamanho < 0 || col_repeticao < 0 || col_tempo < 0)
+    {
+        printf("Cabecalho invalido em %s (esperado algoritmo;cenario;tamanho;repeticao;tempo_ms;...)\n", caminho);
+        fclose(csv);
+        return 0;
+    }
+
+    while (fgets(linha, sizeof(linha), csv))
+    {
+        /* Linha em branco separa as medições do bloco de estatísticas */
+        if (linha[0] == '\n' || linha[0] == '\r' || linha[0] == '\0')
+            break;
+        if (linha[0] == '#')
+            continue;
+
+        num_campos = separarCampos(linha, campos, 16);
+        if (num_campos <= col_tempo || num_campos <= col_repeticao)
+            continue;
+
+        if (col_variante >= 0 && num_campos > col_variante && conjunto->variante[0] == '\0')
+            snprintf(conjunto->variante, sizeof(conjunto->variante), "%s", campos[col_variante]);
+
+        int repeticao = atoi(campos[col_repeticao]);
+        if (repeticao <= QTD_DESCARTES)
+            continue;
+
+        GrupoMedicoes *g = buscarGrupo(conjunto, campos[col_algoritmo], campos[col_cenario],
+                                       atoi(campos[col_tamanho]), 1);
+        if (!g || !adicionarTempo(g, atof(campos[col_tempo])))
+        {
+            printf("Erro ao alocar memoria!\n");
+            fclose(csv);
+            return 0;
+        }
+    }
+
+    fclose(csv);
+    return 1;
+}
+
+/**
+ * @brief Valor de uma chave do cabeçalho de ambiente de um conjunto ("cpu", "commit"...).
+ * @return Ponteiro para o valor, ou NULL se o arquivo não registra a chave.
+ */
+const char *valorAmbiente(const ConjuntoResultados *conjunto, const char *chave)
+{
+    size_t n = strlen(chave);
+    for (int i = 0; i < conjunto->num_ambiente; i++)
+        if (strncmp(conjunto->ambiente[i], chave, n) == 0 && conjunto->ambiente[i][n] == ':')
+            return conjunto->ambiente[i] + n + (conjunto->ambiente[i][n + 1] == ' ' ? 2 : 1);
+    return NULL;
+}
+
+/**
+ * @brief Avisa quando os dois arquivos foram medidos em máquinas ou builds diferentes.
+ * @return Número de chaves do ambiente com valores diferentes.
+ */
+int compararAmbientes(const ConjuntoResultados *base, const ConjuntoResultados *novo)
+{
+    const char *chaves[] = {"cpu", "governador", "turbo", "smt", "compilador", "flags", "commit"};
+    int diferencas = 0;
+
+    if (base->num_ambiente == 0 || novo->num_ambiente == 0)
+    {
+        printf("  AVISO: %s sem cabecalho de ambiente; nao e possivel conferir se as medicoes sao comparaveis\n",
+               base->num_ambiente == 0 ? "base" : "novo");
+        return 0;
+    }
+
+    for (int i = 0; i < (int)(sizeof(chaves) / sizeof(chaves[0])); i++)
+    {
+        const char *vb = valorAmbiente(base, chaves[i]);
+        const char *vn = valorAmbiente(novo, chaves[i]);
+        if (vb && vn && strcmp(vb, vn) != 0)
+        {
+            printf("  AVISO: ambiente diferente em %s: '%s' (base) x '%s' (novo)\n", chaves[i], vb, vn);
+            diferencas++;
+        }
+    }
+    for (int i = 0; i < novo->num_ambiente; i++)
+        if (strncmp(novo->ambiente[i], "aviso:", 6) == 0)
+            printf("  AVISO do pre-voo (novo): %s\n", novo->ambiente[i] + 7);
+
+    /* Células reaproveitadas do cache foram medidas em outra execução: o cabeçalho não as descreve */
+    for (int i = 0; i < base->num_ambiente; i++)
+        if (strncmp(base->ambiente[i], "reaproveitada:", 14) == 0)
+            printf("  AVISO: celula reaproveitada do cache (base): %s\n", base->ambiente[i] + 15);
+    for (int i = 0; i < novo->num_ambiente; i++)
+        if (strncmp(novo->ambiente[i], "reaproveitada:", 14) == 0)
+            printf("  AVISO: celula reaproveitada do cache (novo): %s\n", novo->ambiente[i] + 15);
+    return diferencas;
+}
+
+/* ================= TESTE DE MANN-WHITNEY ================= */
+/**
+ * @brief Calcula a probabilidade exata P(U <= u) sob H0 (sem empates) por programação dinâmica.
+ * @param n1 Tamanho da primeira amostra.
+ * @param n2 Tamanho da segunda amostra.
+ * @param u Valor da estatística U.
+ * @return Probabilidade acumulada.
+ */
+double probabilidadeExataU(int n1, int n2, double u)
+{
+    int max_u = n1 * n2;
+    /* contagem[i][j][k]: número de arranjos de i elementos de A e j de B com U = k */
+    double *atual = calloc((size_t)(n2 + 1) * (max_u + 1), sizeof(double));
+    double *anterior = calloc((size_t)(n2 + 1) * (max_u + 1), sizeof(double));
+    if (!atual || !anterior)
+    {
+        free(atual);
+        free(anterior);
+        return -1.0;
+    }
+
+#define CELULA(m, j, k) (m)[(size_t)(j) * (max_u + 1) + (k)]
+    for (int j = 0; j <= n2; j++)
+        CELULA(anterior, j, 0) = 1.0;
+
+    for (int i = 1; i <= n1; i++)
+    {
+        memset(atual, 0, (size_t)(n2 + 1) * (max_u + 1) * sizeof(double));
+        CELULA(atual, 0, 0) = 1.0;
+        for (int j = 1; j <= n2; j++)
+        {
+            for (int k = 0; k <= i * j; k++)
+            {
+                /* O maior elemento vem de A (soma j a U) ou de B */
+                double valor = CELULA(atual, j - 1, k);
+                if (k >= j)
+                    valor += CELULA(anterior, j, k - j);
+                CELULA(atual, j, k) = valor;
+            }
+        }
+        double *troca = anterior;
+        anterior = atual;
+        atual = troca;
+    }
+
+    double total = 0.0, acumulado = 0.0;
+    for (int k = 0; k <= max_u; k++)
+    {
+        total += CELULA(anterior, n2, k);
+        if (k <= u)
+            acumulado += CELULA(anterior, n2, k);
+    }
+#undef CELULA
+
+    free(atual);
+    free(anterior);
+    return acumulado / total;
+}
+
+/**
+ * @brief Executa o teste U de Mann-Whitney bilateral entre duas amostras.
+ *        Usa a distribuição exata para amostras pequenas sem empates e a aproximação
+ *        normal (com correção de empates e de continuidade) nos demais casos.
+ * @param a Primeira amostra.
+ * @param n1 Tamanho da primeira amostra.
+ * @param b Segunda amostra.
+ * @param n2 Tamanho da segunda amostra.
+ * @param u Ponteiro para armazenar a estatística U da primeira amostra.
+ * @param exato Ponteiro para indicar se o p-valor é exato.
+ * @return p-valor bilateral.
+ */
+double testeMannWhitney(double a[], int n1, double b[], int n2, double *u, int *exato)
+{
+    int n = n1 + n2;
+    double *valores = malloc(n * sizeof(double));
+    int *origem = malloc(n * sizeof(int));
+    double *postos = malloc(n * sizeof(double));
+    int *ordem = malloc(n * sizeof(int));
+
+    if (!valores || !origem || !postos || !ordem)
+    {
+        free(valores);
+        free(origem);
+        free(postos);
+        free(ordem);
+        *u = 0.0;
+        *exato = 0;
+        return 1.0;
+    }
+
+    for (int i = 0; i < n1; i++)
+    {
+        valores[i] = a[i];
+        origem[i] = 0;
+    }
+    for (int i = 0; i < n2; i++)
+    {
+        valores[n1 + i] = b[i];
+        origem[n1 + i] = 1;
+    }
+
+    /* Ordenação por inserção dos índices (amostras pequenas) */
+    for (int i = 0; i < n; i++)
+    {
+        int atual = i;
+        int j = i;
+        while (j > 0 && valores[ordem[j - 1]] > valores[atual])
+        {
+            ordem[j] = ordem[j - 1];
+            j--;
+        }
+        ordem[j] = atual;
+    }
+
+    /* Postos médios para valores empatados */
+    double correcao_empates = 0.0;
+    for (int i = 0; i < n;)
+    {
+        int j = i;
+        while (j + 1 < n && valores[ordem[j + 1]] == valores[ordem[i]])
+            j++;
+        double posto = (i + j) / 2.0 + 1.0;
+        for (int k = i; k <= j; k++)
+            postos[ordem[k]] = posto;
+        double t = j - i + 1;
+        correcao_empates += t * t * t - t;
+        i = j + 1;
+    }
+
+    double soma_postos = 0.0;
+    for (int i = 0; i < n; i++)
+        if (origem[i] == 0)
+            soma_postos += postos[i];
+
+    *u = soma_postos - n1 * (n1 + 1) / 2.0;
+    double u_min = fmin(*u, (double)n1 * n2 - *u);
+    double p;
+
+    if (correcao_empates == 0.0 && n <= MAX_EXATO)
+    {
+        p = 2.0 * probabilidadeExataU(n1, n2, u_min);
+        *exato = 1;
+    }
+    else
+    {
+        double media = n1 * n2 / 2.0;
+        double variancia = n1 * n2 / 12.0 * ((n + 1) - correcao_empates / ((double)n * (n - 1)));
+        double z = variancia > 0.0 ? (fabs(*u - media) - 0.5) / sqrt(variancia) : 0.0;
+        if (z < 0.0)
+            z = 0.0;
+        p = erfc(z / sqrt(2.0));
+        *exato = 0;
+    }
+
+    free(valores);
+    free(origem);
+    free(postos);
+    free(ordem);
+    return p > 1.0 ? 1.0 : p;
+}
+
+/**
+ * @brief Estima a razão tempo_novo / tempo_base e seu intervalo de confiança pelo método de
+ *        Hodges-Lehmann (mediana das diferenças de log-tempos entre todos os pares),
+ *        que é o intervalo associado ao teste de Mann-Whitney.
+ * @param base Tempos da versão base.
+ * @param n1 Quantidade de tempos da versão base.
+ * @param novo Tempos da versão nova.
+ * @param n2 Quantidade de tempos da versão nova.
+ * @param alfa Nível de significância (IC de 1 - alfa).
+ * @param resultado Estrutura que recebe a razão e o intervalo.
+ * @return void
+ */
+void estimarRazao(double base[], int n1, double novo[], int n2, double alfa, ResultadoComparacao *resultado)
+{
+    int total = n1 * n2;
+    double *diferencas = malloc(total * sizeof(double));
+    if (!diferencas)
+    {
+        resultado->razao = resultado->ic_inferior = resultado->ic_superior = NAN;
+        return;
+    }
+
+    int k = 0;
+    for (int i = 0; i < n1; i++)
+        for (int j = 0; j < n2; j++)
+            diferencas[k++] = log(fmax(novo[j], 1e-9)) - log(fmax(base[i], 1e-9));
+
+    resultado->razao = exp(calcularMediana(diferencas, total));
+
+    double z = quantilNormal(1.0 - alfa / 2.0);
+    int c = (int)floor(total / 2.0 - z * sqrt(n1 * n2 * (n1 + n2 + 1) / 12.0));
+    if (c < 0)
+        c = 0;
+    if (c >= total)
+        c = total - 1;
+
+    resultado->ic_inferior = exp(diferencas[c]);
+    resultado->ic_superior = exp(diferencas[total - 1 - c]);
+
+    free(diferencas);
+}
+
+/**
+ * @brief Compara as medições de um mesmo grupo nas duas versões.
+ * @param base Grupo da versão base.
+ * @param novo Grupo da versão nova.
+ * @param alfa Nível de significância.
+ * @param resultado Estrutura que recebe o resultado da comparação.
+ * @return void
+ */
+void compararGrupos(GrupoMedicoes *base, GrupoMedicoes *novo, double alfa, ResultadoComparacao *resultado)
+{
+    resultado->p_valor = testeMannWhitney(base->tempos, base->num_tempos, novo->tempos, novo->num_tempos,
+                                          &resultado->u, &resultado->exato);
+    estimarRazao(base->tempos, base->num_tempos, novo->tempos, novo->num_tempos, alfa, resultado);
+
+    /* calcularMediana ordena o vetor; a ordem das repetições não é mais necessária aqui */
+    resultado->mediana_base = calcularMediana(base->tempos, base->num_tempos);
+    resultado->mediana_novo = calcularMediana(novo->tempos, novo->num_tempos);
+}
+
+/* ================= MAIN ================= */
+/**
+ * @brief Exibe a forma de uso do programa.
+ * @param programa Nome do executável.
+ * @return void
+ */
+void exibirUso(const char *programa)
+{
+    printf("Uso: %s <base.csv> <novo.csv> [limiar_%%] [alfa]\n", programa);
+    printf("  base.csv / novo.csv : CSVs gerais gerados pelo Teste Geral (salvarCSVGeral)\n");
+    printf("  limiar_%%            : regressao minima para falhar (padrao %.1f%%)\n", LIMIAR_PADRAO);
+    printf("  alfa                : nivel de significancia do teste (padrao %.2f)\n", ALFA_PADRAO);
+    printf("Codigos de saida: %d = sem regressao, %d = regressao significativa, %d = erro\n",
+           SAIDA_OK, SAIDA_REGRESSAO, SAIDA_ERRO);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        exibirUso(argv[0]);
+        return SAIDA_ERRO;
+    }
+
+    double limiar = argc > 3 ? atof(argv[3]) : LIMIAR_PADRAO;
+    double alfa = argc > 4 ? atof(argv[4]) : ALFA_PADRAO;
+
+    if (alfa <= 0.0 || alfa >= 1.0 || limiar < 0.0)
+    {
+        printf("ERRO: limiar deve ser >= 0 e alfa deve estar em (0, 1).\n");
+        return SAIDA_ERRO;
+    }
+
+    ConjuntoResultados base = {0}, novo = {0};
+    if (!carregarCSV(argv[1], &base) || !carregarCSV(argv[2], &novo))
+    {
+        liberarConjunto(&base);
+        liberarConjunto(&novo);
+        return SAIDA_ERRO;
+    }
+
+    printf("============================================================================================================\n");
+    printf(" COMPARACAO DE RESULTADOS (Mann-Whitney U, IC de %.0f%%, limiar de regressao %.1f%%)\n",
+           (1.0 - alfa) * 100.0, limiar);
+    printf("  base: %s%s%s%s\n", argv[1], base.variante[0] ? " (variante " : "", base.variante, base.variante[0] ? ")" : "");
+    printf("  novo: %s%s%s%s\n", argv[2], novo.variante[0] ? " (variante " : "", novo.variante, novo.variante[0] ? ")" : "");
+    compararAmbientes(&base, &novo);
+    printf("============================================================================================================\n");
+    printf("%-12s %-12s %8s %11s %11s %9s %21s %9s  %s\n",
+           "algoritmo", "cenario", "tamanho", "base (ms)", "novo (ms)", "variacao", "IC da variacao", "p-valor", "veredito");
+    printf("------------------------------------------------------------------------------------------------------------\n");
+
+    int regressoes = 0, sem_par = 0;
+
+    for (int i = 0; i < base.num_grupos; i++)
+    {
+        GrupoMedicoes *gb = &base.grupos[i];
+        GrupoMedicoes *gn = buscarGrupo(&novo, gb->algoritmo, gb->cenario, gb->tamanho, 0);
+
+        if (!gn || gb->num_tempos < 2 || gn->num_tempos < 2)
+        {
+            sem_par++;
+            continue;
+        }
+
+        ResultadoComparacao r;
+        compararGrupos(gb, gn, alfa, &r);
+
+        double variacao = (r.razao - 1.0) * 100.0;
+        int significativo = r.p_valor < alfa;
+        const char *veredito = "neutro";
+
+        if (significativo && variacao > limiar)
+        {
+            veredito = "REGRESSAO";
+            regressoes++;
+        }
+        else if (significativo && variacao > 0.0)
+            veredito = "mais lento (abaixo do limiar)";
+        else if (significativo && variacao < 0.0)
+            veredito = "melhora";
+
+        char intervalo[32];
+        snprintf(intervalo, sizeof(intervalo), "[%+.1f%%, %+.1f%%]",
+                 (r.ic_inferior - 1.0) * 100.0, (r.ic_superior - 1.0) * 100.0);
+
+        printf("%-12s %-12s %8d %11.3f %11.3f %+8.1f%% %21s %8.4f%s  %s\n",
+               gb->algoritmo, gb->cenario, gb->tamanho, r.mediana_base, r.mediana_novo,
+               variacao, intervalo, r.p_valor, r.exato ? " " : "*", veredito);
+    }
+
+    printf("------------------------------------------------------------------------------------------------------------\n");
+    printf("Tempos sao medianas das repeticoes validas (descartadas %d primeiras).\n", QTD_DESCARTES);
+    printf("Variacao = estimador de Hodges-Lehmann de tempo_novo/tempo_base; * = p-valor pela aproximacao normal.\n");
+    if (sem_par > 0)
+        printf("Aviso: %d combinacao(oes) da base sem correspondente no novo arquivo (ou com menos de 2 repeticoes).\n", sem_par);
+
+    liberarConjunto(&base);
+    liberarConjunto(&novo);
+
+    if (regressoes > 0)
+    {
+        printf("\nFALHA: %d regressao(oes) estatisticamente significativa(s) acima de %.1f%%.\n", regressoes, limiar);
+        return SAIDA_REGRESSAO;
+    }
+
+    printf("\nOK: nenhuma regressao significativa acima de %.1f%%.\n", limiar);
+    return SAIDA_OK;
+}
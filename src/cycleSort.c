@@ -4,12 +4,41 @@
 #include <time.h>
 #include <math.h>
 #include <string.h>
+#include <stdint.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#if defined(__GNUC__)
+#define SIMD_X86 1 /* Caminhos AVX2/AVX-512 compilados com target() e escolhidos em tempo de execução */
+#endif
+#endif
+#include "telemetria.h"
+#include "execucaoLonga.h"
+#include "tsc.h"
+#include "verificacao.h"
+#include "permutacao.h"
+#include "cacheResultados.h"
+#include "ambiente.h"
+#include "hierarquiaCache.h"
 
 /*  ============================ CONSTANTES ===========================*/
 #define TAM_VETOR 20000 /* Usado apenas nas opções 1-3 do menu */
 #define REPETICOES 11   /* Número total de repetições */
 #define QTD_DESCARTES 1 /* Quantidade de repetições descartadas (normalmente 1 para warm-up) */
 #define TAM_MAX 150000  /* valor máximo dos elementos do vetor */
+#define TREINO_SEMENTE 12345 /* Semente fixa do modo --treino (perfil PGO reproduzível) */
+#define TREINO_REPETICOES 2  /* Repetições de cada combinação do teste geral no modo --treino */
+#define TESTE_GERAL_SEMENTE 20240611u /* Base das sementes fixas das células do teste geral (cache de resultados) */
+#define FAIXAS_HISTOGRAMA 16 /* Faixas do histograma de comprimentos de ciclo (potências de 2) */
+#define REGISTROS_REPETICOES 3 /* Repetições (após 1 warm-up) do benchmark de registros */
+#define POUCOS_DISTINTOS 16 /* Valores distintos do cenário 4 (poucos distintos) de gerarVetor() */
+#define DUPLICATAS_REPETICOES 3 /* Repetições (após 1 warm-up) do benchmark de duplicatas */
+#define MAPA_CAPACIDADE_INICIAL 64 /* Capacidade inicial (potência de 2) do mapa de faixas por valor */
+#define HIERARQUIA_LIMITE_KB 256   /* Maior vetor padrão da hierarquia de cache: Θ(n²) limita a faixa a L1/L2 */
+#define VARIANTE_ESCALAR 0    /* Varredura de posto escalar com desvio (laço original) */
+#define VARIANTE_SEM_DESVIO 1 /* Varredura escalar somando o resultado da comparação */
+#define VARIANTE_AVX2 2       /* 8 comparações por instrução, contagem acumulada por lane */
+#define VARIANTE_AVX512 3     /* 16 comparações por instrução, contagem por popcount da máscara */
+#define NUM_VARIANTES 4
 
 /* ================= ESTRUTURAS ================= */
 typedef struct
@@ -21,8 +50,36 @@ typedef struct
     double tempo;
     long comparacoes;
     long trocas;
+    char variante[20];
 } ResultadoCSV;
 
+/* Bloco de contadores da estrutura de ciclos; faixa i do histograma: comprimentos em [2^i, 2^(i+1)) */
+typedef struct
+{
+    long ciclos_nao_triviais;
+    long histograma_ciclos[FAIXAS_HISTOGRAMA];
+    long reescaneamentos;
+    long passos_duplicatas;
+    long elementos_escaneados;
+} EstatisticasCiclos;
+
+typedef struct
+{
+    char cenario[20];
+    int tamanho;
+    int repeticao;
+    EstatisticasCiclos ciclos;
+} ResultadoCiclosCSV;
+
+/* Medições de uma célula do teste geral, no formato guardado pelo cache de resultados */
+typedef struct
+{
+    double tempos[REPETICOES];
+    long comparacoes[REPETICOES];
+    long trocas[REPETICOES];
+    EstatisticasCiclos ciclos[REPETICOES];
+} MedicaoTesteGeral;
+
 typedef struct
 {
     char cenario[20];
@@ -31,8 +88,36 @@ typedef struct
     double desvio_tempo;
     double media_comparacoes;
     double media_trocas;
+    char origem_cache[CACHE_AMBIENTE]; /* Ambiente da medição reaproveitada do cache ("" se medida agora) */
 } Estatisticas;
 
+/* Varredura de posto: quantos elementos de v[0, tamanho) são menores que item */
+typedef long (*FuncaoContagem)(const int v[], int tamanho, int item);
+typedef long (*FuncaoContagemIguais)(const int v[], int tamanho, int item, long *iguais);
+
+/* Faixa final de um valor no Cycle Sort com duplicatas: posições [lo, lo + cnt); proximo é a
+   próxima posição da faixa ainda não ocupada pelo valor (cnt == 0 marca entrada vazia do mapa) */
+typedef struct
+{
+    int valor;
+    int lo;
+    int cnt;
+    int proximo;
+} FaixaValor;
+
+/* Tabela hash de endereçamento aberto (sondagem linear) valor -> faixa */
+typedef struct
+{
+    FaixaValor *faixas;
+    int capacidade; /* Potência de 2 */
+    int usados;
+} MapaFaixas;
+
+/* ================= VARIÁVEIS GLOBAIS ================= */
+const char *nomesVariantes[NUM_VARIANTES] = {"escalar", "sem_desvio", "avx2", "avx512"};
+int varianteAtiva = VARIANTE_ESCALAR; /* Definida em selecionarVariante() no início do programa */
+int modoInterativo = 1; /* 0 nos modos de linha de comando: pausar() não espera ENTER */
+
 /* ================= FUNÇÕES AUXILIARES ================= */
 #ifdef _WIN32
 #define limpar_tela() system("cls")
@@ -46,6 +131,8 @@ typedef struct
 */
 void pausar()
 {
+    if (!modoInterativo)
+        return;
     printf("\nPressione ENTER para continuar...");
     getchar();
     getchar();
@@ -83,97 +170,459 @@ void imprimirVetor(int v[], int tamanho)
     printf("\n");
 }
 
+/**
+ * @brief Sorteia um valor aleatório, do gerador local (xorshift32) quando há estado, ou de rand().
+ *        Com estado local, a sequência depende só da semente e não altera o rand() global.
+ * @param estado Estado do gerador local (ver iniciarGerador()), ou NULL para usar rand().
+ * @return Valor entre 0 e 2^31 - 1.
+ */
+int sortear(uint32_t *estado)
+{
+    if (!estado)
+        return rand();
+
+    uint32_t x = *estado;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *estado = x;
+    return (int)(x >> 1);
+}
+
+/**
+ * @brief Inicia o estado do gerador local a partir de uma semente (o estado nunca é zero).
+ * @param semente Semente do gerador.
+ * @return Estado inicial para sortear().
+ */
+uint32_t iniciarGerador(unsigned int semente)
+{
+    uint32_t estado = (uint32_t)semente * 2654435761u + 0x9e3779b9u;
+    estado ^= estado >> 16;
+    return estado ? estado : 1u;
+}
+
 /**
  * @brief Embaralha os elementos do vetor.
  * @param v Vetor a ser embaralhado.
  * @param n Tamanho do vetor.
+ * @param estado Estado do gerador local, ou NULL para usar rand().
  * @return void 
 */
-void shuffle(int v[], int n)
+void shuffleComEstado(int v[], int n, uint32_t *estado)
 {
     for (int i = n - 1; i > 0; i--)
     {
-        int j = rand() % (i + 1);
+        int j = sortear(estado) % (i + 1);
         int temp = v[i];
         v[i] = v[j];
         v[j] = temp;
     }
 }
 
+/**
+ * @brief Embaralha os elementos do vetor (com rand()).
+ * @param v Vetor a ser embaralhado.
+ * @param n Tamanho do vetor.
+ * @return void 
+*/
+void shuffle(int v[], int n)
+{
+    shuffleComEstado(v, n, NULL);
+}
+
+/**
+ * @brief Gera um vetor aleatório com poucos valores distintos (colunas de baixa cardinalidade).
+ * @param v Vetor a ser preenchido.
+ * @param tamanho Tamanho do vetor.
+ * @param distintos Quantidade de valores distintos, espalhados em [0, TAM_MAX).
+ * @param estado Estado do gerador local, ou NULL para usar rand().
+ * @return void
+*/
+void gerarVetorPoucosDistintos(int v[], int tamanho, int distintos, uint32_t *estado)
+{
+    int passo = distintos < TAM_MAX ? TAM_MAX / distintos : 1;
+    for (int i = 0; i < tamanho; i++)
+        v[i] = (sortear(estado) % distintos) * passo;
+}
+
 /**
  * @brief Gera um vetor com elementos em ordem crescente, decrescente ou aleatória.
  * @param v Vetor a ser preenchido.
- * @param tipo Tipo de vetor: 1 - crescente, 2 - decrescente, 3 - aleatório.
+ * @param tipo Tipo de vetor: 1 - crescente, 2 - decrescente, 3 - aleatório, 4 - poucos distintos.
  * @param tamanho Tamanho do vetor.
+ * @param estado Estado do gerador local, ou NULL para usar rand().
  * @return void
 */
-void gerarVetor(int v[], int tipo, int tamanho)
+void gerarVetorComEstado(int v[], int tipo, int tamanho, uint32_t *estado)
 {
     if (tipo == 1)
     { /* CRESCENTE */
-        int valor = rand() % (TAM_MAX / 10);
+        int valor = sortear(estado) % (TAM_MAX / 10);
         for (int i = 0; i < tamanho; i++)
         {
             v[i] = valor;
-            int incremento = 1 + (rand() % (TAM_MAX / tamanho));
+            int incremento = 1 + (sortear(estado) % (TAM_MAX / tamanho));
             valor += incremento;
             if (valor > TAM_MAX)
-                valor = TAM_MAX - (rand() % (TAM_MAX / 10));
+                valor = TAM_MAX - (sortear(estado) % (TAM_MAX / 10));
         }
     }
     else if (tipo == 2)
     { /* DECRESCENTE */
-        int valor = TAM_MAX - (rand() % (TAM_MAX / 10));
+        int valor = TAM_MAX - (sortear(estado) % (TAM_MAX / 10));
         for (int i = 0; i < tamanho; i++)
         {
             v[i] = valor;
-            int decremento = 1 + (rand() % (TAM_MAX / tamanho));
+            int decremento = 1 + (sortear(estado) % (TAM_MAX / tamanho));
             valor -= decremento;
             if (valor < 0)
-                valor = rand() % (TAM_MAX / 10);
+                valor = sortear(estado) % (TAM_MAX / 10);
         }
     }
     else if (tipo == 3)
     { /* ALEATÓRIO */
         for (int i = 0; i < tamanho; i++)
-            v[i] = rand() % TAM_MAX;
-        shuffle(v, tamanho);
+            v[i] = sortear(estado) % TAM_MAX;
+        shuffleComEstado(v, tamanho, estado);
+    }
+    else if (tipo == 4)
+    { /* POUCOS DISTINTOS */
+        gerarVetorPoucosDistintos(v, tamanho, POUCOS_DISTINTOS, estado);
     }
 }
 
 /**
- * @brief Implementa o algoritmo Cycle Sort para ordenar um vetor.
+ * @brief Gera um vetor com elementos em ordem crescente, decrescente ou aleatória (com rand()).
+ * @param v Vetor a ser preenchido.
+ * @param tipo Tipo de vetor: 1 - crescente, 2 - decrescente, 3 - aleatório, 4 - poucos distintos.
+ * @param tamanho Tamanho do vetor.
+ * @return void
+*/
+void gerarVetor(int v[], int tipo, int tamanho)
+{
+    gerarVetorComEstado(v, tipo, tamanho, NULL);
+}
+
+/**
+ * @brief Retorna a faixa do histograma (piso de log2) de um comprimento de ciclo.
+ * @param comprimento Comprimento do ciclo (número de elementos posicionados).
+ * @return Índice da faixa, limitado a FAIXAS_HISTOGRAMA - 1.
+ */
+int faixaHistograma(long comprimento)
+{
+    int faixa = 0;
+    while (comprimento > 1 && faixa < FAIXAS_HISTOGRAMA - 1)
+    {
+        comprimento >>= 1;
+        faixa++;
+    }
+    return faixa;
+}
+
+/* ================= VARIANTES DA VARREDURA DE POSTO ================= */
+/**
+ * @brief Conta os elementos menores que item, versão escalar com desvio (laço original).
+ * @param v Trecho a varrer.
+ * @param tamanho Quantidade de elementos do trecho.
+ * @param item Elemento cuja posição está sendo calculada.
+ * @return Quantidade de elementos menores que item.
+ */
+long contarMenoresEscalar(const int v[], int tamanho, int item)
+{
+    long menores = 0;
+    for (int j = 0; j < tamanho; j++)
+    {
+        if (v[j] < item)
+        {
+            menores++;
+        }
+    }
+    return menores;
+}
+
+/**
+ * @brief Conta os elementos menores que item somando o resultado de cada comparação (sem desvio).
+ */
+long contarMenoresSemDesvio(const int v[], int tamanho, int item)
+{
+    long menores = 0;
+    for (int j = 0; j < tamanho; j++)
+        menores += v[j] < item;
+    return menores;
+}
+
+#ifdef SIMD_X86
+/**
+ * @brief Conta os elementos menores que item com AVX2: cada cmpgt produz -1 nas lanes menores,
+ *        subtraído de um acumulador por lane; a soma horizontal é feita uma vez no final.
+ */
+__attribute__((target("avx2"))) long contarMenoresAVX2(const int v[], int tamanho, int item)
+{
+    __m256i alvo = _mm256_set1_epi32(item);
+    __m256i acumulado = _mm256_setzero_si256();
+    int j = 0;
+
+    for (; j + 8 <= tamanho; j += 8)
+    {
+        __m256i bloco = _mm256_loadu_si256((const __m256i *)&v[j]);
+        acumulado = _mm256_sub_epi32(acumulado, _mm256_cmpgt_epi32(alvo, bloco));
+    }
+
+    int parciais[8];
+    _mm256_storeu_si256((__m256i *)parciais, acumulado);
+    long menores = 0;
+    for (int k = 0; k < 8; k++)
+        menores += parciais[k];
+    for (; j < tamanho; j++)
+        menores += v[j] < item;
+    return menores;
+}
+
+/**
+ * @brief Conta os elementos menores que item com AVX-512: popcount da máscara de comparação.
+ */
+__attribute__((target("avx512f"))) long contarMenoresAVX512(const int v[], int tamanho, int item)
+{
+    __m512i alvo = _mm512_set1_epi32(item);
+    long menores = 0;
+    int j = 0;
+
+    for (; j + 16 <= tamanho; j += 16)
+        menores += __builtin_popcount(_mm512_cmplt_epi32_mask(_mm512_loadu_si512(&v[j]), alvo));
+
+    if (j < tamanho)
+    {
+        __mmask16 resto = (__mmask16)((1u << (tamanho - j)) - 1);
+        __m512i bloco = _mm512_maskz_loadu_epi32(resto, &v[j]);
+        menores += __builtin_popcount(_mm512_mask_cmplt_epi32_mask(resto, bloco, alvo));
+    }
+    return menores;
+}
+#endif
+
+/* Tabela de despacho, indexada por VARIANTE_* */
+const FuncaoContagem contagensMenores[NUM_VARIANTES] = {
+    contarMenoresEscalar,
+    contarMenoresSemDesvio,
+#ifdef SIMD_X86
+    contarMenoresAVX2,
+    contarMenoresAVX512,
+#else
+    NULL,
+    NULL,
+#endif
+};
+
+/* ================= VARREDURA DE POSTO COM CONTAGEM DE IGUAIS ================= */
+/**
+ * @brief Conta, numa única varredura, os elementos menores que item e os iguais a item (escalar).
+ * @param iguais Recebe a quantidade de elementos iguais a item.
+ * @return Quantidade de elementos menores que item.
+ */
+long contarMenoresIguaisEscalar(const int v[], int tamanho, int item, long *iguais)
+{
+    long menores = 0;
+    *iguais = 0;
+    for (int j = 0; j < tamanho; j++)
+    {
+        if (v[j] < item)
+            menores++;
+        else if (v[j] == item)
+            (*iguais)++;
+    }
+    return menores;
+}
+
+long contarMenoresIguaisSemDesvio(const int v[], int tamanho, int item, long *iguais)
+{
+    long menores = 0, iguais_local = 0;
+    for (int j = 0; j < tamanho; j++)
+    {
+        menores += v[j] < item;
+        iguais_local += v[j] == item;
+    }
+    *iguais = iguais_local;
+    return menores;
+}
+
+#ifdef SIMD_X86
+/**
+ * @brief Versão AVX2: dois acumuladores por lane (cmpgt e cmpeq) sobre o mesmo bloco carregado.
+ */
+__attribute__((target("avx2"))) long contarMenoresIguaisAVX2(const int v[], int tamanho, int item, long *iguais)
+{
+    __m256i alvo = _mm256_set1_epi32(item);
+    __m256i acumulado_menores = _mm256_setzero_si256();
+    __m256i acumulado_iguais = _mm256_setzero_si256();
+    int j = 0;
+
+    for (; j + 8 <= tamanho; j += 8)
+    {
+        __m256i bloco = _mm256_loadu_si256((const __m256i *)&v[j]);
+        acumulado_menores = _mm256_sub_epi32(acumulado_menores, _mm256_cmpgt_epi32(alvo, bloco));
+        acumulado_iguais = _mm256_sub_epi32(acumulado_iguais, _mm256_cmpeq_epi32(alvo, bloco));
+    }
+
+    int parciais_menores[8], parciais_iguais[8];
+    _mm256_storeu_si256((__m256i *)parciais_menores, acumulado_menores);
+    _mm256_storeu_si256((__m256i *)parciais_iguais, acumulado_iguais);
+    long menores = 0, iguais_local = 0;
+    for (int k = 0; k < 8; k++)
+    {
+        menores += parciais_menores[k];
+        iguais_local += parciais_iguais[k];
+    }
+    for (; j < tamanho; j++)
+    {
+        menores += v[j] < item;
+        iguais_local += v[j] == item;
+    }
+    *iguais = iguais_local;
+    return menores;
+}
+
+/**
+ * @brief Versão AVX-512: popcount das máscaras cmplt e cmpeq do mesmo bloco.
+ */
+__attribute__((target("avx512f"))) long contarMenoresIguaisAVX512(const int v[], int tamanho, int item, long *iguais)
+{
+    __m512i alvo = _mm512_set1_epi32(item);
+    long menores = 0, iguais_local = 0;
+    int j = 0;
+
+    for (; j + 16 <= tamanho; j += 16)
+    {
+        __m512i bloco = _mm512_loadu_si512(&v[j]);
+        menores += __builtin_popcount(_mm512_cmplt_epi32_mask(bloco, alvo));
+        iguais_local += __builtin_popcount(_mm512_cmpeq_epi32_mask(bloco, alvo));
+    }
+
+    if (j < tamanho)
+    {
+        __mmask16 resto = (__mmask16)((1u << (tamanho - j)) - 1);
+        __m512i bloco = _mm512_maskz_loadu_epi32(resto, &v[j]);
+        menores += __builtin_popcount(_mm512_mask_cmplt_epi32_mask(resto, bloco, alvo));
+        iguais_local += __builtin_popcount(_mm512_mask_cmpeq_epi32_mask(resto, bloco, alvo));
+    }
+    *iguais = iguais_local;
+    return menores;
+}
+#endif
+
+/* Tabela de despacho, indexada por VARIANTE_* */
+const FuncaoContagemIguais contagensMenoresIguais[NUM_VARIANTES] = {
+    contarMenoresIguaisEscalar,
+    contarMenoresIguaisSemDesvio,
+#ifdef SIMD_X86
+    contarMenoresIguaisAVX2,
+    contarMenoresIguaisAVX512,
+#else
+    NULL,
+    NULL,
+#endif
+};
+
+/**
+ * @brief Indica se a CPU atual executa a variante (CPUID via __builtin_cpu_supports).
+ * @param variante Uma das constantes VARIANTE_*.
+ * @return 1 se suportada, 0 caso contrário.
+ */
+int varianteSuportada(int variante)
+{
+    if (variante == VARIANTE_ESCALAR || variante == VARIANTE_SEM_DESVIO)
+        return 1;
+#ifdef SIMD_X86
+    if (variante == VARIANTE_AVX2)
+        return __builtin_cpu_supports("avx2");
+    if (variante == VARIANTE_AVX512)
+        return __builtin_cpu_supports("avx512f");
+#endif
+    return 0;
+}
+
+/**
+ * @brief Variante mais larga suportada pela CPU (usada com ORDENACAO_VARIANTE=auto).
+ */
+int varianteMaisLarga()
+{
+    for (int k = VARIANTE_AVX512; k >= VARIANTE_AVX2; k--)
+        if (varianteSuportada(k))
+            return k;
+    return VARIANTE_SEM_DESVIO;
+}
+
+/**
+ * @brief Escolhe a variante dos kernels no início do programa: a escalar (mesmo laço dos resultados
+ *        de referência) ou a indicada na variável de ambiente ORDENACAO_VARIANTE (escalar, sem_desvio,
+ *        avx2, avx512 ou auto, a mais larga suportada pela CPU).
+ *        Uma variante forçada que a CPU não suporta é recusada com aviso.
+ * @return void
+ */
+void selecionarVariante()
+{
+    varianteAtiva = VARIANTE_ESCALAR;
+
+    const char *forcada = getenv("ORDENACAO_VARIANTE");
+    if (!forcada || !*forcada)
+        return;
+
+    if (strcmp(forcada, "auto") == 0)
+    {
+        varianteAtiva = varianteMaisLarga();
+        return;
+    }
+
+    for (int k = 0; k < NUM_VARIANTES; k++)
+    {
+        if (strcmp(forcada, nomesVariantes[k]) == 0)
+        {
+            if (varianteSuportada(k))
+                varianteAtiva = k;
+            else
+                printf("AVISO: variante '%s' nao suportada por esta CPU; usando '%s'.\n",
+                       forcada, nomesVariantes[varianteAtiva]);
+            return;
+        }
+    }
+    printf("AVISO: variante desconhecida '%s' em ORDENACAO_VARIANTE; usando '%s'.\n",
+           forcada, nomesVariantes[varianteAtiva]);
+}
+
+/**
+ * @brief Implementa o Cycle Sort registrando a estrutura dos ciclos percorridos.
+ *        Os contadores são atualizados uma vez por varredura ou por escrita (nunca por
+ *        elemento varrido), de modo que podem ficar sempre ligados.
  * @param v Vetor a ser ordenado.
  * @param tamanho Tamanho do vetor.
  * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
  * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ * @param ciclos Ponteiro para o bloco de contadores da estrutura de ciclos.
  * @return void
  */
-void cycleSort(int v[], int tamanho, long *comparacoes, long *trocas)
+void cycleSortInstrumentado(int v[], int tamanho, long *comparacoes, long *trocas, EstatisticasCiclos *ciclos)
 {
+    FuncaoContagem contarMenores = contagensMenores[varianteAtiva];
     *comparacoes = 0;
     *trocas = 0;
+    memset(ciclos, 0, sizeof(EstatisticasCiclos));
 
     for (int ciclo_inicio = 0; ciclo_inicio < tamanho - 1; ciclo_inicio++)
     {
         int item = v[ciclo_inicio];
-        int pos = ciclo_inicio;
-
-        for (int j = ciclo_inicio + 1; j < tamanho; j++)
-        {
-            (*comparacoes)++;
-            if (v[j] < item)
-            {
-                pos++;
-            }
-        }
+        int restantes = tamanho - ciclo_inicio - 1;
+        int pos = ciclo_inicio + contarMenores(&v[ciclo_inicio + 1], restantes, item);
+        *comparacoes += restantes;
+        ciclos->elementos_escaneados += restantes;
 
         if (pos != ciclo_inicio)
         {
+            long comprimento = 1;
+
             while (item == v[pos])
             {
                 pos++;
                 (*comparacoes)++;
+                ciclos->passos_duplicatas++;
             }
 
             int temp = v[pos];
@@ -183,30 +632,363 @@ void cycleSort(int v[], int tamanho, long *comparacoes, long *trocas)
 
             while (pos != ciclo_inicio)
             {
-                pos = ciclo_inicio;
-
-                for (int j = ciclo_inicio + 1; j < tamanho; j++)
-                {
-                    (*comparacoes)++;
-                    if (v[j] < item)
-                    {
-                        pos++;
-                    }
-                }
+                pos = ciclo_inicio + contarMenores(&v[ciclo_inicio + 1], restantes, item);
+                *comparacoes += restantes;
+                ciclos->reescaneamentos++;
+                ciclos->elementos_escaneados += restantes;
 
                 while (pos < tamanho && item == v[pos])
                 {
                     pos++;
                     (*comparacoes)++;
+                    ciclos->passos_duplicatas++;
                 }
 
                 temp = v[pos];
                 v[pos] = item;
                 item = temp;
                 (*trocas)++;
+                comprimento++;
             }
+
+            ciclos->ciclos_nao_triviais++;
+            ciclos->histograma_ciclos[faixaHistograma(comprimento)]++;
+        }
+    }
+}
+
+/**
+ * @brief Implementa o algoritmo Cycle Sort para ordenar um vetor.
+ * @param v Vetor a ser ordenado.
+ * @param tamanho Tamanho do vetor.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ * @return void
+ */
+void cycleSort(int v[], int tamanho, long *comparacoes, long *trocas)
+{
+    EstatisticasCiclos ciclos;
+    cycleSortInstrumentado(v, tamanho, comparacoes, trocas, &ciclos);
+}
+
+/* ================= CYCLE SORT COM DUPLICATAS ================= */
+/**
+ * @brief Espalhamento de um valor no mapa de faixas (finalizador do MurmurHash3).
+ */
+static inline unsigned int posicaoMapa(const MapaFaixas *mapa, int valor)
+{
+    return hashMistura32((unsigned int)valor) & (unsigned int)(mapa->capacidade - 1);
+}
+
+/**
+ * @brief Aloca o mapa de faixas com a capacidade (potência de 2) indicada.
+ * @return 1 em caso de sucesso, 0 se a alocação falhar.
+ */
+int mapaIniciar(MapaFaixas *mapa, int capacidade)
+{
+    mapa->faixas = calloc(capacidade, sizeof(FaixaValor));
+    mapa->capacidade = capacidade;
+    mapa->usados = 0;
+    return mapa->faixas != NULL;
+}
+
+/**
+ * @brief Dobra a capacidade do mapa, reinserindo as faixas existentes.
+ * @return 1 em caso de sucesso, 0 se a alocação falhar (o mapa antigo continua válido).
+ */
+int mapaCrescer(MapaFaixas *mapa)
+{
+    MapaFaixas novo;
+    if (!mapaIniciar(&novo, mapa->capacidade * 2))
+        return 0;
+
+    for (int i = 0; i < mapa->capacidade; i++)
+    {
+        if (mapa->faixas[i].cnt == 0)
+            continue;
+        unsigned int k = posicaoMapa(&novo, mapa->faixas[i].valor);
+        while (novo.faixas[k].cnt != 0)
+            k = (k + 1) & (unsigned int)(novo.capacidade - 1);
+        novo.faixas[k] = mapa->faixas[i];
+    }
+    novo.usados = mapa->usados;
+    free(mapa->faixas);
+    *mapa = novo;
+    return 1;
+}
+
+/**
+ * @brief Faixa final do valor item. Na primeira vez em que o valor aparece, uma única varredura
+ *        do sufixo ainda não posicionado conta os menores e os iguais: como as posições anteriores
+ *        a ciclo_inicio já são finais e nenhuma delas guarda item (senão o valor já estaria no
+ *        mapa), a faixa é [ciclo_inicio + menores, ciclo_inicio + menores + iguais + 1).
+ * @param reescaneamento 1 se a varredura acontece dentro de um ciclo (contador de reescaneamentos).
+ * @return Faixa do valor, ou NULL se o mapa não puder crescer.
+ */
+FaixaValor *faixaDoValor(MapaFaixas *mapa, FuncaoContagemIguais contar, const int v[], int tamanho,
+                         int ciclo_inicio, int item, int reescaneamento, long *comparacoes,
+                         EstatisticasCiclos *ciclos)
+{
+    unsigned int k = posicaoMapa(mapa, item);
+    while (mapa->faixas[k].cnt != 0)
+    {
+        if (mapa->faixas[k].valor == item)
+            return &mapa->faixas[k];
+        k = (k + 1) & (unsigned int)(mapa->capacidade - 1);
+    }
+
+    /* Carga máxima de 1/2: mantém as sondagens curtas */
+    if (2 * (mapa->usados + 1) > mapa->capacidade)
+    {
+        if (!mapaCrescer(mapa))
+            return NULL;
+        k = posicaoMapa(mapa, item);
+        while (mapa->faixas[k].cnt != 0)
+            k = (k + 1) & (unsigned int)(mapa->capacidade - 1);
+    }
+
+    int restantes = tamanho - ciclo_inicio - 1;
+    long iguais;
+    long menores = contar(&v[ciclo_inicio + 1], restantes, item, &iguais);
+    *comparacoes += restantes;
+    ciclos->elementos_escaneados += restantes;
+    if (reescaneamento)
+        ciclos->reescaneamentos++;
+
+    FaixaValor *faixa = &mapa->faixas[k];
+    faixa->valor = item;
+    faixa->lo = ciclo_inicio + (int)menores;
+    faixa->cnt = (int)iguais + 1;
+    faixa->proximo = faixa->lo;
+    mapa->usados++;
+    return faixa;
+}
+
+/**
+ * @brief Cycle Sort para entradas com muitas chaves repetidas. Cada valor distinto custa uma única
+ *        varredura (menores e iguais contados juntos, na variante vetorial ativa); as demais
+ *        ocorrências vão direto para a próxima posição livre da faixa do valor, sem reescanear o
+ *        sufixo. O avanço de proximo sobre posições que já guardam o valor é amortizado: cada
+ *        posição é percorrida no máximo uma vez. O custo total fica em O(n·k) para k valores
+ *        distintos, contra O(n²) varreduras mais as caminhadas sobre iguais do cycleSort().
+ *        Como no cycleSort(), cada elemento é escrito no máximo uma vez.
+ * @param v Vetor a ser ordenado.
+ * @param tamanho Tamanho do vetor.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas (escritas) realizadas.
+ * @param ciclos Ponteiro para o bloco de contadores da estrutura de ciclos.
+ * @return void
+ */
+void cycleSortDuplicatasInstrumentado(int v[], int tamanho, long *comparacoes, long *trocas,
+                                      EstatisticasCiclos *ciclos)
+{
+    FuncaoContagemIguais contar = contagensMenoresIguais[varianteAtiva];
+    MapaFaixas mapa;
+    *comparacoes = 0;
+    *trocas = 0;
+    memset(ciclos, 0, sizeof(EstatisticasCiclos));
+
+    /* Sem memória para o mapa, o cycleSort() clássico ordena o vetor; se o mapa não puder crescer
+       durante a ordenação, o clássico continua de onde parou (qualquer permutação é entrada válida) */
+    if (!mapaIniciar(&mapa, MAPA_CAPACIDADE_INICIAL))
+    {
+        cycleSortInstrumentado(v, tamanho, comparacoes, trocas, ciclos);
+        return;
+    }
+
+    int falhou = 0;
+    for (int ciclo_inicio = 0; ciclo_inicio < tamanho - 1 && !falhou; ciclo_inicio++)
+    {
+        int item = v[ciclo_inicio];
+        FaixaValor *faixa = faixaDoValor(&mapa, contar, v, tamanho, ciclo_inicio, item, 0, comparacoes, ciclos);
+        if (!faixa)
+        {
+            falhou = 1;
+            break;
+        }
+
+        /* Qualquer ocorrência do valor dentro da sua faixa já está na posição final */
+        if (ciclo_inicio >= faixa->lo && ciclo_inicio < faixa->lo + faixa->cnt)
+            continue;
+
+        long comprimento = 0;
+        while (faixa)
+        {
+            while (v[faixa->proximo] == item)
+            {
+                faixa->proximo++;
+                (*comparacoes)++;
+                ciclos->passos_duplicatas++;
+            }
+
+            int pos = faixa->proximo++;
+            int temp = v[pos];
+            v[pos] = item;
+            item = temp;
+            (*trocas)++;
+            comprimento++;
+
+            if (pos == ciclo_inicio)
+                break;
+            faixa = faixaDoValor(&mapa, contar, v, tamanho, ciclo_inicio, item, 1, comparacoes, ciclos);
+        }
+
+        if (!faixa)
+        {
+            /* Falha de alocação no meio de um ciclo: o elemento em mãos volta para ciclo_inicio,
+               cujo valor original já foi escrito, e o vetor volta a ser uma permutação da entrada */
+            v[ciclo_inicio] = item;
+            falhou = 1;
+            break;
+        }
+
+        ciclos->ciclos_nao_triviais++;
+        ciclos->histograma_ciclos[faixaHistograma(comprimento)]++;
+    }
+
+    free(mapa.faixas);
+
+    if (falhou)
+    {
+        long comparacoes_classico, trocas_classico;
+        EstatisticasCiclos ciclos_classico;
+        cycleSortInstrumentado(v, tamanho, &comparacoes_classico, &trocas_classico, &ciclos_classico);
+        *comparacoes += comparacoes_classico;
+        *trocas += trocas_classico;
+        ciclos->ciclos_nao_triviais += ciclos_classico.ciclos_nao_triviais;
+    }
+}
+
+/* ================= ORDENAÇÃO INDIRETA (ARGSORT) ================= */
+/**
+ * @brief Cycle Sort indireto: calcula a permutação que ordena as chaves, sem mover as chaves.
+ *        Cada par (chave, índice) é empacotado em um inteiro de 64 bits (chave na parte alta),
+ *        de modo que a varredura de posição é contígua e usa uma única comparação sem desvio.
+ *        Como os pares são distintos, os laços de salto de duplicatas não são necessários.
+ * @param chaves Vetor de chaves (não é modificado).
+ * @param indices Vetor que recebe a permutação ordenada (chaves[indices[0]] <= chaves[indices[1]] <= ...).
+ * @param tamanho Tamanho dos vetores.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ * @return 1 em caso de sucesso, 0 se faltar memória (indices não é preenchido).
+ */
+int cycleSortIndices(const int chaves[], int indices[], int tamanho, long *comparacoes, long *trocas)
+{
+    long long *pares = malloc(tamanho * sizeof(long long));
+
+    *comparacoes = 0;
+    *trocas = 0;
+    if (!pares)
+    {
+        printf("Erro ao alocar pares chave/indice!\n");
+        return 0;
+    }
+
+    for (int i = 0; i < tamanho; i++)
+        pares[i] = (long long)chaves[i] * 4294967296LL + i;
+
+    for (int ciclo_inicio = 0; ciclo_inicio < tamanho - 1; ciclo_inicio++)
+    {
+        long long item = pares[ciclo_inicio];
+        int pos;
+
+        do
+        {
+            pos = ciclo_inicio;
+            for (int j = ciclo_inicio + 1; j < tamanho; j++)
+                pos += pares[j] < item;
+            *comparacoes += tamanho - ciclo_inicio - 1;
+
+            if (pos != ciclo_inicio)
+            {
+                long long temp = pares[pos];
+                pares[pos] = item;
+                item = temp;
+                (*trocas)++;
+            }
+        } while (pos != ciclo_inicio);
+
+        pares[ciclo_inicio] = item;
+    }
+
+    for (int i = 0; i < tamanho; i++)
+        indices[i] = (int)(pares[i] & 0xFFFFFFFFLL);
+
+    free(pares);
+    return 1;
+}
+
+/**
+ * @brief Cycle Sort direto sobre registros de tam_registro bytes com a chave (int) no início.
+ *        As varreduras de posição leem a chave de cada registro (acesso com passo tam_registro).
+ * @param registros Registros armazenados de forma contígua.
+ * @param tam_registro Tamanho de cada registro em bytes (múltiplo de sizeof(int)).
+ * @param tamanho Quantidade de registros.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas (registros escritos).
+ * @return void
+ */
+void cycleSortRegistros(void *registros, size_t tam_registro, int tamanho, long *comparacoes, long *trocas)
+{
+    char *base = registros;
+    char *item = malloc(tam_registro);
+    char *temp = malloc(tam_registro);
+
+    *comparacoes = 0;
+    *trocas = 0;
+    if (!item || !temp)
+    {
+        printf("Erro ao alocar registros auxiliares!\n");
+        free(item);
+        free(temp);
+        return;
+    }
+
+    for (int ciclo_inicio = 0; ciclo_inicio < tamanho - 1; ciclo_inicio++)
+    {
+        memcpy(item, base + (size_t)ciclo_inicio * tam_registro, tam_registro);
+        int chave = *(const int *)item;
+        int pos = ciclo_inicio;
+
+        for (int j = ciclo_inicio + 1; j < tamanho; j++)
+        {
+            (*comparacoes)++;
+            if (CHAVE_REGISTRO(base, tam_registro, j) < chave)
+                pos++;
         }
+
+        if (pos == ciclo_inicio)
+            continue;
+
+        while (pos != ciclo_inicio)
+        {
+            while (pos < tamanho && chave == CHAVE_REGISTRO(base, tam_registro, pos))
+            {
+                pos++;
+                (*comparacoes)++;
+            }
+
+            memcpy(temp, base + (size_t)pos * tam_registro, tam_registro);
+            memcpy(base + (size_t)pos * tam_registro, item, tam_registro);
+            memcpy(item, temp, tam_registro);
+            chave = *(const int *)item;
+            (*trocas)++;
+
+            pos = ciclo_inicio;
+            for (int j = ciclo_inicio + 1; j < tamanho; j++)
+            {
+                (*comparacoes)++;
+                if (CHAVE_REGISTRO(base, tam_registro, j) < chave)
+                    pos++;
+            }
+        }
+
+        memcpy(base + (size_t)ciclo_inicio * tam_registro, item, tam_registro);
+        (*trocas)++;
     }
+
+    free(item);
+    free(temp);
 }
 
 /**
@@ -291,33 +1073,83 @@ void salvarCSVGeral(ResultadoCSV resultados[], int num_resultados, Estatisticas
         printf("Erro ao criar o arquivo CSV.\n");
         return;
     }
+    ambienteCabecalho(csv);
+    for (int i = 0; i < num_estatisticas; i++)
+        cacheCabecalhoReaproveitada(csv, "Cycle Sort", estatisticas[i].cenario, estatisticas[i].tamanho,
+                                    estatisticas[i].origem_cache);
 
-    fprintf(csv, "algoritmo;cenario;tamanho;repeticao;tempo_ms;comparacoes;trocas\n");
+    fprintf(csv, "algoritmo;cenario;tamanho;repeticao;tempo_ms;comparacoes;trocas;variante\n");
 
     for (int i = 0; i < num_resultados; i++)
     {
-        fprintf(csv, "%s;%s;%d;%d;%.3f;%ld;%ld\n",
+        fprintf(csv, "%s;%s;%d;%d;%.3f;%ld;%ld;%s\n",
                 resultados[i].algoritmo, resultados[i].cenario,
                 resultados[i].tamanho, resultados[i].repeticao,
                 resultados[i].tempo, resultados[i].comparacoes,
-                resultados[i].trocas);
+                resultados[i].trocas, resultados[i].variante);
     }
 
     fprintf(csv, "\nESTATISTICAS (descartadas as %d primeiras repeticoes)\n", QTD_DESCARTES);
-    fprintf(csv, "algoritmo;cenario;tamanho;media_tempo_ms;desvio_tempo_ms;media_comparacoes;media_trocas\n");
+    fprintf(csv, "algoritmo;cenario;tamanho;media_tempo_ms;desvio_tempo_ms;media_comparacoes;media_trocas;variante\n");
 
     for (int i = 0; i < num_estatisticas; i++)
     {
-        fprintf(csv, "Cycle Sort;%s;%d;%.3f;%.3f;%.2f;%.2f\n",
+        fprintf(csv, "Cycle Sort;%s;%d;%.3f;%.3f;%.2f;%.2f;%s\n",
                 estatisticas[i].cenario, estatisticas[i].tamanho,
                 estatisticas[i].media_tempo, estatisticas[i].desvio_tempo,
-                estatisticas[i].media_comparacoes, estatisticas[i].media_trocas);
+                estatisticas[i].media_comparacoes, estatisticas[i].media_trocas,
+                nomesVariantes[varianteAtiva]);
     }
 
     fclose(csv);
     printf("\nCSV geral salvo em: %s\n", nomeCSV);
 }
 
+/**
+ * @brief Salva o bloco de contadores de ciclos de todas as execuções em um arquivo CSV separado.
+ * @param resultados Vetor de contadores por execução.
+ * @param num_resultados Número de execuções registradas.
+ * @return void
+ */
+void salvarCSVCiclos(ResultadoCiclosCSV resultados[], int num_resultados)
+{
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/cycleSort/cyclesort_ciclos_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV de ciclos.\n");
+        return;
+    }
+    ambienteCabecalho(csv);
+
+    fprintf(csv, "algoritmo;cenario;tamanho;repeticao;ciclos_nao_triviais;reescaneamentos;passos_duplicatas;elementos_escaneados");
+    for (int f = 0; f < FAIXAS_HISTOGRAMA; f++)
+        fprintf(csv, ";ciclos_%ld_%ld", 1L << f, (1L << (f + 1)) - 1);
+    fprintf(csv, ";variante\n");
+
+    for (int i = 0; i < num_resultados; i++)
+    {
+        EstatisticasCiclos *c = &resultados[i].ciclos;
+        fprintf(csv, "Cycle Sort;%s;%d;%d;%ld;%ld;%ld;%ld",
+                resultados[i].cenario, resultados[i].tamanho, resultados[i].repeticao,
+                c->ciclos_nao_triviais, c->reescaneamentos, c->passos_duplicatas,
+                c->elementos_escaneados);
+        for (int f = 0; f < FAIXAS_HISTOGRAMA; f++)
+            fprintf(csv, ";%ld", c->histograma_ciclos[f]);
+        fprintf(csv, ";%s\n", nomesVariantes[varianteAtiva]);
+    }
+
+    fclose(csv);
+    printf("CSV de ciclos salvo em: %s\n", nomeCSV);
+}
+
 /**
  * @brief Salva os resultados detalhados de um experimento em um arquivo TXT.
  * @param tipo Tipo de vetor (crescente, decrescente, aleatório).
@@ -325,14 +1157,17 @@ void salvarCSVGeral(ResultadoCSV resultados[], int num_resultados, Estatisticas
  * @param tempos Vetor de tempos de execução.
  * @param comparacoes Vetor de números de comparações.
  * @param trocas Vetor de números de trocas.
+ * @param ciclos Vetor com os contadores de estrutura de ciclos de cada execução.
  * @param mediaTempo Média dos tempos de execução.
  * @param desvioTempo Desvio padrão dos tempos de execução.
  * @param mediaComparacoes Média dos números de comparações.
  * @param mediaTrocas Média dos números de trocas.
+ * @param origem_cache Ambiente da medição, se reaproveitada do cache (NULL ou "" se medida agora).
  * @return void
  */
 void salvarResultados(char tipo[], int tamanho, double tempos[], long comparacoes[], long trocas[],
-                      double mediaTempo, double desvioTempo, double mediaComparacoes, double mediaTrocas)
+                      EstatisticasCiclos ciclos[], double mediaTempo, double desvioTempo, double mediaComparacoes, double mediaTrocas,
+                      const char *origem_cache)
 {
     time_t agora = time(NULL);
     struct tm *info = localtime(&agora);
@@ -348,6 +1183,8 @@ void salvarResultados(char tipo[], int tamanho, double tempos[], long comparacoe
         printf("Erro ao criar o arquivo TXT.\n");
         return;
     }
+    ambienteCabecalho(arquivo);
+    cacheCabecalhoReaproveitada(arquivo, "Cycle Sort", tipo, tamanho, origem_cache);
 
     fprintf(arquivo, "============================================================\n");
     fprintf(arquivo, "                      CYCLE SORT                            \n");
@@ -357,7 +1194,8 @@ void salvarResultados(char tipo[], int tamanho, double tempos[], long comparacoe
     fprintf(arquivo, "Tamanho do vetor : %d\n", tamanho);
     fprintf(arquivo, "Repeticoes       : %d (descartadas %d primeiras)\n", REPETICOES, QTD_DESCARTES);
     fprintf(arquivo, "Repeticoes validas: %d\n", REPETICOES - QTD_DESCARTES);
-    fprintf(arquivo, "Tipo de vetor    : %s\n\n", tipo);
+    fprintf(arquivo, "Tipo de vetor    : %s\n", tipo);
+    fprintf(arquivo, "Variante         : %s\n\n", nomesVariantes[varianteAtiva]);
     fprintf(arquivo, "Resultados individuais:\n");
     fprintf(arquivo, "------------------------------------------------------------\n");
 
@@ -371,7 +1209,9 @@ void salvarResultados(char tipo[], int tamanho, double tempos[], long comparacoe
         fprintf(arquivo, "\n");
         fprintf(arquivo, "  Tempo        : %8.3f ms\n", tempos[i]);
         fprintf(arquivo, "  Comparacoes  : %8ld\n", comparacoes[i]);
-        fprintf(arquivo, "  Trocas       : %8ld\n\n", trocas[i]);
+        fprintf(arquivo, "  Trocas       : %8ld\n", trocas[i]);
+        fprintf(arquivo, "  Ciclos       : %8ld (reescaneamentos: %ld)\n\n",
+                ciclos[i].ciclos_nao_triviais, ciclos[i].reescaneamentos);
     }
 
     fprintf(arquivo, "Resumo estatistico (descartadas %d primeiras execucoes):\n", QTD_DESCARTES);
@@ -379,7 +1219,34 @@ void salvarResultados(char tipo[], int tamanho, double tempos[], long comparacoe
     fprintf(arquivo, "Tempo medio           : %.3f ms\n", mediaTempo);
     fprintf(arquivo, "Desvio padrao (tempo) : %.3f ms\n\n", desvioTempo);
     fprintf(arquivo, "Media de comparacoes  : %.2f\n", mediaComparacoes);
-    fprintf(arquivo, "Media de trocas       : %.2f\n", mediaTrocas);
+    fprintf(arquivo, "Media de trocas       : %.2f\n\n", mediaTrocas);
+
+    /* Médias do bloco de contadores de ciclos nas execuções válidas */
+    int validas = REPETICOES - QTD_DESCARTES;
+    double soma_ciclos = 0, soma_reescaneamentos = 0, soma_duplicatas = 0, soma_escaneados = 0;
+    double soma_faixas[FAIXAS_HISTOGRAMA] = {0};
+    for (int i = QTD_DESCARTES; i < REPETICOES; i++)
+    {
+        soma_ciclos += ciclos[i].ciclos_nao_triviais;
+        soma_reescaneamentos += ciclos[i].reescaneamentos;
+        soma_duplicatas += ciclos[i].passos_duplicatas;
+        soma_escaneados += ciclos[i].elementos_escaneados;
+        for (int f = 0; f < FAIXAS_HISTOGRAMA; f++)
+            soma_faixas[f] += ciclos[i].histograma_ciclos[f];
+    }
+
+    fprintf(arquivo, "Estrutura dos ciclos (medias das execucoes validas):\n");
+    fprintf(arquivo, "------------------------------------------------------------\n");
+    fprintf(arquivo, "Ciclos nao triviais   : %.2f\n", soma_ciclos / validas);
+    fprintf(arquivo, "Reescaneamentos       : %.2f\n", soma_reescaneamentos / validas);
+    fprintf(arquivo, "Passos em duplicatas  : %.2f\n", soma_duplicatas / validas);
+    fprintf(arquivo, "Elementos escaneados  : %.2f\n", soma_escaneados / validas);
+    fprintf(arquivo, "Histograma de comprimentos de ciclo:\n");
+    for (int f = 0; f < FAIXAS_HISTOGRAMA; f++)
+    {
+        if (soma_faixas[f] > 0)
+            fprintf(arquivo, "  [%6ld, %6ld] : %.2f\n", 1L << f, (1L << (f + 1)) - 1, soma_faixas[f] / validas);
+    }
     fprintf(arquivo, "\n============================================================\n");
 
     fclose(arquivo);
@@ -401,12 +1268,14 @@ void executarTesteGeral()
 
     ResultadoCSV *resultados = malloc(TOTAL_EXECUCOES * sizeof(ResultadoCSV));
     Estatisticas *estatisticas = malloc(TOTAL_COMBINACOES * sizeof(Estatisticas));
+    ResultadoCiclosCSV *resultados_ciclos = malloc(TOTAL_EXECUCOES * sizeof(ResultadoCiclosCSV));
 
-    if (!resultados || !estatisticas)
+    if (!resultados || !estatisticas || !resultados_ciclos)
     {
         printf("Erro ao alocar memoria!\n");
         free(resultados);
         free(estatisticas);
+        free(resultados_ciclos);
         return;
     }
 
@@ -424,13 +1293,32 @@ void executarTesteGeral()
         for (int c = 0; c < 3; c++)
         {
             printf("\n[CENARIO: %s | TAMANHO: %d]\n", nomes_cenarios[c], tamanho);
+            telemetriaExperimento(1, "Cycle Sort", nomes_cenarios[c], tamanho);
             printf("Executando %d repeticoes (serao descartadas %d)...\n", REPETICOES, QTD_DESCARTES);
 
-            double tempos[REPETICOES];
-            long comparacoes[REPETICOES];
-            long trocas[REPETICOES];
+            /* Cada célula usa uma semente fixa, num gerador local (o rand() global fica intacto):
+               entradas reproduzíveis, condição para reaproveitar o cache */
+            MedicaoTesteGeral medicao;
+            CelulaCache celula = {nomesVariantes[varianteAtiva], "Cycle Sort", nomes_cenarios[c], tamanho,
+                                  TESTE_GERAL_SEMENTE + 1000u * tipos_cenarios[c] + (unsigned int)tamanho,
+                                  REPETICOES, QTD_DESCARTES, ""}; /* O Cycle Sort não tem perfil de ajuste */
+            char ambiente_cache[CACHE_AMBIENTE] = "";
+            int do_cache = cacheCarregar(&celula, &medicao, sizeof(medicao), ambiente_cache);
+            double *tempos = medicao.tempos;
+            long *comparacoes = medicao.comparacoes;
+            long *trocas = medicao.trocas;
+            EstatisticasCiclos *ciclos = medicao.ciclos;
+
+            if (do_cache)
+            {
+                printf("  Reaproveitado do cache de resultados (mesmo build, CPU, governador, turbo, semente e repeticoes).\n");
+                printf("  Medido em: %s\n", ambiente_cache);
+            }
+            else
+                memset(&medicao, 0, sizeof(medicao));
+            uint32_t estado_celula = iniciarGerador(celula.semente);
 
-            for (int r = 0; r < REPETICOES; r++)
+            for (int r = 0; r < REPETICOES && !do_cache; r++)
             {
                 int *vetor = malloc(tamanho * sizeof(int));
                 if (!vetor)
@@ -439,16 +1327,37 @@ void executarTesteGeral()
                     break;
                 }
 
-                gerarVetor(vetor, tipos_cenarios[c], tamanho);
+                gerarVetorComEstado(vetor, tipos_cenarios[c], tamanho, &estado_celula);
+                ImpressaoVetor impressao = impressaoVetor(vetor, tamanho);
 
                 struct timespec inicio, fim;
                 clock_gettime(CLOCK_MONOTONIC, &inicio);
-                cycleSort(vetor, tamanho, &comparacoes[r], &trocas[r]);
+                cycleSortInstrumentado(vetor, tamanho, &comparacoes[r], &trocas[r], &ciclos[r]);
                 clock_gettime(CLOCK_MONOTONIC, &fim);
 
-                tempos[r] = medirTempo(inicio, fim);
+                tempos[r] = medirTempo(inicio, fim);
+                verificarOrdenacao(&impressao, vetor, tamanho, "Cycle Sort", nomes_cenarios[c], r + 1);
+                telemetriaRepeticao("Cycle Sort", nomes_cenarios[c], tamanho, r + 1, tempos[r],
+                                    comparacoes[r], trocas[r], nomesVariantes[varianteAtiva]);
+
+                if ((r + 1) % 5 == 0)
+                    printf("  Completadas: %d/%d\n", r + 1, REPETICOES);
+
+                free(vetor);
+
+                if (r == REPETICOES - 1)
+                    cacheSalvar(&celula, &medicao, sizeof(medicao));
+            }
+
+            for (int r = 0; r < REPETICOES; r++)
+            {
+                strcpy(resultados_ciclos[idx_resultado].cenario, nomes_cenarios[c]);
+                resultados_ciclos[idx_resultado].tamanho = tamanho;
+                resultados_ciclos[idx_resultado].repeticao = r + 1;
+                resultados_ciclos[idx_resultado].ciclos = ciclos[r];
 
                 strcpy(resultados[idx_resultado].algoritmo, "Cycle Sort");
+                strcpy(resultados[idx_resultado].variante, nomesVariantes[varianteAtiva]);
                 strcpy(resultados[idx_resultado].cenario, nomes_cenarios[c]);
                 resultados[idx_resultado].tamanho = tamanho;
                 resultados[idx_resultado].repeticao = r + 1;
@@ -456,11 +1365,6 @@ void executarTesteGeral()
                 resultados[idx_resultado].comparacoes = comparacoes[r];
                 resultados[idx_resultado].trocas = trocas[r];
                 idx_resultado++;
-
-                if ((r + 1) % 5 == 0)
-                    printf("  Completadas: %d/%d\n", r + 1, REPETICOES);
-
-                free(vetor);
             }
 
             // Calcular estatísticas descartando as primeiras QTD_DESCARTES repetições
@@ -481,14 +1385,18 @@ void executarTesteGeral()
                 estatisticas[idx_estatistica].desvio_tempo = desvio_tempo;
                 estatisticas[idx_estatistica].media_comparacoes = media_comparacoes;
                 estatisticas[idx_estatistica].media_trocas = media_trocas;
+                snprintf(estatisticas[idx_estatistica].origem_cache, CACHE_AMBIENTE, "%s",
+                         do_cache ? ambiente_cache : "");
                 idx_estatistica++;
 
                 salvarResultados(nomes_cenarios[c], tamanho,
                                  tempos,
                                  comparacoes,
                                  trocas,
+                                 ciclos,
                                  media_tempo, desvio_tempo,
-                                 media_comparacoes, media_trocas);
+                                 media_comparacoes, media_trocas,
+                                 estatisticas[idx_estatistica - 1].origem_cache);
 
                 printf("  Concluido! Media: %.2f ms (apos descarte de %d execucoes)\n",
                        media_tempo, QTD_DESCARTES);
@@ -497,13 +1405,16 @@ void executarTesteGeral()
             {
                 printf("  Erro: Nenhuma repeticao valida apos descarte!\n");
             }
+            telemetriaExperimento(0, "Cycle Sort", nomes_cenarios[c], tamanho);
         }
     }
 
     salvarCSVGeral(resultados, idx_resultado, estatisticas, idx_estatistica);
+    salvarCSVCiclos(resultados_ciclos, idx_resultado);
 
     free(resultados);
     free(estatisticas);
+    free(resultados_ciclos);
 
     printf("\n========================================\n");
     printf("     TESTE GERAL CONCLUIDO!             \n");
@@ -518,17 +1429,22 @@ void executarTesteGeral()
  * @param tempos Vetor para armazenar os tempos de execução.
  * @param comparacoes Vetor para armazenar o número de comparações.
  * @param trocas Vetor para armazenar o número de trocas.
+ * @param ciclos Vetor para armazenar os contadores de estrutura de ciclos.
  * @param tamanho Tamanho do vetor.
  * @return void
  */
-void executarExperimentoTamanhoFixo(int tipo, double tempos[], long comparacoes[], long trocas[], int tamanho)
+void executarExperimentoTamanhoFixo(int tipo, double tempos[], long comparacoes[], long trocas[],
+                                    EstatisticasCiclos ciclos[], int tamanho)
 {
     int *vetor = malloc(tamanho * sizeof(int));
     struct timespec inicio, fim;
+    char *cenario = tipo == 1 ? "crescente" : (tipo == 2 ? "decrescente" : "aleatorio");
 
+    telemetriaExperimento(1, "Cycle Sort", cenario, tamanho);
     for (int i = 0; i < REPETICOES; i++)
     {
         gerarVetor(vetor, tipo, tamanho);
+        ImpressaoVetor impressao = impressaoVetor(vetor, tamanho);
 
         printf("=====================================\n");
         printf(" Execução %d", i + 1);
@@ -543,14 +1459,18 @@ void executarExperimentoTamanhoFixo(int tipo, double tempos[], long comparacoes[
         imprimirVetor(vetor, tamanho);
 
         clock_gettime(CLOCK_MONOTONIC, &inicio);
-        cycleSort(vetor, tamanho, &comparacoes[i], &trocas[i]);
+        cycleSortInstrumentado(vetor, tamanho, &comparacoes[i], &trocas[i], &ciclos[i]);
         clock_gettime(CLOCK_MONOTONIC, &fim);
 
         tempos[i] = medirTempo(inicio, fim);
+        verificarOrdenacao(&impressao, vetor, tamanho, "Cycle Sort", cenario, i + 1);
+        telemetriaRepeticao("Cycle Sort", cenario, tamanho, i + 1, tempos[i], comparacoes[i], trocas[i],
+                            nomesVariantes[varianteAtiva]);
 
         printf("\nVetor após a ordenação:\n");
         imprimirVetor(vetor, tamanho);
     }
+    telemetriaExperimento(0, "Cycle Sort", cenario, tamanho);
 
     free(vetor);
 }
@@ -561,9 +1481,10 @@ void executarExperimentoTamanhoFixo(int tipo, double tempos[], long comparacoes[
  * @param tempos Vetor para armazenar os tempos de execução.
  * @param comparacoes Vetor para armazenar o número de comparações.
  * @param trocas Vetor para armazenar o número de trocas.
+ * @param ciclos Vetor com os contadores de estrutura de ciclos.
  * @return void
  */
-void processarResultados(int opcao, double tempos[], long comparacoes[], long trocas[])
+void processarResultados(int opcao, double tempos[], long comparacoes[], long trocas[], EstatisticasCiclos ciclos[])
 {
     // Calcular estatísticas descartando as primeiras QTD_DESCARTES repetições
     int inicio_estat = QTD_DESCARTES;
@@ -590,8 +1511,8 @@ void processarResultados(int opcao, double tempos[], long comparacoes[], long tr
     else
         tipo = "aleatorio";
 
-    salvarResultados(tipo, TAM_VETOR, tempos, comparacoes, trocas,
-                     media, desvio, mediaComparacoes, mediaTrocas);
+    salvarResultados(tipo, TAM_VETOR, tempos, comparacoes, trocas, ciclos,
+                     media, desvio, mediaComparacoes, mediaTrocas, NULL);
 
     printf("\nResultados salvos com sucesso!\n");
     printf("Estatisticas calculadas com %d repeticoes validas (descartadas %d primeiras)\n",
@@ -599,6 +1520,413 @@ void processarResultados(int opcao, double tempos[], long comparacoes[], long tr
     pausar();
 }
 
+/* ================= BENCHMARK DE REGISTROS ================= */
+/**
+ * @brief Executa o benchmark de ordenação de registros grandes (64 a 256 bytes).
+ *        Compara o Cycle Sort direto sobre os registros (varreduras com passo do registro)
+ *        com o Cycle Sort indireto sobre índices seguido de aplicarPermutacao().
+ * @return void
+ */
+void executarBenchmarkRegistros()
+{
+    int tamanhos[] = {5000, 10000};
+    size_t tamanhos_registro[] = {64, 128, 256};
+    const char *metodos[] = {"direto", "indices + permutacao"};
+    const int NUM_METODOS = 2;
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/cycleSort/cyclesort_registros_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do benchmark de registros.\n");
+        pausar();
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "metodo;tamanho;tam_registro;media_tempo_ms;registros_escritos\n");
+
+    printf("\n========================================\n");
+    printf("  BENCHMARK DE REGISTROS (ORDENACAO INDIRETA)\n");
+    printf("========================================\n");
+    printf("%-22s %8s %9s %12s %20s\n", "metodo", "tamanho", "registro", "tempo (ms)", "registros escritos");
+
+    for (int t = 0; t < 2; t++)
+    {
+        for (int b = 0; b < 3; b++)
+        {
+            int tamanho = tamanhos[t];
+            size_t tam_registro = tamanhos_registro[b];
+
+            char *original = malloc((size_t)tamanho * tam_registro);
+            char *registros = malloc((size_t)tamanho * tam_registro);
+            int *chaves = malloc(tamanho * sizeof(int));
+            int *indices = malloc(tamanho * sizeof(int));
+
+            if (!original || !registros || !chaves || !indices)
+            {
+                printf("Erro ao alocar memoria!\n");
+                free(original);
+                free(registros);
+                free(chaves);
+                free(indices);
+                fclose(csv);
+                pausar();
+                return;
+            }
+
+            gerarVetor(chaves, 3, tamanho);
+            preencherRegistros(original, tam_registro, chaves, tamanho);
+
+            for (int m = 0; m < NUM_METODOS; m++)
+            {
+                double soma = 0.0;
+                long escritas = 0;
+                int correto = 1;
+
+                for (int r = 0; r <= REGISTROS_REPETICOES; r++)
+                {
+                    long comparacoes, trocas;
+                    memcpy(registros, original, (size_t)tamanho * tam_registro);
+
+                    struct timespec inicio, fim;
+                    clock_gettime(CLOCK_MONOTONIC, &inicio);
+                    if (m == 0)
+                    {
+                        cycleSortRegistros(registros, tam_registro, tamanho, &comparacoes, &trocas);
+                        escritas = trocas;
+                    }
+                    else
+                    {
+                        /* A extração das chaves faz parte do custo da ordenação indireta */
+                        for (int i = 0; i < tamanho; i++)
+                            chaves[i] = CHAVE_REGISTRO(registros, tam_registro, i);
+                        if (cycleSortIndices(chaves, indices, tamanho, &comparacoes, &trocas))
+                            escritas = aplicarPermutacao(registros, tam_registro, indices, tamanho);
+                        else
+                            escritas = -1;
+                    }
+                    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+                    /* Sem os índices (ou o registro auxiliar), não há permutação válida a medir */
+                    if (escritas < 0)
+                        break;
+
+                    if (r > 0)
+                        soma += medirTempo(inicio, fim);
+                    correto = correto && registrosCorretos(registros, tam_registro, tamanho);
+                }
+
+                if (escritas < 0)
+                {
+                    printf("%-22s %8d %7zu B  ERRO: falha de alocacao na ordenacao indireta!\n", metodos[m], tamanho,
+                           tam_registro);
+                    continue;
+                }
+
+                double media = soma / REGISTROS_REPETICOES;
+                printf("%-22s %8d %7zu B %12.3f %20ld%s\n", metodos[m], tamanho, tam_registro, media, escritas,
+                       correto ? "" : "  ERRO: registros incorretos!");
+                fprintf(csv, "%s;%d;%zu;%.3f;%ld\n", metodos[m], tamanho, tam_registro, media, escritas);
+            }
+
+            free(original);
+            free(registros);
+            free(chaves);
+            free(indices);
+        }
+    }
+
+    fclose(csv);
+    printf("\nCSV do benchmark de registros salvo em: %s\n", nomeCSV);
+    pausar();
+}
+
+/* ================= BENCHMARK DE DUPLICATAS ================= */
+/**
+ * @brief Compara o Cycle Sort clássico com o modo de duplicatas (cycleSortDuplicatasInstrumentado)
+ *        em entradas com 2 a 4096 valores distintos e em entradas aleatórias (quase todas distintas).
+ *        Cada saída é verificada; o CSV traz uma linha por repetição, com os elementos varridos e os
+ *        passos sobre iguais de cada método.
+ * @return void
+ */
+void executarBenchmarkDuplicatas()
+{
+    int tamanhos[] = {10000, 20000, 40000};
+    int distintos[] = {2, 16, 256, 4096, 0}; /* 0 = aleatório (cenário 3) */
+    const char *metodos[] = {"classico", "duplicatas"};
+    const int NUM_TAMANHOS = 3, NUM_DISTINTOS = 5, NUM_METODOS = 2;
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/cycleSort/cyclesort_duplicatas_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do benchmark de duplicatas.\n");
+        pausar();
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "metodo;tamanho;distintos;repeticao;tempo_ms;comparacoes;trocas;elementos_escaneados;"
+                 "passos_duplicatas;variante\n");
+
+    printf("\n========================================\n");
+    printf("  BENCHMARK DE DUPLICATAS (POUCOS VALORES DISTINTOS)\n");
+    printf("========================================\n");
+    printf("Variante da varredura: %s | %d repeticoes (apos 1 de aquecimento)\n\n",
+           nomesVariantes[varianteAtiva], DUPLICATAS_REPETICOES);
+    printf("%8s %10s %14s %14s %8s %16s %16s\n", "tamanho", "distintos", "classico (ms)", "duplicatas (ms)",
+           "ganho", "varridos (cl.)", "varridos (dup.)");
+
+    for (int t = 0; t < NUM_TAMANHOS; t++)
+    {
+        for (int d = 0; d < NUM_DISTINTOS; d++)
+        {
+            int tamanho = tamanhos[t];
+            int *original = malloc(tamanho * sizeof(int));
+            int *v = malloc(tamanho * sizeof(int));
+
+            if (!original || !v)
+            {
+                printf("Erro ao alocar memoria!\n");
+                free(original);
+                free(v);
+                fclose(csv);
+                pausar();
+                return;
+            }
+
+            if (distintos[d] > 0)
+                gerarVetorPoucosDistintos(original, tamanho, distintos[d], NULL);
+            else
+                gerarVetor(original, 3, tamanho);
+            ImpressaoVetor impressao = impressaoVetor(original, tamanho);
+
+            double media[2];
+            long escaneados[2];
+            char rotulo[20];
+            if (distintos[d] > 0)
+                sprintf(rotulo, "%d", distintos[d]);
+            else
+                sprintf(rotulo, "aleatorio");
+
+            for (int m = 0; m < NUM_METODOS; m++)
+            {
+                double soma = 0.0;
+
+                for (int r = 0; r <= DUPLICATAS_REPETICOES; r++)
+                {
+                    long comparacoes, trocas;
+                    EstatisticasCiclos ciclos;
+                    memcpy(v, original, tamanho * sizeof(int));
+
+                    struct timespec inicio, fim;
+                    clock_gettime(CLOCK_MONOTONIC, &inicio);
+                    if (m == 0)
+                        cycleSortInstrumentado(v, tamanho, &comparacoes, &trocas, &ciclos);
+                    else
+                        cycleSortDuplicatasInstrumentado(v, tamanho, &comparacoes, &trocas, &ciclos);
+                    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+                    verificarOrdenacao(&impressao, v, tamanho, m == 0 ? "Cycle Sort" : "Cycle Sort (duplicatas)",
+                                       rotulo, r + 1);
+                    double tempo = medirTempo(inicio, fim);
+                    if (r > 0)
+                        soma += tempo;
+                    escaneados[m] = ciclos.elementos_escaneados;
+
+                    fprintf(csv, "%s;%d;%s;%d;%.3f;%ld;%ld;%ld;%ld;%s\n", metodos[m], tamanho, rotulo, r + 1, tempo,
+                            comparacoes, trocas, ciclos.elementos_escaneados, ciclos.passos_duplicatas,
+                            nomesVariantes[varianteAtiva]);
+                }
+                media[m] = soma / DUPLICATAS_REPETICOES;
+            }
+
+            printf("%8d %10s %14.3f %14.3f %7.1fx %16ld %16ld\n", tamanho, rotulo, media[0], media[1],
+                   media[1] > 0.0 ? media[0] / media[1] : 0.0, escaneados[0], escaneados[1]);
+
+            free(original);
+            free(v);
+        }
+    }
+
+    fclose(csv);
+    printf("\nCSV do benchmark de duplicatas salvo em: %s\n", nomeCSV);
+    pausar();
+}
+
+/* ================= LATÊNCIA DE ORDENAÇÕES PEQUENAS ================= */
+/**
+ * @brief Benchmark de latência de ordenações pequenas (8 a 4096 elementos) com o TSC, com o
+ *        cycleSort() como kernel (latenciaExecutar(), execucaoLonga.h).
+ * @return void
+ */
+void executarBenchmarkLatencia()
+{
+    latenciaExecutar("cycleSort", cycleSort, gerarVetor, nomesVariantes[varianteAtiva]);
+    pausar();
+}
+
+/* ================= HIERARQUIA DE CACHE ================= */
+/**
+ * @brief Benchmark de escalabilidade na hierarquia de cache, no mesmo formato do Shell Sort: tamanhos
+ *        de tamanhosHierarquia() e cada variante suportada do cycleSort() medida com medirHierarquia()
+ *        sobre prefixos de um único vetor aleatório. Como o Cycle Sort faz Θ(n²) comparações, o maior
+ *        vetor padrão é HIERARQUIA_LIMITE_KB (L1 e parte de L2): 64 Ki elementos já custam cerca de
+ *        2 * 10^9 comparações por repetição, e L3/DRAM levariam horas. Os níveis acima do limite
+ *        aparecem no gráfico como fora da faixa medida.
+ * @return void
+ */
+void executarBenchmarkHierarquia()
+{
+    NivelCache niveis[MAX_NIVEIS_CACHE];
+    int num_niveis = lerHierarquiaCache(niveis, MAX_NIVEIS_CACHE);
+
+    long limite_kb;
+    printf("Maior vetor em KB (0 = padrao, %d KB; o tempo cresce com o quadrado do tamanho): ", HIERARQUIA_LIMITE_KB);
+    if (scanf("%ld", &limite_kb) != 1 || limite_kb <= 0)
+        limite_kb = HIERARQUIA_LIMITE_KB;
+    if (limite_kb > (1L << 21)) /* 2 GB: teto de tamanho do vetor em int */
+        limite_kb = 1L << 21;
+
+    long tamanhos[MAX_TAMANHOS_HIERARQUIA];
+    int num_tamanhos = tamanhosHierarquia(niveis, num_niveis, limite_kb << 10, tamanhos);
+
+    long maior = tamanhos[num_tamanhos - 1] / (long)sizeof(int);
+    int *original = malloc(maior * sizeof(int));
+    int *v = malloc(maior * sizeof(int));
+    double *tempos = malloc(HIERARQUIA_MAX_REPETICOES * sizeof(double));
+    if (!original || !v || !tempos)
+    {
+        printf("Erro ao alocar memoria!\n");
+        free(original);
+        free(v);
+        free(tempos);
+        pausar();
+        return;
+    }
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/cycleSort/cyclesort_hierarquia_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do benchmark de hierarquia.\n");
+        free(original);
+        free(v);
+        free(tempos);
+        pausar();
+        return;
+    }
+    ambienteCabecalho(csv);
+    cabecalhoCSVHierarquia(csv);
+
+    printf("\n========================================\n");
+    printf("   HIERARQUIA DE CACHE (ate %ld KB)\n", limite_kb);
+    printf("========================================\n");
+    exibirNiveisHierarquia(niveis, num_niveis, tamanhos, num_tamanhos);
+
+    uint32_t estado = iniciarGerador(TESTE_GERAL_SEMENTE); /* Local: não fixa o rand() das próximas opções */
+    gerarVetorComEstado(original, 3, (int)maior, &estado);
+    int variante_inicial = varianteAtiva;
+
+    for (int var = 0; var < NUM_VARIANTES; var++)
+    {
+        if (!varianteSuportada(var))
+            continue;
+        varianteAtiva = var;
+        cabecalhoTabelaHierarquia(nomesVariantes[var]);
+
+        for (int t = 0; t < num_tamanhos; t++)
+        {
+            char nivel[8];
+            nivelDoTamanho(tamanhos[t], niveis, num_niveis, nivel, sizeof(nivel));
+            MedicaoHierarquia m = medirHierarquia(cycleSort, "Cycle Sort", original, v,
+                                                  (int)(tamanhos[t] / (long)sizeof(int)), tempos);
+            registrarHierarquia(csv, nomesVariantes[var], "-", tamanhos[t], nivel, m);
+        }
+    }
+    varianteAtiva = variante_inicial;
+    salvarNiveisHierarquia(csv, niveis, num_niveis);
+
+    fclose(csv);
+    free(original);
+    free(v);
+    free(tempos);
+    printf("\nCSV do benchmark de hierarquia salvo em: %s\n", nomeCSV);
+    pausar();
+}
+
+/* ================= MODO SOAK ================= */
+/**
+ * @brief Modo soak com o cycleSort() como kernel: ordenações contínuas com histograma HDR de latência
+ *        por janela e sensores do processador (soakExecutar(), execucaoLonga.h).
+ * @return void
+ */
+void executarSoak()
+{
+    soakExecutar("cycleSort", cycleSort, gerarVetor, TAM_MAX, nomesVariantes[varianteAtiva]);
+    pausar();
+}
+
+/**
+ * @brief Consulta e manutenção do cache de resultados do teste geral (cacheResultados.h).
+ * @return void
+ */
+void executarMenuCache()
+{
+    int escolha;
+    char filtro[128] = "";
+
+    limpar_tela();
+    printf("=====================================\n");
+    printf("      CACHE DE RESULTADOS\n");
+    printf("=====================================\n");
+    printf("Pasta: %s%s\n", cacheEstado.pasta, cacheEstado.ativo ? "" : " (desligado: ORDENACAO_CACHE=0)");
+    printf("1 - Listar entradas\n");
+    printf("2 - Invalidar todas as entradas\n");
+    printf("3 - Invalidar por filtro (trecho da descricao, ex.: ;aleatorio;60000 ou ;crescente;)\n");
+    printf("4 - Remover entradas de outros builds\n");
+    printf("Escolha: ");
+    if (scanf("%d", &escolha) != 1)
+        escolha = 0;
+
+    if (escolha == 1)
+        cachePercorrer(NULL, 0, 0);
+    else if (escolha == 2)
+        cachePercorrer(NULL, 0, 1);
+    else if (escolha == 3)
+    {
+        printf("Filtro: ");
+        if (scanf("%127s", filtro) == 1)
+            cachePercorrer(filtro, 0, 1);
+    }
+    else if (escolha == 4)
+        cachePercorrer(NULL, 1, 1);
+    else
+        printf("Opcao invalida!\n");
+
+    pausar();
+}
+
 /* ================= MENU ================= */
 /**
  * @brief Exibe o menu e obtém a opção do usuário.
@@ -615,11 +1943,18 @@ int menu()
     printf("  Repeticoes: %d\n", REPETICOES);
     printf("  Descartes: %d\n", QTD_DESCARTES);
     printf("  Repeticoes validas: %d\n", REPETICOES - QTD_DESCARTES);
+    printf("  Variante: %s (ORDENACAO_VARIANTE; auto = mais larga da CPU)\n", nomesVariantes[varianteAtiva]);
     printf("=====================================\n");
     printf(" 1 - Vetor Crescente\n");
     printf(" 2 - Vetor Decrescente\n");
     printf(" 3 - Vetor Aleatorio\n");
     printf(" 4 - Teste Geral (todos os casos)\n");
+    printf(" 5 - Benchmark de Registros (ordenacao indireta)\n");
+    printf(" 6 - Modo Soak (execucao continua com histograma de latencia)\n");
+    printf(" 7 - Latencia de Ordenacoes Pequenas (TSC, 8 a 4096 elementos)\n");
+    printf(" 8 - Cache de Resultados do Teste Geral (listar / invalidar)\n");
+    printf(" 9 - Benchmark de Duplicatas (poucos valores distintos)\n");
+    printf("10 - Hierarquia de Cache (L1/L2: elementos/s e largura de banda)\n");
     printf(" 0 - Sair\n");
     printf("=====================================\n");
     printf(" Escolha uma opcao: ");
@@ -637,28 +1972,219 @@ void executarOpcao(int opcao)
     double tempos[REPETICOES];
     long comparacoes[REPETICOES];
     long trocas[REPETICOES];
+    EstatisticasCiclos ciclos[REPETICOES];
 
     limpar_tela();
     printf("Opcao selecionada: %d\n", opcao);
 
     if (confirmar("Deseja iniciar a execucao?"))
     {
+        /* Pré-voo: impressão digital do ambiente e fontes de ruído (o menu do cache não mede nada) */
+        if (opcao != 8 && !ambientePreparar("cycleSort"))
+        {
+            pausar();
+            return;
+        }
         if (opcao == 4)
         {
             executarTesteGeral();
         }
+        else if (opcao == 5)
+        {
+            executarBenchmarkRegistros();
+        }
+        else if (opcao == 6)
+        {
+            executarSoak();
+        }
+        else if (opcao == 7)
+        {
+            executarBenchmarkLatencia();
+        }
+        else if (opcao == 8)
+        {
+            executarMenuCache();
+        }
+        else if (opcao == 9)
+        {
+            executarBenchmarkDuplicatas();
+        }
+        else if (opcao == 10)
+        {
+            executarBenchmarkHierarquia();
+        }
         else
         {
-            executarExperimentoTamanhoFixo(opcao, tempos, comparacoes, trocas, TAM_VETOR);
-            processarResultados(opcao, tempos, comparacoes, trocas);
+            executarExperimentoTamanhoFixo(opcao, tempos, comparacoes, trocas, ciclos, TAM_VETOR);
+            processarResultados(opcao, tempos, comparacoes, trocas, ciclos);
+        }
+    }
+}
+
+#ifdef ORDENACAO_BIBLIOTECA
+/* ================= INTERFACE DA BIBLIOTECA ================= */
+#include <pthread.h>
+#include "ordenacao.h"
+
+pthread_once_t inicializacaoBiblioteca = PTHREAD_ONCE_INIT;
+
+ORDENACAO_API const char *ordenacaoVarianteCycleSort(void)
+{
+    pthread_once(&inicializacaoBiblioteca, selecionarVariante);
+    return nomesVariantes[varianteAtiva];
+}
+
+ORDENACAO_API int ordenacaoCycleSort(int32_t *v, int64_t n, ContadoresOrdenacao *contadores)
+{
+    if (n < 0 || n > INT32_MAX)
+        return ORDENACAO_ERRO_TAMANHO;
+    if (!v && n > 0)
+        return ORDENACAO_ERRO_ARGUMENTO;
+    pthread_once(&inicializacaoBiblioteca, selecionarVariante);
+
+    long comparacoes = 0, trocas = 0;
+    if (n > 1)
+        cycleSort(v, (int)n, &comparacoes, &trocas);
+    if (contadores)
+    {
+        contadores->comparacoes = comparacoes;
+        contadores->trocas = trocas;
+    }
+    return ORDENACAO_OK;
+}
+#else
+/* ================= MODOS DE LINHA DE COMANDO ================= */
+/**
+ * @brief Ordena uma cópia de entrada com Cycle Sort e verifica a saída.
+ * @return Número de ordenações executadas (1).
+ */
+int treinarOrdenacao(const int entrada[], int v[], int tamanho, const char *cenario)
+{
+    long comparacoes, trocas;
+    memcpy(v, entrada, tamanho * sizeof(int));
+    ImpressaoVetor impressao = impressaoVetor(v, tamanho);
+    cycleSort(v, tamanho, &comparacoes, &trocas);
+    verificarOrdenacao(&impressao, v, tamanho, "Cycle Sort (treino)", cenario, 1);
+    return 1;
+}
+
+/**
+ * @brief Modo --treino: percorre sem interação uma mistura representativa dos cenários do harness
+ *        (teste geral e vetores pequenos), com todas as saídas verificadas e nenhum arquivo gravado.
+ *        Usado para coletar o perfil da compilação PGO.
+ * @return 0 em caso de sucesso, 1 em caso de erro de alocação.
+ */
+int executarTreino()
+{
+    int tamanhos_gerais[] = {20000, 40000, 60000};
+    int tamanhos_pequenos[] = {8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+    char *nomes_cenarios[] = {"crescente", "decrescente", "aleatorio"};
+    int *entrada = malloc(60000 * sizeof(int));
+    int *v = malloc(60000 * sizeof(int));
+    int ordenacoes = 0;
+
+    if (!entrada || !v)
+    {
+        printf("Erro ao alocar memoria!\n");
+        free(entrada);
+        free(v);
+        return 1;
+    }
+
+    struct timespec inicio, fim;
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+    srand(TREINO_SEMENTE);
+
+    /* Mesma mistura do teste geral */
+    for (int t = 0; t < 3; t++)
+        for (int c = 0; c < 3; c++)
+            for (int r = 0; r < TREINO_REPETICOES; r++)
+            {
+                gerarVetor(entrada, c + 1, tamanhos_gerais[t]);
+                ordenacoes += treinarOrdenacao(entrada, v, tamanhos_gerais[t], nomes_cenarios[c]);
+            }
+
+    /* Vetores pequenos, como no benchmark de latência */
+    for (int t = 0; t < 10; t++)
+    {
+        int tamanho = tamanhos_pequenos[t];
+        for (int e = 0; e < LATENCIA_MIN_ENTRADAS; e++)
+        {
+            gerarVetor(entrada, 3, tamanho);
+            ordenacoes += treinarOrdenacao(entrada, v, tamanho, "aleatorio");
         }
     }
+
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+    printf("Treino concluido: %d ordenacoes verificadas em %.1f s (variante %s)\n",
+           ordenacoes, medirTempo(inicio, fim) / 1000.0, nomesVariantes[varianteAtiva]);
+
+    free(entrada);
+    free(v);
+    return 0;
+}
+
+/**
+ * @brief Trata as opções de linha de comando (modo não interativo).
+ *          --treino  mistura de cenários para coleta de perfil (PGO)
+ *          --geral   teste geral sem menus, gravando os arquivos de sempre em ../results/files/
+ *          --cache-* consulta e invalidação do cache de resultados do teste geral
+ * @return Código de saída do programa.
+ */
+int executarLinhaComando(int argc, char *argv[])
+{
+    const char *opcao = argv[1];
+    const char *filtro = argc > 2 ? argv[2] : NULL;
+
+    if (strcmp(opcao, "--treino") == 0)
+        return executarTreino();
+
+    if (strcmp(opcao, "--geral") == 0)
+    {
+        modoInterativo = 0;
+        if (!ambientePreparar("cycleSort"))
+            return 1;
+        executarTesteGeral();
+        return 0;
+    }
+
+    if (strcmp(opcao, "--cache-listar") == 0)
+    {
+        cachePercorrer(filtro, 0, 0);
+        return 0;
+    }
+
+    if (strcmp(opcao, "--cache-invalidar") == 0)
+    {
+        cachePercorrer(filtro, 0, 1);
+        return 0;
+    }
+
+    if (strcmp(opcao, "--cache-obsoletas") == 0)
+    {
+        cachePercorrer(filtro, 1, 1);
+        return 0;
+    }
+
+    printf("Uso: %s [--treino | --geral | --cache-listar [filtro] | --cache-invalidar [filtro] | "
+           "--cache-obsoletas]\n", argv[0]);
+    printf("  sem opcoes  menu interativo\n");
+    printf("  --treino    executa a mistura de cenarios usada para coletar o perfil PGO\n");
+    printf("  --geral     executa o teste geral sem interacao (ORDENACAO_ESTRITO=1 recusa ambientes ruidosos)\n");
+    printf("  --cache-listar [filtro]     lista as celulas do teste geral guardadas no cache\n");
+    printf("  --cache-invalidar [filtro]  remove as celulas cuja descricao contem o filtro (todas se omitido)\n");
+    printf("  --cache-obsoletas           remove as celulas gravadas por outros builds do programa\n");
+    return 1;
 }
 
 /* ================= MAIN ================= */
-int main()
+int main(int argc, char *argv[])
 {
     srand(time(NULL));
+    selecionarVariante();
+    cacheIniciar("cycleSort");
+    if (telemetriaIniciar("cycleSort"))
+        telemetriaAmbiente(nomesVariantes[varianteAtiva]);
     int executando = 1;
 
     // Validação das constantes
@@ -671,6 +2197,13 @@ int main()
         return 1;
     }
 
+    if (argc > 1)
+    {
+        int codigo = executarLinhaComando(argc, argv);
+        telemetriaEncerrar();
+        return codigo;
+    }
+
     while (executando)
     {
         int opcao = menu();
@@ -688,6 +2221,12 @@ int main()
         case 2:
         case 3:
         case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
             executarOpcao(opcao);
             break;
 
@@ -698,5 +2237,7 @@ int main()
         }
     }
 
+    telemetriaEncerrar();
     return 0;
-}
\ No newline at end of file
+}
+#endif
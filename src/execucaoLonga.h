@@ -0,0 +1,634 @@
+/*  ==================================================================
+ *  MODO SOAK: HISTOGRAMA HDR E SENSORES DO SISTEMA
+ *  Apoio às execuções longas (horas) dos programas de ordenação:
+ *    - histograma HDR (faixa dinâmica alta) de latências em nanossegundos,
+ *      com precisão relativa fixa (~0,8%) de 1 ns até o limite de 64 bits
+ *      e registro em O(1), sem alocação;
+ *    - leitura de frequência, temperatura e contador de throttling térmico
+ *      pelo sysfs, para correlacionar deriva de latência com o processador;
+ *    - acumulador de correlação de Pearson, sem guardar as amostras;
+ *    - o modo soak e o benchmark de latência de ordenações pequenas (TSC),
+ *      comuns aos dois programas, que só fornecem o kernel e o gerador de
+ *      entradas.
+ *  ==================================================================*/
+#ifndef EXECUCAO_LONGA_H
+#define EXECUCAO_LONGA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <math.h>
+#include "tsc.h"
+#include "ambiente.h"
+
+#define HDR_BITS 7                          /* Bits de precisão da mantissa (2^7 sub-faixas por oitava) */
+#define HDR_SUB (1 << HDR_BITS)
+#define HDR_CONTADORES ((64 - HDR_BITS + 1) * HDR_SUB)
+#define SENSOR_MAX_CPUS 256
+#define SOAK_TAMANHO_PADRAO 20000
+#define SOAK_LIMIAR_DEGRADACAO 0.10 /* Modo soak: p50 da janela acima da melhor janela em mais que isto */
+#define SOAK_LIMIAR_FREQUENCIA 0.90 /* Modo soak: frequência abaixo desta fração da maior observada */
+#define LATENCIA_AMOSTRAS 200      /* Amostras por tamanho no benchmark de latência */
+#define LATENCIA_ELEMENTOS 65536   /* Elementos do conjunto de entradas em rodízio de cada tamanho */
+#define LATENCIA_MIN_ENTRADAS 64   /* Menor número de entradas distintas no rodízio */
+
+typedef struct
+{
+    unsigned long long contagens[HDR_CONTADORES];
+    unsigned long long total;
+    unsigned long long minimo; /* Menor valor exato registrado (válido se total > 0) */
+    unsigned long long maximo; /* Maior valor exato registrado */
+} HistogramaHDR;
+
+typedef struct
+{
+    long n;
+    double sx, sy, sxx, syy, sxy;
+} Correlacao;
+
+/**
+ * @brief Índice do contador de um valor: exato abaixo de 2^HDR_BITS, log-linear acima.
+ */
+static inline int hdrIndice(unsigned long long valor)
+{
+    if (valor < HDR_SUB)
+        return (int)valor;
+    int msb = 63 - __builtin_clzll(valor);
+    int deslocamento = msb - HDR_BITS;
+    return (deslocamento + 1) * HDR_SUB + (int)((valor >> deslocamento) - HDR_SUB);
+}
+
+/**
+ * @brief Maior valor representado por um contador (limite conservador para percentis).
+ */
+static inline unsigned long long hdrValor(int indice)
+{
+    if (indice < HDR_SUB)
+        return (unsigned long long)indice;
+    int deslocamento = indice / HDR_SUB - 1;
+    unsigned long long base = (unsigned long long)(indice % HDR_SUB + HDR_SUB) << deslocamento;
+    return base + ((1ULL << deslocamento) - 1);
+}
+
+static inline void hdrZerar(HistogramaHDR *h)
+{
+    memset(h, 0, sizeof(*h));
+}
+
+static inline void hdrRegistrar(HistogramaHDR *h, unsigned long long valor)
+{
+    h->contagens[hdrIndice(valor)]++;
+    if (h->total++ == 0 || valor < h->minimo)
+        h->minimo = valor;
+    if (valor > h->maximo)
+        h->maximo = valor;
+}
+
+/**
+ * @brief Acumula o histograma origem no destino.
+ */
+static inline void hdrSomar(HistogramaHDR *destino, const HistogramaHDR *origem)
+{
+    for (int i = 0; i < HDR_CONTADORES; i++)
+        destino->contagens[i] += origem->contagens[i];
+    if (origem->total > 0 && (destino->total == 0 || origem->minimo < destino->minimo))
+        destino->minimo = origem->minimo;
+    destino->total += origem->total;
+    if (origem->maximo > destino->maximo)
+        destino->maximo = origem->maximo;
+}
+
+/**
+ * @brief Valor no percentil p (0-100). Os percentis 0 e 100 devolvem o mínimo e o máximo exatos.
+ */
+static inline unsigned long long hdrPercentil(const HistogramaHDR *h, double p)
+{
+    if (h->total == 0)
+        return 0;
+    if (p <= 0.0)
+        return h->minimo;
+    if (p >= 100.0)
+        return h->maximo;
+
+    unsigned long long alvo = (unsigned long long)ceil(p / 100.0 * (double)h->total);
+    if (alvo == 0)
+        alvo = 1;
+    unsigned long long acumulado = 0;
+    for (int i = 0; i < HDR_CONTADORES; i++)
+    {
+        acumulado += h->contagens[i];
+        if (acumulado >= alvo)
+            return hdrValor(i) < h->maximo ? hdrValor(i) : h->maximo;
+    }
+    return h->maximo;
+}
+
+/**
+ * @brief Grava a distribuição (contadores não vazios) em CSV: valor_ns;contagem;percentil.
+ */
+static inline void hdrSalvarCSV(const HistogramaHDR *h, FILE *csv)
+{
+    unsigned long long acumulado = 0;
+    fprintf(csv, "valor_ns;contagem;percentil\n");
+    for (int i = 0; i < HDR_CONTADORES; i++)
+    {
+        if (h->contagens[i] == 0)
+            continue;
+        acumulado += h->contagens[i];
+        fprintf(csv, "%llu;%llu;%.6f\n", hdrValor(i), h->contagens[i], 100.0 * acumulado / h->total);
+    }
+}
+
+/* ================= SENSORES (SYSFS) ================= */
+
+/**
+ * @brief Lê o primeiro número de um arquivo do sysfs/procfs.
+ * @return 1 em caso de sucesso, 0 se o arquivo não existir ou não tiver número.
+ */
+static inline int lerNumeroArquivo(const char *caminho, double *valor)
+{
+    FILE *f = fopen(caminho, "r");
+    if (!f)
+        return 0;
+    int ok = fscanf(f, "%lf", valor) == 1;
+    fclose(f);
+    return ok;
+}
+
+/**
+ * @brief Frequência média atual dos núcleos em MHz (scaling_cur_freq, ou /proc/cpuinfo).
+ * @return Frequência em MHz, ou -1 se não disponível.
+ */
+static inline double lerFrequenciaMHz()
+{
+    char caminho[128];
+    double soma = 0.0, valor;
+    int n = 0;
+
+    for (int cpu = 0; cpu < SENSOR_MAX_CPUS; cpu++)
+    {
+        snprintf(caminho, sizeof(caminho), "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_cur_freq", cpu);
+        if (!lerNumeroArquivo(caminho, &valor))
+            break;
+        soma += valor / 1000.0;
+        n++;
+    }
+
+    if (n == 0)
+    {
+        FILE *f = fopen("/proc/cpuinfo", "r");
+        char linha[256];
+        while (f && fgets(linha, sizeof(linha), f))
+            if (strncmp(linha, "cpu MHz", 7) == 0 && sscanf(strchr(linha, ':') + 1, "%lf", &valor) == 1)
+            {
+                soma += valor;
+                n++;
+            }
+        if (f)
+            fclose(f);
+    }
+    return n > 0 ? soma / n : -1.0;
+}
+
+/**
+ * @brief Maior temperatura entre as zonas térmicas, em graus Celsius.
+ * @return Temperatura, ou -1 se não houver zonas térmicas.
+ */
+static inline double lerTemperaturaC()
+{
+    char caminho[128];
+    double maior = -1.0, valor;
+
+    for (int zona = 0; zona < SENSOR_MAX_CPUS; zona++)
+    {
+        snprintf(caminho, sizeof(caminho), "/sys/class/thermal/thermal_zone%d/temp", zona);
+        if (!lerNumeroArquivo(caminho, &valor))
+            break;
+        if (valor / 1000.0 > maior)
+            maior = valor / 1000.0;
+    }
+    return maior;
+}
+
+/**
+ * @brief Soma dos contadores de throttling térmico dos núcleos (x86, thermal_throttle).
+ * @return Total de eventos, ou -1 se o contador não existir.
+ */
+static inline long lerContadorThrottling()
+{
+    char caminho[128];
+    double valor;
+    long total = -1;
+
+    for (int cpu = 0; cpu < SENSOR_MAX_CPUS; cpu++)
+    {
+        snprintf(caminho, sizeof(caminho), "/sys/devices/system/cpu/cpu%d/thermal_throttle/core_throttle_count", cpu);
+        if (!lerNumeroArquivo(caminho, &valor))
+            break;
+        total = (total < 0 ? 0 : total) + (long)valor;
+    }
+    return total;
+}
+
+/* ================= CORRELAÇÃO ================= */
+
+static inline void correlacaoAdicionar(Correlacao *c, double x, double y)
+{
+    c->n++;
+    c->sx += x;
+    c->sy += y;
+    c->sxx += x * x;
+    c->syy += y * y;
+    c->sxy += x * y;
+}
+
+/**
+ * @brief Coeficiente de Pearson das amostras acumuladas.
+ * @return Coeficiente em [-1, 1], ou NAN com menos de 3 amostras ou variância nula.
+ */
+static inline double correlacaoPearson(const Correlacao *c)
+{
+    if (c->n < 3)
+        return NAN;
+    double cov = c->sxy - c->sx * c->sy / c->n;
+    double vx = c->sxx - c->sx * c->sx / c->n;
+    double vy = c->syy - c->sy * c->sy / c->n;
+    if (vx <= 0.0 || vy <= 0.0)
+        return NAN;
+    return cov / sqrt(vx * vy);
+}
+
+/* ================= EXECUÇÕES COMUNS AOS PROGRAMAS ================= */
+
+/* Kernel medido: mesma assinatura de shellSort() e cycleSort() */
+typedef void (*FuncaoOrdenacaoLonga)(int v[], int tamanho, long *comparacoes, long *trocas);
+/* Gerador de entradas do programa: gerarVetor(v, tipo, tamanho), tipo 1 a 3 */
+typedef void (*FuncaoGerarVetorLonga)(int v[], int tipo, int tamanho);
+
+/**
+ * @brief Caminho de um arquivo de resultados: ../results/files/<programa>/<programa em minúsculas>_<sufixo>_<data>.csv.
+ */
+static inline void nomeArquivoLongo(char nome[], size_t tamanho, const char *programa, const char *sufixo,
+                                    const struct tm *info)
+{
+    char prefixo[32];
+    size_t i = 0;
+    for (; programa[i] && i < sizeof(prefixo) - 1; i++)
+        prefixo[i] = (char)tolower((unsigned char)programa[i]);
+    prefixo[i] = '\0';
+    snprintf(nome, tamanho, "../results/files/%s/%s_%s_%04d-%02d-%02d_%02d-%02d-%02d.csv", programa, prefixo,
+             sufixo, info->tm_year + 1900, info->tm_mon + 1, info->tm_mday, info->tm_hour, info->tm_min,
+             info->tm_sec);
+}
+
+static inline double segundosEntre(struct timespec inicio, struct timespec fim)
+{
+    return (double)(fim.tv_sec - inicio.tv_sec) + (fim.tv_nsec - inicio.tv_nsec) / 1e9;
+}
+
+/**
+ * @brief Modo soak: ordena entradas novas continuamente por um tempo longo, com tamanho e
+ *        distribuição fixos. A latência de cada ordenação vai para um histograma HDR; ao fim de
+ *        cada janela são gravados p50/p99/p99.9/máximo, frequência e temperatura do processador.
+ *        Janelas são marcadas com "throttling" (contador térmico do kernel aumentou),
+ *        "freq_reduzida" (frequência abaixo de SOAK_LIMIAR_FREQUENCIA da maior observada) e
+ *        "degradacao" (p50 acima da melhor janela em mais de SOAK_LIMIAR_DEGRADACAO).
+ * @param programa Nome do programa: pasta de resultados e prefixo (em minúsculas) dos arquivos.
+ * @param ordenar Kernel medido.
+ * @param gerar Gerador de entradas do programa.
+ * @param tam_max Maior valor dos elementos: entradas crescentes/decrescentes aceitam até tam_max elementos.
+ * @param variante Variante ativa, gravada em cada linha do CSV.
+ */
+static inline void soakExecutar(const char *programa, FuncaoOrdenacaoLonga ordenar, FuncaoGerarVetorLonga gerar,
+                                int tam_max, const char *variante)
+{
+    double duracao_min, janela_s;
+    int tamanho, tipo;
+
+    printf("Duracao (minutos): ");
+    if (scanf("%lf", &duracao_min) != 1 || duracao_min <= 0)
+        duracao_min = 60.0;
+    printf("Tamanho do vetor: ");
+    if (scanf("%d", &tamanho) != 1 || tamanho <= 0)
+        tamanho = SOAK_TAMANHO_PADRAO;
+    printf("Tipo (1 - crescente, 2 - decrescente, 3 - aleatorio): ");
+    if (scanf("%d", &tipo) != 1 || tipo < 1 || tipo > 3)
+        tipo = 3;
+    printf("Janela (segundos): ");
+    if (scanf("%lf", &janela_s) != 1 || janela_s <= 0)
+        janela_s = 60.0;
+    if (tipo != 3 && tamanho > tam_max)
+    {
+        printf("Tipos crescente/decrescente aceitam ate %d elementos; usando aleatorio.\n", tam_max);
+        tipo = 3;
+    }
+
+    const char *nomes_tipos[] = {"", "crescente", "decrescente", "aleatorio"};
+    int *vetor = malloc(tamanho * sizeof(int));
+    HistogramaHDR *janela = malloc(sizeof(HistogramaHDR));
+    HistogramaHDR *total = malloc(sizeof(HistogramaHDR));
+    if (!vetor || !janela || !total)
+    {
+        printf("Erro ao alocar memoria!\n");
+        free(vetor);
+        free(janela);
+        free(total);
+        return;
+    }
+    hdrZerar(janela);
+    hdrZerar(total);
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150], nomeHistograma[150];
+    nomeArquivoLongo(nomeCSV, sizeof(nomeCSV), programa, "soak", info);
+    nomeArquivoLongo(nomeHistograma, sizeof(nomeHistograma), programa, "soak_histograma", info);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do modo soak.\n");
+        free(vetor);
+        free(janela);
+        free(total);
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "janela;inicio_s;ordenacoes;p50_us;p99_us;p999_us;max_us;freq_mhz;temp_c;throttling;marcas;variante\n");
+
+    printf("\n========================================\n");
+    printf("   MODO SOAK (%s, n = %d, %.1f min, janelas de %.0f s)\n",
+           nomes_tipos[tipo], tamanho, duracao_min, janela_s);
+    printf("========================================\n");
+    printf("%6s %9s %8s %10s %10s %10s %10s %8s %6s  %s\n",
+           "janela", "inicio(s)", "ordens", "p50(us)", "p99(us)", "p99.9(us)", "max(us)", "MHz", "C", "marcas");
+
+    struct timespec comeco, fim_janela, inicio, fim;
+    clock_gettime(CLOCK_MONOTONIC, &comeco);
+    double inicio_janela_s = 0.0, maior_freq = 0.0, melhor_p50 = 0.0;
+    long throttling_inicial = lerContadorThrottling(), throttling_anterior = throttling_inicial;
+    int num_janelas = 0, janelas_marcadas = 0;
+    long comparacoes, trocas;
+    Correlacao freq_p50 = {0}, temp_p50 = {0};
+
+    for (;;)
+    {
+        gerar(vetor, tipo, tamanho);
+
+        clock_gettime(CLOCK_MONOTONIC, &inicio);
+        ordenar(vetor, tamanho, &comparacoes, &trocas);
+        clock_gettime(CLOCK_MONOTONIC, &fim);
+
+        hdrRegistrar(janela, (unsigned long long)(fim.tv_sec - inicio.tv_sec) * 1000000000ULL +
+                                 (unsigned long long)fim.tv_nsec - (unsigned long long)inicio.tv_nsec);
+
+        double decorrido_s = segundosEntre(comeco, fim);
+        int encerrar = decorrido_s >= duracao_min * 60.0;
+        if (decorrido_s - inicio_janela_s < janela_s && !encerrar)
+            continue;
+
+        /* Fecha a janela: sensores e percentis ficam fora de qualquer medição */
+        double freq = lerFrequenciaMHz();
+        double temp = lerTemperaturaC();
+        long throttling = lerContadorThrottling();
+        double p50 = hdrPercentil(janela, 50.0) / 1000.0;
+        double p99 = hdrPercentil(janela, 99.0) / 1000.0;
+        double p999 = hdrPercentil(janela, 99.9) / 1000.0;
+        double maximo = janela->maximo / 1000.0;
+
+        char marcas[64] = "";
+        if (throttling >= 0 && throttling > throttling_anterior)
+            strcat(marcas, "throttling ");
+        if (freq > 0 && maior_freq > 0 && freq < SOAK_LIMIAR_FREQUENCIA * maior_freq)
+            strcat(marcas, "freq_reduzida ");
+        if (melhor_p50 > 0 && p50 > (1.0 + SOAK_LIMIAR_DEGRADACAO) * melhor_p50)
+            strcat(marcas, "degradacao ");
+        if (marcas[0])
+        {
+            marcas[strlen(marcas) - 1] = '\0';
+            janelas_marcadas++;
+        }
+        else
+            strcpy(marcas, "-");
+
+        if (freq > maior_freq)
+            maior_freq = freq;
+        if (melhor_p50 == 0 || p50 < melhor_p50)
+            melhor_p50 = p50;
+        if (freq > 0)
+            correlacaoAdicionar(&freq_p50, freq, p50);
+        if (temp >= 0)
+            correlacaoAdicionar(&temp_p50, temp, p50);
+
+        num_janelas++;
+        printf("%6d %9.0f %8llu %10.1f %10.1f %10.1f %10.1f %8.0f %6.1f  %s\n",
+               num_janelas, inicio_janela_s, janela->total, p50, p99, p999, maximo, freq, temp, marcas);
+        fprintf(csv, "%d;%.3f;%llu;%.3f;%.3f;%.3f;%.3f;%.0f;%.1f;%ld;%s;%s\n",
+                num_janelas, inicio_janela_s, janela->total, p50, p99, p999, maximo, freq, temp,
+                throttling >= 0 ? throttling - throttling_anterior : -1, marcas, variante);
+        fflush(csv);
+
+        hdrSomar(total, janela);
+        hdrZerar(janela);
+        if (throttling >= 0)
+            throttling_anterior = throttling;
+        clock_gettime(CLOCK_MONOTONIC, &fim_janela);
+        inicio_janela_s = segundosEntre(comeco, fim_janela);
+
+        if (encerrar)
+            break;
+    }
+    fclose(csv);
+
+    FILE *histograma = fopen(nomeHistograma, "w");
+    if (histograma)
+    {
+        ambienteCabecalho(histograma);
+        hdrSalvarCSV(total, histograma);
+        fclose(histograma);
+    }
+    else
+        printf("Erro ao criar o arquivo do histograma.\n");
+
+    printf("\nTotal: %llu ordenacoes | p50 %.1f us | p99 %.1f us | p99.9 %.1f us | p99.99 %.1f us | max %.1f us\n",
+           total->total, hdrPercentil(total, 50.0) / 1000.0, hdrPercentil(total, 99.0) / 1000.0,
+           hdrPercentil(total, 99.9) / 1000.0, hdrPercentil(total, 99.99) / 1000.0, total->maximo / 1000.0);
+    printf("Janelas marcadas: %d de %d\n", janelas_marcadas, num_janelas);
+    if (throttling_inicial >= 0)
+        printf("Eventos de throttling termico: %ld\n", throttling_anterior - throttling_inicial);
+    else
+        printf("Contador de throttling termico indisponivel neste sistema.\n");
+    printf("Correlacao p50 x frequencia: %.3f | p50 x temperatura: %.3f\n",
+           correlacaoPearson(&freq_p50), correlacaoPearson(&temp_p50));
+    printf("Arquivos gerados:\n  %s\n  %s\n", nomeCSV, nomeHistograma);
+
+    free(vetor);
+    free(janela);
+    free(total);
+}
+
+static inline int compararDoubleLongo(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Percentil p (0-100) de um vetor de doubles já ordenado (método do posto mais próximo).
+ */
+static inline double percentilOrdenado(const double v[], int n, double p)
+{
+    int posicao = (int)ceil(p / 100.0 * n) - 1;
+    if (posicao < 0)
+        posicao = 0;
+    return v[posicao < n ? posicao : n - 1];
+}
+
+/**
+ * @brief Benchmark de latência de ordenações pequenas (8 a 4096 elementos) com o TSC.
+ *        O TSC é calibrado contra CLOCK_MONOTONIC e lido com lfence/rdtscp. Em cada tamanho,
+ *        um conjunto de entradas aleatórias pré-geradas é percorrido em rodízio (nenhuma
+ *        entrada é ordenada duas vezes seguidas) de dois modos:
+ *          - "lote": cada amostra mede várias ordenações seguidas e divide pelo número delas;
+ *          - "individual": cada ordenação é medida sozinha, descontando a sobrecarga da leitura.
+ *        A restauração das entradas (memcpy) fica fora das regiões medidas. O mínimo e o máximo
+ *        são exatos nos dois modos; os demais percentis do modo individual vêm do histograma HDR.
+ * @param programa Nome do programa: pasta de resultados e prefixo (em minúsculas) do CSV.
+ * @param ordenar Kernel medido (os contadores são ignorados).
+ * @param gerar Gerador de entradas do programa (tipo 3, aleatório).
+ * @param variante Variante ativa, gravada em cada linha do CSV.
+ */
+static inline void latenciaExecutar(const char *programa, FuncaoOrdenacaoLonga ordenar, FuncaoGerarVetorLonga gerar,
+                                    const char *variante)
+{
+    int tamanhos[] = {8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+    int num_tamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+    int maior_conjunto = LATENCIA_ELEMENTOS > LATENCIA_MIN_ENTRADAS * 4096 ? LATENCIA_ELEMENTOS : LATENCIA_MIN_ENTRADAS * 4096;
+    long comparacoes, trocas;
+
+    int *originais = malloc(maior_conjunto * sizeof(int));
+    int *trabalho = malloc(maior_conjunto * sizeof(int));
+    double *amostras = malloc(LATENCIA_AMOSTRAS * sizeof(double));
+    HistogramaHDR *individual = malloc(sizeof(HistogramaHDR));
+    if (!originais || !trabalho || !amostras || !individual)
+    {
+        printf("Erro ao alocar memoria!\n");
+        free(originais);
+        free(trabalho);
+        free(amostras);
+        free(individual);
+        return;
+    }
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+    nomeArquivoLongo(nomeCSV, sizeof(nomeCSV), programa, "latencia", info);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do benchmark de latencia.\n");
+        free(originais);
+        free(trabalho);
+        free(amostras);
+        free(individual);
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "modo;tamanho;entradas;amostras;min_ns;p50_ns;p90_ns;p99_ns;p999_ns;max_ns;ciclos_p50;variante\n");
+
+    double ciclos_por_ns = tscCiclosPorNs();
+    unsigned long long sobrecarga = tscSobrecarga();
+
+    printf("\n========================================\n");
+    printf("   LATENCIA DE ORDENACOES PEQUENAS (TSC)\n");
+    printf("========================================\n");
+    printf("TSC: %.3f GHz%s | leitura lfence/rdtscp: %.1f ns | par clock_gettime: %.1f ns\n",
+           ciclos_por_ns, tscInvariante() ? "" : " (AVISO: TSC nao invariante, resultados aproximados)",
+           ciclosParaNs(sobrecarga), relogioSobrecargaNs());
+    printf("%-10s %6s %8s %10s %10s %10s %10s %10s %10s\n",
+           "modo", "n", "entradas", "min(ns)", "p50(ns)", "p90(ns)", "p99(ns)", "p99.9(ns)", "max(ns)");
+
+    for (int t = 0; t < num_tamanhos; t++)
+    {
+        int tamanho = tamanhos[t];
+        int entradas = LATENCIA_ELEMENTOS / tamanho;
+        if (entradas < LATENCIA_MIN_ENTRADAS)
+            entradas = LATENCIA_MIN_ENTRADAS;
+        size_t bytes = (size_t)entradas * tamanho * sizeof(int);
+
+        gerar(originais, 3, entradas * tamanho);
+
+        /* Aquecimento: uma passada completa pelo conjunto */
+        memcpy(trabalho, originais, bytes);
+        for (int e = 0; e < entradas; e++)
+            ordenar(&trabalho[e * tamanho], tamanho, &comparacoes, &trocas);
+
+        /* Modo lote: cada amostra é a média por chamada de uma passada pelo conjunto */
+        for (int a = 0; a < LATENCIA_AMOSTRAS; a++)
+        {
+            memcpy(trabalho, originais, bytes);
+            unsigned long long inicio = lerCiclosInicio();
+            for (int e = 0; e < entradas; e++)
+                ordenar(&trabalho[e * tamanho], tamanho, &comparacoes, &trocas);
+            unsigned long long fim = lerCiclosFim();
+            amostras[a] = ciclosParaNs(fim - inicio - sobrecarga) / entradas;
+        }
+        qsort(amostras, LATENCIA_AMOSTRAS, sizeof(double), compararDoubleLongo);
+
+        double lote[6] = {amostras[0],
+                          percentilOrdenado(amostras, LATENCIA_AMOSTRAS, 50.0),
+                          percentilOrdenado(amostras, LATENCIA_AMOSTRAS, 90.0),
+                          percentilOrdenado(amostras, LATENCIA_AMOSTRAS, 99.0),
+                          percentilOrdenado(amostras, LATENCIA_AMOSTRAS, 99.9),
+                          amostras[LATENCIA_AMOSTRAS - 1]};
+
+        /* Modo individual: cada chamada medida sozinha; as amostras vão para um histograma HDR */
+        hdrZerar(individual);
+        for (int a = 0; a < LATENCIA_AMOSTRAS; a++)
+        {
+            memcpy(trabalho, originais, bytes);
+            for (int e = 0; e < entradas; e++)
+            {
+                unsigned long long inicio = lerCiclosInicio();
+                ordenar(&trabalho[e * tamanho], tamanho, &comparacoes, &trocas);
+                unsigned long long fim = lerCiclosFim();
+                unsigned long long ciclos = fim - inicio > sobrecarga ? fim - inicio - sobrecarga : 0;
+                hdrRegistrar(individual, (unsigned long long)(ciclosParaNs(ciclos) + 0.5));
+            }
+        }
+
+        double unitario[6] = {(double)individual->minimo,
+                              (double)hdrPercentil(individual, 50.0),
+                              (double)hdrPercentil(individual, 90.0),
+                              (double)hdrPercentil(individual, 99.0),
+                              (double)hdrPercentil(individual, 99.9),
+                              (double)individual->maximo};
+
+        const char *modos[] = {"lote", "individual"};
+        double *valores[] = {lote, unitario};
+        int quantidades[] = {LATENCIA_AMOSTRAS, (int)individual->total};
+        for (int m = 0; m < 2; m++)
+        {
+            double *x = valores[m];
+            printf("%-10s %6d %8d %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+                   modos[m], tamanho, entradas, x[0], x[1], x[2], x[3], x[4], x[5]);
+            fprintf(csv, "%s;%d;%d;%d;%.1f;%.1f;%.1f;%.1f;%.1f;%.1f;%.0f;%s\n",
+                    modos[m], tamanho, entradas, quantidades[m], x[0], x[1], x[2], x[3], x[4], x[5],
+                    x[1] * ciclos_por_ns, variante);
+        }
+    }
+
+    fclose(csv);
+    printf("\nCSV do benchmark de latencia salvo em: %s\n", nomeCSV);
+
+    free(originais);
+    free(trabalho);
+    free(amostras);
+    free(individual);
+}
+
+#endif
@@ -13,12 +13,31 @@ projeto/
     └── graphics/
         ├── shellSort/     (gráficos gerados do Shell Sort)
         └── cycleSort/     (gráficos gerados do Cycle Sort)
+
+GERAÇÃO PARALELA E INCREMENTAL:
+Cada algoritmo é dividido em tarefas independentes (um gráfico individual por
+cenário, o conjunto de gráficos comparativos, o perfil por passo e a
+hierarquia de cache), executadas em processos separados. O arquivo
+manifesto_graficos.json de cada pasta de gráficos guarda o SHA-256 dos CSVs
+de entrada (e deste script) de cada tarefa; tarefas cujas entradas não mudaram
+e cujas imagens ainda existem são puladas.
+
+USO (a partir da pasta src/):
+    python3 gerar_graficos.py                      # menu interativo
+    python3 gerar_graficos.py todos [--forcar]     # sem menu (shellsort, cyclesort ou todos)
 """
 
 import pandas as pd
 import numpy as np
+import matplotlib
+matplotlib.use('Agg')  # Só grava arquivos; necessário nos processos de trabalho sem display
 import matplotlib.pyplot as plt
+import hashlib
+import json
 import os
+import sys
+from concurrent.futures import ProcessPoolExecutor, as_completed
+from io import StringIO
 from pathlib import Path
 
 # Configuração do estilo do matplotlib
@@ -51,6 +70,9 @@ CONFIG_ALGORITMOS = {
     }
 }
 
+ARQUIVO_MANIFESTO = "manifesto_graficos.json"
+MAX_PROCESSOS = os.cpu_count() or 1
+
 # ============================================
 # FUNÇÕES DE PROCESSAMENTO DE DADOS
 # ============================================
@@ -61,7 +83,8 @@ def processar_dados(csv_path, algoritmo_nome):
     Baseado no código original que funciona.
     """
     print(f"Carregando arquivo: {csv_path}")
-    df = pd.read_csv(csv_path, sep=';', na_filter=False)
+    # Linhas '#' são o cabeçalho de ambiente (ambiente.h) gravado pelos programas
+    df = pd.read_csv(csv_path, sep=';', na_filter=False, comment='#')
 
     print(f"\nInformações do DataFrame:")
     print(f"Total de linhas: {len(df)}")
@@ -89,6 +112,11 @@ def processar_dados(csv_path, algoritmo_nome):
     print(f"\nDados brutos: {len(df_raw)} linhas")
     print(f"Dados estatísticos: {len(df_stats)} linhas")
 
+    # Variante dos kernels (escalar, sentinela/sem_desvio, avx2, avx512) registrada em cada linha
+    if 'variante' in df_raw.columns:
+        variantes = sorted(v for v in df_raw['variante'].astype(str).str.strip().unique() if v)
+        print(f"Variantes dos kernels: {', '.join(variantes)}")
+
     # Mostrar as estatísticas
     if len(df_stats) > 0:
         print(f"\n ✅Dados estatísticos encontrados:")
@@ -762,13 +790,226 @@ def criar_graficos_comparativos(df_stats, output_dir, algoritmo_nome, cores_cena
     
     return arquivos_gerados
 
+def criar_grafico_passos(csv_path, output_dir, algoritmo_nome, cores_cenarios):
+    """
+    Cria o gráfico de custo por passo (gap) a partir do CSV de passos (o mais recente,
+    escolhido em preparar_algoritmo). Mostra, para o maior tamanho medido, a fração dos
+    ciclos gastos em cada gap e as trocas por elemento de cada gap, separadas por cenário.
+    """
+    print(f"\n Criando gráfico de perfil por passo a partir de: {csv_path.name}")
+
+    df = pd.read_csv(csv_path, sep=';', comment='#')
+    df['cenario'] = df['cenario'].astype(str).str.strip()
+
+    # Descartar a repetição de warm-up, como nas estatísticas do CSV geral
+    df = df[df['repeticao'] > 1]
+    if df.empty:
+        print(" ⚠️ CSV de passos sem repetições válidas")
+        return None
+
+    tamanho = df['tamanho'].max()
+    df = df[df['tamanho'] == tamanho]
+
+    medias = df.groupby(['cenario', 'h'], as_index=False)[['comparacoes', 'trocas', 'ciclos']].mean()
+    medias['fracao_ciclos'] = medias['ciclos'] / medias.groupby('cenario')['ciclos'].transform('sum') * 100
+    medias['trocas_por_elemento'] = medias['trocas'] / tamanho
+
+    # Gaps na ordem em que são executados (do maior para o menor)
+    gaps = sorted(medias['h'].unique(), reverse=True)
+    cenarios = list(medias['cenario'].unique())
+    x = np.arange(len(gaps))
+    largura = 0.8 / max(len(cenarios), 1)
+
+    fig, axes = plt.subplots(2, 1, figsize=(14, 10), sharex=True)
+    fig.suptitle(f'Custo por Passo (gap) - {algoritmo_nome}\nTamanho: {tamanho:,} elementos',
+                 fontsize=16, fontweight='bold')
+
+    for i, cenario_str in enumerate(cenarios):
+        subset = medias[medias['cenario'] == cenario_str].set_index('h').reindex(gaps).fillna(0)
+        cor = cores_cenarios.get(cenario_str, 'gray')
+        label = cenario_str.capitalize() if cenario_str in cores_cenarios else cenario_str
+        deslocamento = (i - (len(cenarios) - 1) / 2) * largura
+
+        axes[0].bar(x + deslocamento, subset['fracao_ciclos'], width=largura, color=cor, label=label)
+        axes[1].bar(x + deslocamento, subset['trocas_por_elemento'], width=largura, color=cor, label=label)
+
+    axes[0].set_ylabel('Ciclos do Passo (% do total)', fontsize=12, fontweight='bold')
+    axes[0].set_title('Fração do Tempo (ciclos) Gasta em Cada Gap')
+    axes[0].legend(title='Cenário', title_fontsize=12, fontsize=11)
+    axes[0].grid(True, alpha=0.3, axis='y')
+
+    axes[1].set_ylabel('Trocas por Elemento', fontsize=12, fontweight='bold')
+    axes[1].set_title('Movimentações por Elemento em Cada Gap')
+    axes[1].set_xlabel('Gap (h), na ordem de execução', fontsize=12, fontweight='bold')
+    axes[1].set_xticks(x)
+    axes[1].set_xticklabels([str(h) for h in gaps])
+    axes[1].grid(True, alpha=0.3, axis='y')
+
+    filename = f'{algoritmo_nome.lower().replace(" ", "_")}_perfil_passos.png'
+    plt.tight_layout()
+    plt.savefig(output_dir / filename, dpi=300, bbox_inches='tight')
+    plt.close()
+    print(f"  ✅ Gráfico de passos salvo: {filename}")
+
+    return filename
+
+def carregar_csv_hierarquia(csv_path):
+    """
+    Lê o CSV do benchmark de hierarquia de cache: a tabela de medições e, após a linha em
+    branco, a tabela dos níveis de cache (nivel;tipo;bytes). Retorna (medicoes, niveis).
+    """
+    with open(csv_path, encoding='utf-8') as arquivo:
+        linhas = [linha for linha in arquivo if not linha.startswith('#')]
+    blocos = ''.join(linhas).strip().split('\n\n')
+    medicoes = pd.read_csv(StringIO(blocos[0]), sep=';')
+    niveis = pd.read_csv(StringIO(blocos[1]), sep=';') if len(blocos) > 1 else pd.DataFrame(columns=['nivel', 'tipo', 'bytes'])
+    return medicoes, niveis
+
+def criar_grafico_hierarquia(csv_path, output_dir, algoritmo_nome, cores_cenarios):
+    """
+    Cria o gráfico de escalabilidade na hierarquia de cache a partir do CSV de hierarquia
+    (o mais recente): elementos/s e largura de banda efetiva por tamanho do vetor, uma curva
+    por variante, com linhas verticais nas fronteiras de L1, L2, L3... lidas pelo benchmark.
+    Os níveis acima do maior vetor medido são citados na legenda; no Cycle Sort (gaps '-'),
+    o custo Θ(n²) limita a faixa a L1/L2 por padrão.
+    """
+    print(f"\n Criando gráfico de hierarquia de cache a partir de: {csv_path.name}")
+
+    medicoes, niveis = carregar_csv_hierarquia(csv_path)
+    if medicoes.empty:
+        print(" ⚠️ CSV de hierarquia sem medições")
+        return None
+    medicoes['variante'] = medicoes['variante'].astype(str).str.strip()
+    gaps = str(medicoes['gaps'].iloc[0]).strip()
+    quadratico = gaps == '-'
+    maior_kb = medicoes['bytes_vetor'].max() / 1024
+
+    fig, axes = plt.subplots(2, 1, figsize=(14, 10), sharex=True)
+    subtitulo = (f'Θ(n²): vetores até {maior_kb:.0f} KB' if quadratico else f'Gaps: {gaps}')
+    fig.suptitle(f'Escalabilidade na Hierarquia de Cache - {algoritmo_nome}\n{subtitulo}',
+                 fontsize=16, fontweight='bold')
+
+    cores = plt.rcParams['axes.prop_cycle'].by_key()['color']
+    for i, variante in enumerate(medicoes['variante'].unique()):
+        subset = medicoes[medicoes['variante'] == variante].sort_values('bytes_vetor')
+        kb = subset['bytes_vetor'] / 1024
+        cor = cores[i % len(cores)]
+        axes[0].plot(kb, subset['elementos_por_s'] / 1e6, marker='o', linewidth=2, color=cor, label=variante)
+        axes[1].plot(kb, subset['largura_banda_gbs'], marker='s', linewidth=2, color=cor, label=variante)
+
+    # Fronteiras dos níveis de cache (só as que caem na faixa medida, para não distorcer o eixo)
+    fora_da_faixa = []
+    for _, nivel in niveis.iterrows():
+        kb = nivel['bytes'] / 1024
+        if kb > maior_kb:
+            print(f"  ℹ️ L{nivel['nivel']} ({kb:.0f} KB) fora da faixa medida")
+            fora_da_faixa.append(f"L{nivel['nivel']}")
+            continue
+        rotulo = f"L{nivel['nivel']}{'d' if nivel['tipo'] == 'Data' else ''}"
+        tamanho = f"{kb / 1024:.0f} MB" if kb >= 1024 else f"{kb:.0f} KB"
+        for ax in axes:
+            ax.axvline(kb, color='black', linestyle='--', linewidth=1, alpha=0.6)
+        axes[0].annotate(f'{rotulo} ({tamanho})', xy=(kb, 1), xycoords=('data', 'axes fraction'),
+                         xytext=(4, -4), textcoords='offset points', ha='left', va='top', fontsize=10,
+                         fontweight='bold')
+
+    axes[0].set_ylabel('Milhões de Elementos por Segundo', fontsize=12, fontweight='bold')
+    axes[0].set_title('Vazão da Ordenação')
+    titulo_legenda = 'Variante'
+    if fora_da_faixa:
+        motivo = ' (custo Θ(n²))' if quadratico else ''
+        titulo_legenda += f"\n{', '.join(fora_da_faixa)} não medidos{motivo}"
+    axes[0].legend(title=titulo_legenda, title_fontsize=12, fontsize=11)
+    axes[0].grid(True, alpha=0.3)
+
+    axes[1].set_ylabel('Largura de Banda Efetiva (GB/s)', fontsize=12, fontweight='bold')
+    axes[1].set_title('Bytes Acessados por Segundo (leitura por comparação + escrita por deslocamento)')
+    axes[1].set_xlabel('Tamanho do Vetor (KB, escala log)', fontsize=12, fontweight='bold')
+    axes[1].set_xscale('log', base=2)
+    axes[1].grid(True, alpha=0.3)
+
+    filename = f'{algoritmo_nome.lower().replace(" ", "_")}_hierarquia_cache.png'
+    plt.tight_layout()
+    plt.savefig(output_dir / filename, dpi=300, bbox_inches='tight')
+    plt.close()
+    print(f"  ✅ Gráfico de hierarquia de cache salvo: {filename}")
+
+    return filename
+
+# ============================================
+# MANIFESTO E TAREFAS PARALELAS
+# ============================================
+
+def hash_arquivo(caminho):
+    """
+    SHA-256 do conteúdo de um arquivo (lido em blocos, sem carregar tudo na memória).
+    """
+    h = hashlib.sha256()
+    with open(caminho, 'rb') as arquivo:
+        for bloco in iter(lambda: arquivo.read(1 << 20), b''):
+            h.update(bloco)
+    return h.hexdigest()
+
+
+def carregar_manifesto(output_dir):
+    caminho = output_dir / ARQUIVO_MANIFESTO
+    try:
+        with open(caminho, encoding='utf-8') as arquivo:
+            return json.load(arquivo)
+    except (OSError, ValueError):
+        return {}
+
+
+def salvar_manifesto(output_dir, manifesto):
+    caminho = output_dir / ARQUIVO_MANIFESTO
+    temporario = caminho.with_suffix('.tmp')
+    with open(temporario, 'w', encoding='utf-8') as arquivo:
+        json.dump(manifesto, arquivo, indent=2, sort_keys=True)
+    os.replace(temporario, caminho)  # Troca atômica: um manifesto interrompido não é lido pela metade
+
+
+def tarefa_atualizada(manifesto, tarefa, output_dir):
+    """
+    Uma tarefa pode ser pulada se foi executada com as mesmas entradas (e o mesmo script)
+    e todas as imagens que ela gerou ainda existem.
+    """
+    registro = manifesto.get(tarefa['id'])
+    if not registro or registro.get('assinatura') != tarefa['assinatura']:
+        return False
+    return bool(registro.get('saidas')) and all((output_dir / nome).exists() for nome in registro['saidas'])
+
+
+def executar_tarefa(tarefa):
+    """
+    Executa uma tarefa de gráfico num processo de trabalho.
+    Retorna (id da tarefa, lista de imagens geradas).
+    """
+    tipo = tarefa['tipo']
+    if tipo == 'individual':
+        nome = plot_individual_scenario(tarefa['cenario'], tarefa['df_stats'], tarefa['output_dir'],
+                                        tarefa['algoritmo_nome'], tarefa['cores_cenarios'])
+        saidas = [nome] if nome else []
+    elif tipo == 'comparativos':
+        saidas = criar_graficos_comparativos(tarefa['df_stats'], tarefa['output_dir'],
+                                             tarefa['algoritmo_nome'], tarefa['cores_cenarios'])
+    elif tipo == 'hierarquia':
+        nome = criar_grafico_hierarquia(tarefa['csv_path'], tarefa['output_dir'],
+                                        tarefa['algoritmo_nome'], tarefa['cores_cenarios'])
+        saidas = [nome] if nome else []
+    else:
+        nome = criar_grafico_passos(tarefa['csv_path'], tarefa['output_dir'],
+                                    tarefa['algoritmo_nome'], tarefa['cores_cenarios'])
+        saidas = [nome] if nome else []
+    return tarefa['id'], saidas
+
 # ============================================
 # FUNÇÃO PRINCIPAL PARA PROCESSAR UM ALGORITMO
 # ============================================
 
-def processar_algoritmo(algoritmo_key):
+def preparar_algoritmo(algoritmo_key):
     """
-    Processa um algoritmo específico e gera todos os gráficos.
+    Seleciona os CSVs mais recentes de um algoritmo, processa os dados e monta a lista
+    de tarefas de gráfico. Retorna um dicionário com o contexto do algoritmo, ou None.
     """
     print(f"\n{'='*60}")
     print(f"PROCESSANDO: {algoritmo_key.upper()}")
@@ -778,7 +1019,7 @@ def processar_algoritmo(algoritmo_key):
     config = CONFIG_ALGORITMOS.get(algoritmo_key)
     if not config:
         print(f"⚠️ Algoritmo '{algoritmo_key}' não configurado!")
-        return False
+        return None
     
     algoritmo_nome = config["nome"]
     pasta_files = config["pasta_files"]
@@ -793,13 +1034,13 @@ def processar_algoritmo(algoritmo_key):
     files_dir = project_root / "results" / "files" / pasta_files
     if not files_dir.exists():
         print(f"⚠️ Pasta não encontrada: {files_dir}")
-        return False
+        return None
     
-    # Listar arquivos CSV
-    arquivos_csv = list(files_dir.glob("*.csv"))
+    # Listar arquivos CSV gerais (os CSVs de perfil por passo são lidos à parte)
+    arquivos_csv = list(files_dir.glob("*_geral_*.csv"))
     if not arquivos_csv:
         print(f"⚠️ Nenhum arquivo CSV encontrado em: {files_dir}")
-        return False
+        return None
     
     # Usar o arquivo mais recente
     csv_path = max(arquivos_csv, key=os.path.getmtime)
@@ -810,64 +1051,143 @@ def processar_algoritmo(algoritmo_key):
     
     print(f" Pasta de saída: {output_dir}")
     
-    # Processar dados
-    try:
-        df_raw, df_stats = processar_dados(csv_path, algoritmo_nome)
-        
-        if len(df_stats) == 0:
-            print(f" ⚠️ Nenhum dado estatístico disponível para {algoritmo_nome}")
-            return False
-        
-        # Criar gráficos para cada cenário
-        cenarios_unicos = df_stats['cenario'].unique()
-        print(f"\n ✅ Criando gráficos individuais para {len(cenarios_unicos)} cenários...")
-        
-        arquivos_individuais = []
-        for i, cenario in enumerate(cenarios_unicos, 1):
-            print(f"  {i}. Processando cenário: '{cenario}'")
-            filename = plot_individual_scenario(cenario, df_stats, output_dir, 
-                                               algoritmo_nome, cores_cenarios)
-            if filename:
-                arquivos_individuais.append(filename)
-        
-        # Criar gráficos comparativos
-        arquivos_comparativos = criar_graficos_comparativos(df_stats, output_dir, 
-                                                           algoritmo_nome, cores_cenarios)
-        
-        # Exibir estatísticas básicas
-        print(f"\n Estatísticas por Cenário - {algoritmo_nome}:")
-        print("-" * 60)
-        
-        for cenario in sorted(cenarios_unicos):
-            cenario_str = str(cenario)
-            subset = df_stats[df_stats['cenario'] == cenario_str] 
-            
-            if not subset.empty:
-                print(f"\n Cenário: {cenario_str.upper()}")
-                print(f"  Tamanhos analisados: {', '.join(map(str, sorted(subset['tamanho'].unique())))}")
-                
-                max_tamanho = subset['tamanho'].max()
-                tempo_max = subset[subset['tamanho'] == max_tamanho]['media_tempo_ms'].values[0]
-                print(f"  Tempo para {max_tamanho:,} elementos: {tempo_max:.2f} ms")
-                
-                comparacoes_por_elemento = subset[subset['tamanho'] == max_tamanho]['media_comparacoes'].values[0] / max_tamanho
-                print(f"  Comparações por elemento: {comparacoes_por_elemento:.1f}")
-                
-                trocas_por_elemento = subset[subset['tamanho'] == max_tamanho]['media_trocas'].values[0] / max_tamanho
-                print(f"  Trocas por elemento: {trocas_por_elemento:.1f}")
-        
-        # Contar gráficos gerados
-        total_graficos = len(list(output_dir.glob('*.png')))
-        print(f"\n✅ {algoritmo_nome} - Processamento concluído com sucesso!")
-        print(f" Total de gráficos gerados: {total_graficos}")
-        
-        return True
+    df_raw, df_stats = processar_dados(csv_path, algoritmo_nome)
+    if len(df_stats) == 0:
+        print(f" ⚠️ Nenhum dado estatístico disponível para {algoritmo_nome}")
+        return None
+
+    # A assinatura de cada tarefa combina o conteúdo das entradas com o deste script,
+    # para que mudanças no código dos gráficos também os regenerem
+    hash_script = hash_arquivo(Path(__file__).resolve())
+    hash_geral = hash_arquivo(csv_path)
+    base = {'output_dir': output_dir, 'algoritmo_nome': algoritmo_nome, 'cores_cenarios': cores_cenarios}
+
+    cenarios_unicos = df_stats['cenario'].unique()
+    tarefas = []
+    for cenario in cenarios_unicos:
+        tarefas.append(dict(base, id=f"individual:{cenario}", tipo='individual', cenario=cenario,
+                            df_stats=df_stats, assinatura=f"{hash_geral}:{hash_script}"))
+    tarefas.append(dict(base, id="comparativos", tipo='comparativos', df_stats=df_stats,
+                        assinatura=f"{hash_geral}:{hash_script}"))
+
+    # Gráfico de perfil por passo (gap), se houver CSV de passos
+    arquivos_passos = list(files_dir.glob("*_passos_*.csv"))
+    if arquivos_passos:
+        csv_passos = max(arquivos_passos, key=os.path.getmtime)
+        tarefas.append(dict(base, id="passos", tipo='passos', csv_path=csv_passos,
+                            assinatura=f"{hash_arquivo(csv_passos)}:{hash_script}"))
+    else:
+        print(f"\n ℹ️ Nenhum CSV de passos encontrado para {algoritmo_nome}")
+
+    # Gráfico de hierarquia de cache, se houver CSV do benchmark de hierarquia
+    arquivos_hierarquia = list(files_dir.glob("*_hierarquia_*.csv"))
+    if arquivos_hierarquia:
+        csv_hierarquia = max(arquivos_hierarquia, key=os.path.getmtime)
+        tarefas.append(dict(base, id="hierarquia", tipo='hierarquia', csv_path=csv_hierarquia,
+                            assinatura=f"{hash_arquivo(csv_hierarquia)}:{hash_script}"))
+
+    return {'nome': algoritmo_nome, 'output_dir': output_dir, 'df_stats': df_stats, 'tarefas': tarefas}
+
+
+def exibir_resumo(contexto):
+    """
+    Exibe as estatísticas básicas por cenário de um algoritmo já processado.
+    """
+    algoritmo_nome = contexto['nome']
+    df_stats = contexto['df_stats']
+    output_dir = contexto['output_dir']
+
+    print(f"\n Estatísticas por Cenário - {algoritmo_nome}:")
+    print("-" * 60)
+    
+    for cenario in sorted(df_stats['cenario'].unique()):
+        cenario_str = str(cenario)
+        subset = df_stats[df_stats['cenario'] == cenario_str] 
         
-    except Exception as e:
-        print(f"❌ Erro ao processar {algoritmo_nome}: {str(e)}")
-        import traceback
-        traceback.print_exc()
-        return False
+        if not subset.empty:
+            print(f"\n Cenário: {cenario_str.upper()}")
+            print(f"  Tamanhos analisados: {', '.join(map(str, sorted(subset['tamanho'].unique())))}")
+            
+            max_tamanho = subset['tamanho'].max()
+            tempo_max = subset[subset['tamanho'] == max_tamanho]['media_tempo_ms'].values[0]
+            print(f"  Tempo para {max_tamanho:,} elementos: {tempo_max:.2f} ms")
+            
+            comparacoes_por_elemento = subset[subset['tamanho'] == max_tamanho]['media_comparacoes'].values[0] / max_tamanho
+            print(f"  Comparações por elemento: {comparacoes_por_elemento:.1f}")
+            
+            trocas_por_elemento = subset[subset['tamanho'] == max_tamanho]['media_trocas'].values[0] / max_tamanho
+            print(f"  Trocas por elemento: {trocas_por_elemento:.1f}")
+    
+    # Contar gráficos gerados
+    total_graficos = len(list(output_dir.glob('*.png')))
+    print(f"\n✅ {algoritmo_nome} - Processamento concluído com sucesso!")
+    print(f" Total de gráficos gerados: {total_graficos}")
+
+
+def processar_algoritmos(algoritmo_keys, forcar=False):
+    """
+    Gera os gráficos de um ou mais algoritmos: as tarefas de todos eles são distribuídas
+    num único conjunto de processos, e as que não mudaram desde a última execução são puladas.
+    Retorna {algoritmo_key: sucesso}.
+    """
+    sucesso = {}
+    contextos = {}
+    for algoritmo_key in algoritmo_keys:
+        try:
+            contexto = preparar_algoritmo(algoritmo_key)
+        except Exception as e:
+            print(f"❌ Erro ao processar {algoritmo_key}: {str(e)}")
+            import traceback
+            traceback.print_exc()
+            contexto = None
+        sucesso[algoritmo_key] = contexto is not None
+        if contexto:
+            contextos[algoritmo_key] = contexto
+
+    # Separar tarefas pendentes das que podem ser puladas
+    manifestos = {}
+    pendentes = []
+    for algoritmo_key, contexto in contextos.items():
+        manifesto = carregar_manifesto(contexto['output_dir'])
+        manifestos[algoritmo_key] = manifesto
+        for tarefa in contexto['tarefas']:
+            if not forcar and tarefa_atualizada(manifesto, tarefa, contexto['output_dir']):
+                print(f" ⏭️  {contexto['nome']} - {tarefa['id']}: entradas inalteradas, gráfico mantido")
+            else:
+                pendentes.append((algoritmo_key, tarefa))
+
+    if pendentes:
+        processos = min(len(pendentes), MAX_PROCESSOS)
+        print(f"\n Gerando {len(pendentes)} tarefa(s) de gráfico em {processos} processo(s)...")
+        with ProcessPoolExecutor(max_workers=processos) as executor:
+            futuros = {executor.submit(executar_tarefa, tarefa): (algoritmo_key, tarefa)
+                       for algoritmo_key, tarefa in pendentes}
+            for futuro in as_completed(futuros):
+                algoritmo_key, tarefa = futuros[futuro]
+                try:
+                    _, saidas = futuro.result()
+                except Exception as e:
+                    print(f"❌ Erro na tarefa {tarefa['id']} de {contextos[algoritmo_key]['nome']}: {str(e)}")
+                    sucesso[algoritmo_key] = False
+                    continue
+                # Só tarefas concluídas entram no manifesto; uma falha é refeita na próxima execução
+                manifestos[algoritmo_key][tarefa['id']] = {'assinatura': tarefa['assinatura'], 'saidas': saidas}
+    else:
+        print("\n ✅ Nenhuma entrada mudou: todos os gráficos estão atualizados.")
+
+    for algoritmo_key, contexto in contextos.items():
+        salvar_manifesto(contexto['output_dir'], manifestos[algoritmo_key])
+        if sucesso[algoritmo_key]:
+            exibir_resumo(contexto)
+
+    return sucesso
+
+
+def processar_algoritmo(algoritmo_key, forcar=False):
+    """
+    Processa um algoritmo específico e gera todos os gráficos.
+    """
+    return processar_algoritmos([algoritmo_key], forcar)[algoritmo_key]
 
 # ============================================
 # MENU PRINCIPAL
@@ -875,8 +1195,21 @@ def processar_algoritmo(algoritmo_key):
 
 def main():
     """
-    Função principal com menu interativo.
+    Função principal com menu interativo. Com argumentos (shellsort, cyclesort ou todos),
+    gera os gráficos sem menu; --forcar ignora o manifesto e refaz todos os gráficos.
     """
+    argumentos = [arg for arg in sys.argv[1:] if arg != "--forcar"]
+    forcar = "--forcar" in sys.argv[1:]
+    if argumentos:
+        chaves = list(CONFIG_ALGORITMOS) if argumentos[0] == "todos" else argumentos
+        invalidas = [chave for chave in chaves if chave not in CONFIG_ALGORITMOS]
+        if invalidas:
+            print(f"❌ Algoritmo(s) desconhecido(s): {', '.join(invalidas)} "
+                  f"(use {', '.join(CONFIG_ALGORITMOS)} ou todos)")
+            sys.exit(2)
+        sucesso = processar_algoritmos(chaves, forcar)
+        sys.exit(0 if all(sucesso.values()) else 1)
+
     print("\n" + "="*60)
     print(" GERADOR DE GRÁFICOS PARA ALGORITMOS DE ORDENAÇÃO")
     print("="*60)
@@ -907,7 +1240,7 @@ def main():
                 print("\n" + "🔵"*30)
                 print("🔵 GERANDO GRÁFICOS PARA SHELL SORT")
                 print("🔵"*30)
-                sucesso = processar_algoritmo("shellsort")
+                sucesso = processar_algoritmo("shellsort", forcar)
                 if sucesso:
                     print("\n✅ Shell Sort processado com sucesso!")
                 break
@@ -916,7 +1249,7 @@ def main():
                 print("\n" + "🟣"*30)
                 print("🟣 GERANDO GRÁFICOS PARA CYCLE SORT")
                 print("🟣"*30)
-                sucesso = processar_algoritmo("cyclesort")
+                sucesso = processar_algoritmo("cyclesort", forcar)
                 if sucesso:
                     print("\n✅ Cycle Sort processado com sucesso!")
                 break
@@ -926,16 +1259,10 @@ def main():
                 print("🟡 GERANDO GRÁFICOS PARA TODOS OS ALGORITMOS")
                 print("🟡"*30)
                 
-                sucesso_shell = processar_algoritmo("shellsort")
-                
-                if sucesso_shell:
-                    print("\n" + "-"*60)
-                    print("CONTINUANDO COM O PRÓXIMO ALGORITMO...")
-                    print("-"*60)
-                
-                sucesso_cycle = processar_algoritmo("cyclesort")
+                # Os dois algoritmos dividem o mesmo conjunto de processos
+                sucesso = processar_algoritmos(["shellsort", "cyclesort"], forcar)
                 
-                if sucesso_shell and sucesso_cycle:
+                if all(sucesso.values()):
                     print("\n" + "✅"*30)
                     print("✅ TODOS OS GRÁFICOS FORAM GERADOS COM SUCESSO!")
                     print("✅"*30)
@@ -0,0 +1,225 @@
+"""
+GERADOR DE REDES DE ORDENAÇÃO
+=============================
+Gera o cabeçalho redesOrdenacao.h com redes de ordenação para tamanhos fixos
+(REDE_TAM_MIN a REDE_TAM_MAX) na forma de sequências desenroladas de
+comparadores min/max, sem desvios dependentes dos dados.
+
+As redes seguem a construção odd-even merge de Batcher sobre a próxima potência
+de 2, descartando os comparadores que envolvem posições inexistentes (equivale a
+completar o vetor com +infinito). Cada rede é validada pelo princípio 0-1 antes
+de ser escrita.
+
+Para cada tamanho são geradas três variantes:
+  - escalar: ordena um vetor de n inteiros;
+  - AVX2: ordena 8 vetores intercalados (uma lane por vetor) em n registradores;
+  - AVX-512: ordena 16 vetores intercalados da mesma forma.
+
+USO (a partir da pasta src/):
+    python3 gerar_redes.py
+"""
+
+import random
+from pathlib import Path
+
+# ============================================
+# CONFIGURAÇÕES
+# ============================================
+
+REDE_TAM_MIN = 2
+REDE_TAM_MAX = 32
+MAX_EXAUSTIVO = 24          # Até este tamanho, todas as 2^n entradas 0-1 são testadas
+TESTES_ALEATORIOS = 2000    # Acima dele, testa permutações aleatórias
+ARQUIVO_SAIDA = Path(__file__).resolve().parent / "redesOrdenacao.h"
+
+# ============================================
+# CONSTRUÇÃO E VALIDAÇÃO DAS REDES
+# ============================================
+
+def rede_batcher(n):
+    """
+    Retorna a lista de comparadores (i, j), i < j, da rede odd-even merge de
+    Batcher para n entradas.
+    """
+    p = 1
+    while p < n:
+        p *= 2
+
+    comparadores = []
+    bloco = 1
+    while bloco < p:
+        k = bloco
+        while k >= 1:
+            for j in range(k % bloco, p - k, 2 * k):
+                for i in range(min(k, p - j - k)):
+                    if (i + j) // (2 * bloco) == (i + j + k) // (2 * bloco):
+                        a, b = i + j, i + j + k
+                        if b < n:
+                            comparadores.append((a, b))
+            k //= 2
+        bloco *= 2
+
+    return comparadores
+
+
+def separar_camadas(comparadores):
+    """
+    Agrupa os comparadores em camadas de comparadores independentes,
+    preservando a ordem de dependência entre eles.
+    """
+    ultima_camada = {}
+    camadas = []
+    for a, b in comparadores:
+        camada = max(ultima_camada.get(a, -1), ultima_camada.get(b, -1)) + 1
+        if camada == len(camadas):
+            camadas.append([])
+        camadas[camada].append((a, b))
+        ultima_camada[a] = ultima_camada[b] = camada
+    return camadas
+
+
+def validar_rede(n, comparadores):
+    """
+    Valida a rede pelo princípio 0-1. Para n pequeno, testa as 2^n entradas
+    de uma vez com máscaras de bits (bit x do fio i = bit i da entrada x).
+    """
+    if n <= MAX_EXAUSTIVO:
+        total = 1 << n
+        fios = []
+        for i in range(n):
+            # Padrão periódico: 2^i zeros seguidos de 2^i uns, replicado até 2^n bits
+            mascara = ((1 << (1 << i)) - 1) << (1 << i)
+            largura = 1 << (i + 1)
+            while largura < total:
+                mascara |= mascara << largura
+                largura *= 2
+            fios.append(mascara)
+
+        for a, b in comparadores:
+            fios[a], fios[b] = fios[a] & fios[b], fios[a] | fios[b]
+
+        return all((fios[i] & ~fios[i + 1]) == 0 for i in range(n - 1))
+
+    gerador = random.Random(n)
+    for _ in range(TESTES_ALEATORIOS):
+        v = [gerador.randrange(4 * n) for _ in range(n)]
+        for a, b in comparadores:
+            if v[a] > v[b]:
+                v[a], v[b] = v[b], v[a]
+        if any(v[i] > v[i + 1] for i in range(n - 1)):
+            return False
+    return True
+
+# ============================================
+# GERAÇÃO DO CABEÇALHO
+# ============================================
+
+def gerar_funcao(nome, parametro, atributo, macro, camadas):
+    """
+    Gera o código C de uma rede, com uma camada de comparadores por linha.
+    """
+    linhas = [f"static inline {atributo}void {nome}({parametro})", "{"]
+    for camada in camadas:
+        linhas.append("    " + " ".join(f"{macro}({a}, {b});" for a, b in camada))
+    linhas.append("}")
+    return "\n".join(linhas)
+
+
+def gerar_tabela(tipo, nome, prefixo):
+    """
+    Gera a tabela indexada por tamanho com os ponteiros das funções de rede.
+    """
+    entradas = ["NULL"] * REDE_TAM_MIN + [f"{prefixo}{n}" for n in range(REDE_TAM_MIN, REDE_TAM_MAX + 1)]
+    corpo = ",\n    ".join(", ".join(entradas[i:i + 4]) for i in range(0, len(entradas), 4))
+    return f"static const {tipo} {nome}[REDE_TAM_MAX + 1] = {{\n    {corpo}}};"
+
+
+def main():
+    redes = {}
+    for n in range(REDE_TAM_MIN, REDE_TAM_MAX + 1):
+        comparadores = rede_batcher(n)
+        if not validar_rede(n, comparadores):
+            raise SystemExit(f"❌ Rede inválida para n = {n}")
+        redes[n] = separar_camadas(comparadores)
+        print(f"  n = {n:2d}: {len(comparadores):3d} comparadores, {len(redes[n]):2d} camadas ✅")
+
+    partes = [
+        "/*  ==================================================================",
+        " *  REDES DE ORDENAÇÃO PARA TAMANHOS FIXOS",
+        " *  Gerado automaticamente por gerar_redes.py -- NÃO EDITAR À MÃO.",
+        " *  Redes odd-even merge de Batcher, validadas pelo princípio 0-1.",
+        " *  Defina SIMD_X86 e inclua <x86intrin.h> antes deste cabeçalho para",
+        " *  habilitar as variantes AVX2 (8 vetores) e AVX-512 (16 vetores).",
+        " *  ==================================================================*/",
+        "#ifndef REDES_ORDENACAO_H",
+        "#define REDES_ORDENACAO_H",
+        "",
+        f"#define REDE_TAM_MIN {REDE_TAM_MIN}",
+        f"#define REDE_TAM_MAX {REDE_TAM_MAX}",
+        "",
+        "/* Comparador escalar: min/max sem desvio (compilado como cmov) */",
+        "#define REDE_CE(i, j)                       \\",
+        "    do                                      \\",
+        "    {                                       \\",
+        "        int a_ = v[i], b_ = v[j];           \\",
+        "        v[i] = a_ < b_ ? a_ : b_;           \\",
+        "        v[j] = a_ < b_ ? b_ : a_;           \\",
+        "    } while (0)",
+        "",
+        "typedef void (*FuncaoRede)(int v[]);",
+        "",
+        "/* Número de comparadores de cada rede, indexado pelo tamanho */",
+        "static const int redesComparadores[REDE_TAM_MAX + 1] = {"
+        + ", ".join(["0"] * REDE_TAM_MIN + [str(sum(len(c) for c in redes[n])) for n in range(REDE_TAM_MIN, REDE_TAM_MAX + 1)])
+        + "};",
+        "",
+    ]
+
+    for n in range(REDE_TAM_MIN, REDE_TAM_MAX + 1):
+        partes.append(gerar_funcao(f"redeOrdenacao{n}", "int v[]", "", "REDE_CE", redes[n]))
+        partes.append("")
+    partes.append(gerar_tabela("FuncaoRede", "redesOrdenacao", "redeOrdenacao"))
+    partes.append("")
+
+    partes += [
+        "#ifdef SIMD_X86",
+        "/* Comparadores vetoriais: cada lane pertence a um vetor diferente */",
+        "#define REDE_CE_AVX2(i, j)                            \\",
+        "    do                                                \\",
+        "    {                                                 \\",
+        "        __m256i a_ = v[i];                            \\",
+        "        v[i] = _mm256_min_epi32(a_, v[j]);            \\",
+        "        v[j] = _mm256_max_epi32(a_, v[j]);            \\",
+        "    } while (0)",
+        "",
+        "#define REDE_CE_AVX512(i, j)                          \\",
+        "    do                                                \\",
+        "    {                                                 \\",
+        "        __m512i a_ = v[i];                            \\",
+        "        v[i] = _mm512_min_epi32(a_, v[j]);            \\",
+        "        v[j] = _mm512_max_epi32(a_, v[j]);            \\",
+        "    } while (0)",
+        "",
+        "typedef void (*FuncaoRedeAVX2)(__m256i v[]);",
+        "typedef void (*FuncaoRedeAVX512)(__m512i v[]);",
+        "",
+    ]
+    for n in range(REDE_TAM_MIN, REDE_TAM_MAX + 1):
+        partes.append(gerar_funcao(f"redeOrdenacaoAVX2_{n}", "__m256i v[]",
+                                   '__attribute__((target("avx2"))) ', "REDE_CE_AVX2", redes[n]))
+        partes.append("")
+    partes.append(gerar_tabela("FuncaoRedeAVX2", "redesOrdenacaoAVX2", "redeOrdenacaoAVX2_"))
+    partes.append("")
+    for n in range(REDE_TAM_MIN, REDE_TAM_MAX + 1):
+        partes.append(gerar_funcao(f"redeOrdenacaoAVX512_{n}", "__m512i v[]",
+                                   '__attribute__((target("avx512f"))) ', "REDE_CE_AVX512", redes[n]))
+        partes.append("")
+    partes.append(gerar_tabela("FuncaoRedeAVX512", "redesOrdenacaoAVX512", "redeOrdenacaoAVX512_"))
+    partes += ["#endif", "", "#endif", ""]
+
+    ARQUIVO_SAIDA.write_text("\n".join(partes), encoding="utf-8")
+    print(f"\n✅ Cabeçalho gerado: {ARQUIVO_SAIDA.name}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,289 @@
+/*  ==================================================================
+ *  HIERARQUIA DE CACHE
+ *  Base do benchmark de escalabilidade na hierarquia de cache, comum aos
+ *  dois programas:
+ *    - níveis de cache de dados e unificados da cpu0, lidos de /sys (ou
+ *      do sysconf);
+ *    - tamanhos de vetor: potências de 2 e pontos em torno de cada nível;
+ *    - medição de um tamanho (1 warm-up e repetições até um tempo mínimo,
+ *      com a saída verificada) e a linha correspondente do CSV, cujo
+ *      formato é o mesmo nos dois programas (gerar_graficos.py).
+ *  ==================================================================*/
+#ifndef HIERARQUIA_CACHE_H
+#define HIERARQUIA_CACHE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "verificacao.h"
+
+#define MAX_NIVEIS_CACHE 8            /* Níveis de cache de dados lidos de /sys (L1d, L2, L3...) */
+#define HIERARQUIA_MIN_BYTES 4096     /* Menor vetor do benchmark de hierarquia de cache */
+#define HIERARQUIA_TEMPO_MINIMO 200.0 /* ms medidos, no mínimo, em cada tamanho do benchmark de hierarquia */
+#define HIERARQUIA_MIN_REPETICOES 3   /* Repetições mínimas (após 1 warm-up) de cada tamanho */
+#define HIERARQUIA_MAX_REPETICOES 1000
+#define MAX_TAMANHOS_HIERARQUIA 96
+
+/* Nível de cache de dados ou unificado de cpu0 (/sys/devices/system/cpu/cpu0/cache/index*) */
+typedef struct
+{
+    int nivel;
+    char tipo[16]; /* "Data" ou "Unified" */
+    long bytes;
+} NivelCache;
+
+/* Resultado da medição de um tamanho */
+typedef struct
+{
+    int repeticoes;    /* Repetições medidas (sem o warm-up) */
+    double mediana_ms;
+    long comparacoes;  /* Contadores da última repetição (a entrada é a mesma em todas) */
+    long trocas;
+} MedicaoHierarquia;
+
+/* Kernel medido: mesma assinatura de shellSort() e cycleSort() */
+typedef void (*FuncaoOrdenacaoHierarquia)(int v[], int tamanho, long *comparacoes, long *trocas);
+
+/**
+ * @brief Lê um campo (level, type, size) de /sys/devices/system/cpu/cpu0/cache/index<indice>.
+ * @return 1 se o campo foi lido, 0 se o índice não existe.
+ */
+static inline int lerCampoCache(int indice, const char *campo, char *valor, int tam_valor)
+{
+    char caminho[128];
+    snprintf(caminho, sizeof(caminho), "/sys/devices/system/cpu/cpu0/cache/index%d/%s", indice, campo);
+    FILE *arquivo = fopen(caminho, "r");
+    if (!arquivo)
+        return 0;
+    int lido = fgets(valor, tam_valor, arquivo) != NULL;
+    fclose(arquivo);
+    valor[strcspn(valor, "\n")] = '\0';
+    return lido;
+}
+
+/**
+ * @brief Lê os níveis de cache de dados e unificados da cpu0 (caches de instrução são ignoradas),
+ *        em ordem crescente de nível. Sem /sys, usa o sysconf (L1d, L2 e L3).
+ * @param niveis Vetor de saída com capacidade para max níveis.
+ * @return Número de níveis encontrados (0 se o sistema não informar nenhum).
+ */
+static inline int lerHierarquiaCache(NivelCache niveis[], int max)
+{
+    int num = 0;
+    char valor[64];
+
+    for (int i = 0; num < max && lerCampoCache(i, "level", valor, sizeof(valor)); i++)
+    {
+        NivelCache n = {atoi(valor), "", 0};
+        if (!lerCampoCache(i, "type", n.tipo, sizeof(n.tipo)) || strcmp(n.tipo, "Instruction") == 0)
+            continue;
+        if (!lerCampoCache(i, "size", valor, sizeof(valor)))
+            continue;
+
+        char sufixo = 0;
+        if (sscanf(valor, "%ld%c", &n.bytes, &sufixo) < 1 || n.bytes <= 0)
+            continue;
+        if (sufixo == 'K')
+            n.bytes <<= 10;
+        else if (sufixo == 'M')
+            n.bytes <<= 20;
+        else if (sufixo == 'G')
+            n.bytes <<= 30;
+
+        /* Inserção ordenada por nível */
+        int j = num++;
+        while (j > 0 && niveis[j - 1].nivel > n.nivel)
+        {
+            niveis[j] = niveis[j - 1];
+            j--;
+        }
+        niveis[j] = n;
+    }
+
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    if (num == 0)
+    {
+        long tamanhos[] = {sysconf(_SC_LEVEL1_DCACHE_SIZE), sysconf(_SC_LEVEL2_CACHE_SIZE),
+                           sysconf(_SC_LEVEL3_CACHE_SIZE)};
+        for (int i = 0; i < 3 && num < max; i++)
+        {
+            if (tamanhos[i] <= 0)
+                continue;
+            niveis[num].nivel = i + 1;
+            strcpy(niveis[num].tipo, i == 0 ? "Data" : "Unified");
+            niveis[num].bytes = tamanhos[i];
+            num++;
+        }
+    }
+#endif
+    return num;
+}
+
+/**
+ * @brief Nome do menor nível de cache em que um vetor de bytes cabe ("L1", "L2"...) ou "DRAM".
+ */
+static inline void nivelDoTamanho(long bytes, const NivelCache niveis[], int num_niveis, char rotulo[], int tam_rotulo)
+{
+    for (int i = 0; i < num_niveis; i++)
+    {
+        if (bytes <= niveis[i].bytes)
+        {
+            snprintf(rotulo, tam_rotulo, "L%d", niveis[i].nivel);
+            return;
+        }
+    }
+    snprintf(rotulo, tam_rotulo, "DRAM");
+}
+
+static inline int compararLong(const void *a, const void *b)
+{
+    long x = *(const long *)a, y = *(const long *)b;
+    return (x > y) - (x < y);
+}
+
+static inline int compararTempoHierarquia(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Tamanhos do vetor (em bytes) do benchmark: as potências de 2 desde HIERARQUIA_MIN_BYTES e,
+ *        em torno de cada nível, 1/2, 3/4, 1, 5/4, 3/2 e 2 vezes o tamanho do nível, até limite,
+ *        em ordem crescente e sem repetições.
+ * @param tamanhos Vetor de saída com MAX_TAMANHOS_HIERARQUIA posições.
+ * @return Quantidade de tamanhos (ao menos 1, pois limite >= HIERARQUIA_MIN_BYTES).
+ */
+static inline int tamanhosHierarquia(const NivelCache niveis[], int num_niveis, long limite, long tamanhos[])
+{
+    int num_tamanhos = 0;
+
+    if (limite < HIERARQUIA_MIN_BYTES)
+        limite = HIERARQUIA_MIN_BYTES;
+    for (long b = HIERARQUIA_MIN_BYTES; b <= limite && num_tamanhos < MAX_TAMANHOS_HIERARQUIA; b *= 2)
+        tamanhos[num_tamanhos++] = b;
+
+    const int fracoes[][2] = {{1, 2}, {3, 4}, {1, 1}, {5, 4}, {3, 2}, {2, 1}};
+    for (int i = 0; i < num_niveis; i++)
+    {
+        for (int f = 0; f < 6 && num_tamanhos < MAX_TAMANHOS_HIERARQUIA; f++)
+        {
+            long b = niveis[i].bytes / fracoes[f][1] * fracoes[f][0];
+            b -= b % (long)sizeof(int);
+            if (b >= HIERARQUIA_MIN_BYTES && b <= limite)
+                tamanhos[num_tamanhos++] = b;
+        }
+    }
+
+    qsort(tamanhos, num_tamanhos, sizeof(long), compararLong);
+    int unicos = 0;
+    for (int i = 0; i < num_tamanhos; i++)
+        if (unicos == 0 || tamanhos[i] != tamanhos[unicos - 1])
+            tamanhos[unicos++] = tamanhos[i];
+    return unicos;
+}
+
+/**
+ * @brief Mede um tamanho: o kernel ordena o prefixo de tamanho elementos de original, com 1 warm-up e
+ *        repetições até somar HIERARQUIA_TEMPO_MINIMO ms (entre HIERARQUIA_MIN_REPETICOES e
+ *        HIERARQUIA_MAX_REPETICOES). A saída de cada repetição é verificada fora da medição.
+ * @param tempos Área de trabalho com HIERARQUIA_MAX_REPETICOES posições.
+ * @return Repetições, mediana dos tempos e contadores.
+ */
+static inline MedicaoHierarquia medirHierarquia(FuncaoOrdenacaoHierarquia ordenar, const char *algoritmo,
+                                                const int original[], int v[], int tamanho, double tempos[])
+{
+    MedicaoHierarquia m = {0, 0.0, 0, 0};
+    ImpressaoVetor impressao = impressaoVetor(original, tamanho);
+    double soma = 0.0;
+
+    /* Repetição 0 é o warm-up; depois, até somar o tempo mínimo */
+    for (int r = 0; r <= HIERARQUIA_MIN_REPETICOES || (soma < HIERARQUIA_TEMPO_MINIMO &&
+                                                      m.repeticoes < HIERARQUIA_MAX_REPETICOES); r++)
+    {
+        memcpy(v, original, tamanho * sizeof(int));
+        m.comparacoes = m.trocas = 0;
+
+        struct timespec inicio, fim;
+        clock_gettime(CLOCK_MONOTONIC, &inicio);
+        ordenar(v, tamanho, &m.comparacoes, &m.trocas);
+        clock_gettime(CLOCK_MONOTONIC, &fim);
+
+        verificarOrdenacao(&impressao, v, tamanho, algoritmo, "hierarquia", r + 1);
+        if (r > 0)
+        {
+            tempos[m.repeticoes] = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1e6;
+            soma += tempos[m.repeticoes++];
+        }
+    }
+
+    /* Mediana pelo posto mais próximo, como percentilOrdenado() */
+    qsort(tempos, m.repeticoes, sizeof(double), compararTempoHierarquia);
+    m.mediana_ms = tempos[(m.repeticoes + 1) / 2 - 1];
+    return m;
+}
+
+/**
+ * @brief Exibe os níveis lidos e a faixa de tamanhos que será medida.
+ */
+static inline void exibirNiveisHierarquia(const NivelCache niveis[], int num_niveis, const long tamanhos[],
+                                          int num_tamanhos)
+{
+    if (num_niveis == 0)
+        printf("AVISO: o sistema nao informou os tamanhos de cache; os vetores sao so potencias de 2.\n");
+    for (int i = 0; i < num_niveis; i++)
+        printf("  L%d %-8s %8ld KB\n", niveis[i].nivel, niveis[i].tipo, niveis[i].bytes >> 10);
+    printf("%d tamanhos, de %ld KB a %ld KB\n", num_tamanhos, tamanhos[0] >> 10, tamanhos[num_tamanhos - 1] >> 10);
+}
+
+/**
+ * @brief Grava o cabeçalho das colunas de medição do CSV de hierarquia.
+ */
+static inline void cabecalhoCSVHierarquia(FILE *csv)
+{
+    fprintf(csv, "variante;gaps;tamanho;bytes_vetor;nivel;repeticoes;mediana_ms;elementos_por_s;"
+                 "bytes_por_elemento;largura_banda_gbs\n");
+}
+
+/**
+ * @brief Exibe o título e as colunas da tabela de uma variante.
+ */
+static inline void cabecalhoTabelaHierarquia(const char *variante)
+{
+    printf("\n[%s]\n", variante);
+    printf("%12s %6s %6s %13s %12s %11s %9s\n", "vetor (KB)", "nivel", "reps", "mediana (ms)", "Melem/s",
+           "bytes/elem", "GB/s");
+}
+
+/**
+ * @brief Grava a tabela dos níveis de cache após uma linha em branco, no fim do CSV (para os gráficos).
+ */
+static inline void salvarNiveisHierarquia(FILE *csv, const NivelCache niveis[], int num_niveis)
+{
+    fprintf(csv, "\nnivel;tipo;bytes\n");
+    for (int i = 0; i < num_niveis; i++)
+        fprintf(csv, "%d;%s;%ld\n", niveis[i].nivel, niveis[i].tipo, niveis[i].bytes);
+}
+
+/**
+ * @brief Exibe e grava no CSV a linha de um tamanho: elementos/s, bytes acessados por elemento (uma
+ *        leitura de int por comparação e uma escrita por troca/deslocamento) e a largura de banda efetiva.
+ * @param gaps Sequência de gaps (Shell Sort) ou "-".
+ */
+static inline void registrarHierarquia(FILE *csv, const char *variante, const char *gaps, long bytes_vetor,
+                                       const char *nivel, MedicaoHierarquia m)
+{
+    int tamanho = (int)(bytes_vetor / (long)sizeof(int));
+    double elementos_por_s = m.mediana_ms > 0.0 ? tamanho / (m.mediana_ms / 1000.0) : 0.0;
+    double bytes_por_elemento = (double)(m.comparacoes + m.trocas) * sizeof(int) / tamanho;
+    double banda = bytes_por_elemento * elementos_por_s / 1e9;
+
+    printf("%12ld %6s %6d %13.3f %12.2f %11.1f %9.2f\n", bytes_vetor >> 10, nivel, m.repeticoes, m.mediana_ms,
+           elementos_por_s / 1e6, bytes_por_elemento, banda);
+    fprintf(csv, "%s;%s;%d;%ld;%s;%d;%.4f;%.0f;%.3f;%.3f\n", variante, gaps, tamanho, bytes_vetor, nivel,
+            m.repeticoes, m.mediana_ms, elementos_por_s, bytes_por_elemento, banda);
+}
+
+#endif
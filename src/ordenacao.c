@@ -0,0 +1,113 @@
+/*  ==================================================================
+ *  BIBLIOTECA DE ORDENAÇÃO: FUNÇÕES COMUNS E HARNESS DE MEDIÇÃO
+ *  Os kernels vêm de shellSort.c e cycleSort.c compilados com
+ *  -DORDENACAO_BIBLIOTECA (sem main(), ver Makefile); aqui ficam as funções
+ *  que não pertencem a um algoritmo específico.
+ *  ==================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "ordenacao.h"
+#include "verificacao.h"
+
+typedef int (*FuncaoOrdenacao)(int32_t *v, int64_t n, ContadoresOrdenacao *contadores);
+typedef const char *(*FuncaoVariante)(void);
+
+ORDENACAO_API int ordenacaoVersao(void)
+{
+    return ORDENACAO_VERSAO;
+}
+
+ORDENACAO_API int64_t ordenacaoPrimeiraInversao(const int32_t *v, int64_t n)
+{
+    if (!v || n < 2)
+        return -1;
+    return primeiraInversao(v, n);
+}
+
+/**
+ * @brief Mede o algoritmo como executarTesteGeral() nos programas: cada repetição ordena uma
+ *        cópia nova da entrada, com o tempo medido só em volta da ordenação e a saída verificada
+ *        (ordem e permutação) fora da medição. A primeira execução é de aquecimento e não entra
+ *        nas estatísticas.
+ */
+ORDENACAO_API int ordenacaoMedir(int algoritmo, const int32_t *entrada, int64_t n, int repeticoes,
+                                 ResultadoMedicao *resultado)
+{
+    FuncaoOrdenacao ordenar[] = {ordenacaoShellSort, ordenacaoCycleSort};
+    FuncaoVariante variante[] = {ordenacaoVarianteShellSort, ordenacaoVarianteCycleSort};
+
+    if (algoritmo != ORDENACAO_SHELL && algoritmo != ORDENACAO_CYCLE)
+        return ORDENACAO_ERRO_ARGUMENTO;
+    if (!resultado || repeticoes < 1 || (!entrada && n > 0))
+        return ORDENACAO_ERRO_ARGUMENTO;
+    if (n < 0 || n > INT32_MAX)
+        return ORDENACAO_ERRO_TAMANHO;
+
+    int32_t *v = malloc((n > 0 ? n : 1) * sizeof(int32_t));
+    double *tempos = malloc(repeticoes * sizeof(double));
+    if (!v || !tempos)
+    {
+        free(v);
+        free(tempos);
+        return ORDENACAO_ERRO_MEMORIA;
+    }
+
+    ImpressaoVetor impressao = impressaoVetor(entrada, n);
+    double soma_comparacoes = 0.0, soma_trocas = 0.0;
+    int erro = ORDENACAO_OK;
+
+    for (int r = -1; r < repeticoes && erro == ORDENACAO_OK; r++)
+    {
+        ContadoresOrdenacao contadores;
+        struct timespec inicio, fim;
+
+        memcpy(v, entrada, n * sizeof(int32_t));
+        clock_gettime(CLOCK_MONOTONIC, &inicio);
+        erro = ordenar[algoritmo](v, n, &contadores);
+        clock_gettime(CLOCK_MONOTONIC, &fim);
+        if (erro != ORDENACAO_OK)
+            break;
+
+        ImpressaoVetor saida = impressaoVetor(v, n);
+        if (primeiraInversao(v, n) >= 0 || saida.soma != impressao.soma ||
+            saida.hash_a != impressao.hash_a || saida.hash_b != impressao.hash_b)
+            erro = ORDENACAO_ERRO_VERIFICACAO;
+        else if (r >= 0)
+        {
+            tempos[r] = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
+            soma_comparacoes += contadores.comparacoes;
+            soma_trocas += contadores.trocas;
+        }
+    }
+
+    if (erro == ORDENACAO_OK)
+    {
+        double media = 0.0, variancia = 0.0;
+        resultado->minimo_ms = resultado->maximo_ms = tempos[0];
+        for (int r = 0; r < repeticoes; r++)
+        {
+            media += tempos[r];
+            if (tempos[r] < resultado->minimo_ms)
+                resultado->minimo_ms = tempos[r];
+            if (tempos[r] > resultado->maximo_ms)
+                resultado->maximo_ms = tempos[r];
+        }
+        media /= repeticoes;
+        for (int r = 0; r < repeticoes; r++)
+            variancia += (tempos[r] - media) * (tempos[r] - media);
+
+        resultado->repeticoes = repeticoes;
+        resultado->media_ms = media;
+        resultado->desvio_ms = sqrt(variancia / repeticoes);
+        resultado->media_comparacoes = soma_comparacoes / repeticoes;
+        resultado->media_trocas = soma_trocas / repeticoes;
+        snprintf(resultado->variante, sizeof(resultado->variante), "%s", variante[algoritmo]());
+    }
+
+    free(v);
+    free(tempos);
+    return erro;
+}
@@ -0,0 +1,126 @@
+/*  ==================================================================
+ *  BIBLIOTECA DE ORDENAÇÃO (libordenacao)
+ *  Interface C estável para usar os kernels do Shell Sort e do Cycle Sort
+ *  (e o harness de medição) a partir de outros programas, sem passar pelos
+ *  menus interativos nem pelos arquivos de results/files/.
+ *
+ *  Construção (a partir de src/):  make biblioteca
+ *    - libordenacao.a  (estática)
+ *    - libordenacao.so (compartilhada)
+ *  Somente as funções marcadas com ORDENACAO_API são exportadas; o
+ *  restante do código dos programas fica local à biblioteca.
+ *
+ *  Convenções:
+ *    - vetores de int32_t, ordenados no próprio lugar (sem cópia);
+ *    - tamanhos em int64_t, limitados a INT32_MAX elementos;
+ *    - retorno 0 em caso de sucesso ou um código ORDENACAO_ERRO_* negativo;
+ *    - todas as funções podem ser chamadas de várias threads ao mesmo tempo.
+ *  ==================================================================*/
+#ifndef ORDENACAO_H
+#define ORDENACAO_H
+
+#include <stdint.h>
+
+#if defined(__GNUC__)
+#define ORDENACAO_API __attribute__((visibility("default")))
+#else
+#define ORDENACAO_API
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define ORDENACAO_VERSAO 1 /* Incrementada a cada mudança incompatível da interface */
+
+#define ORDENACAO_SHELL 0 /* Identificadores de algoritmo */
+#define ORDENACAO_CYCLE 1
+
+#define ORDENACAO_OK 0
+#define ORDENACAO_ERRO_ARGUMENTO -1 /* Ponteiro nulo, algoritmo ou tipo inválido, k fora do vetor */
+#define ORDENACAO_ERRO_TAMANHO -2   /* Tamanho negativo ou acima de INT32_MAX */
+#define ORDENACAO_ERRO_MEMORIA -3   /* Falha de alocação ou de criação de threads */
+#define ORDENACAO_ERRO_VERIFICACAO -4 /* A saída não está ordenada ou não é permutação da entrada */
+
+typedef struct
+{
+    int64_t comparacoes;
+    int64_t trocas;
+} ContadoresOrdenacao;
+
+typedef struct
+{
+    int repeticoes;          /* Repetições medidas (após 1 de aquecimento) */
+    double media_ms;
+    double desvio_ms;
+    double minimo_ms;
+    double maximo_ms;
+    double media_comparacoes;
+    double media_trocas;
+    char variante[16];       /* Variante do kernel usada (escalar, sentinela ou sem_desvio, avx2, avx512) */
+} ResultadoMedicao;
+
+/** @brief Versão da interface (ORDENACAO_VERSAO com que a biblioteca foi construída). */
+ORDENACAO_API int ordenacaoVersao(void);
+
+/** @brief Nome da variante de kernel (escalar, sentinela/sem_desvio, avx2, avx512; ORDENACAO_VARIANTE ou perfil). */
+ORDENACAO_API const char *ordenacaoVarianteShellSort(void);
+ORDENACAO_API const char *ordenacaoVarianteCycleSort(void);
+
+/**
+ * @brief Ordena v no próprio lugar com Shell Sort.
+ * @param contadores Recebe comparações e trocas (pode ser NULL).
+ */
+ORDENACAO_API int ordenacaoShellSort(int32_t *v, int64_t n, ContadoresOrdenacao *contadores);
+
+/**
+ * @brief Ordena v no próprio lugar com Cycle Sort (mínimo de escritas).
+ * @param contadores Recebe comparações e trocas (pode ser NULL).
+ */
+ORDENACAO_API int ordenacaoCycleSort(int32_t *v, int64_t n, ContadoresOrdenacao *contadores);
+
+/**
+ * @brief Ordena v com o merge sort paralelo (folhas com Shell Sort). As threads ficam num pool
+ *        reaproveitado entre chamadas (recriado só quando threads muda); chamadas simultâneas
+ *        usam o pool uma de cada vez.
+ * @param threads Número de threads (0 = perfil de ajuste ou todos os núcleos).
+ */
+ORDENACAO_API int ordenacaoShellSortParalelo(int32_t *v, int64_t n, int threads);
+
+/**
+ * @brief Reorganiza v de modo que v[k] seja o k-ésimo menor, com os menores antes e os maiores depois.
+ * @param valor Recebe v[k] (pode ser NULL).
+ */
+ORDENACAO_API int ordenacaoSelecionarNesimo(int32_t *v, int64_t n, int64_t k, int32_t *valor);
+
+/** @brief Deixa os k menores elementos ordenados em v[0..k-1] (restante em ordem indefinida). */
+ORDENACAO_API int ordenacaoOrdenarParcial(int32_t *v, int64_t n, int64_t k);
+
+/**
+ * @brief Preenche v com o gerador do harness, usando um gerador local (não altera o rand() do chamador).
+ * @param tipo 1 - crescente, 2 - decrescente (ambos até 150000 elementos), 3 - aleatório.
+ * @param semente Semente do gerador (o mesmo valor reproduz o mesmo vetor, em qualquer thread).
+ */
+ORDENACAO_API int ordenacaoGerarVetor(int32_t *v, int64_t n, int tipo, unsigned int semente);
+
+/**
+ * @brief Confere se v está em ordem não decrescente.
+ * @return -1 se estiver ordenado, ou o índice i da primeira inversão (v[i] > v[i + 1]).
+ */
+ORDENACAO_API int64_t ordenacaoPrimeiraInversao(const int32_t *v, int64_t n);
+
+/**
+ * @brief Harness: mede o algoritmo sobre cópias da entrada (1 aquecimento + repeticoes),
+ *        verificando cada saída, com os mesmos critérios dos programas interativos.
+ * @param entrada Vetor de entrada (não é alterado).
+ * @param resultado Recebe as estatísticas da medição.
+ */
+ORDENACAO_API int ordenacaoMedir(int algoritmo, const int32_t *entrada, int64_t n, int repeticoes,
+                                 ResultadoMedicao *resultado);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
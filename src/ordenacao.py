@@ -0,0 +1,272 @@
+"""
+BINDING PYTHON DA BIBLIOTECA DE ORDENAÇÃO
+=========================================
+Acesso direto aos kernels de libordenacao.so (Shell Sort, Cycle Sort, seleção,
+ordenação paralela) e ao harness de medição, sem passar pelos programas
+interativos nem pelos arquivos de results/files/.
+
+Os vetores são ordenados no próprio lugar pelo protocolo de buffer: qualquer
+objeto com buffer de int32 contíguo e gravável (numpy.ndarray de dtype int32,
+array.array('i'), memoryview...) é entregue à biblioteca sem cópia. Um
+dtype diferente gera TypeError em vez de uma conversão silenciosa, que
+ordenaria uma cópia e deixaria o original intacto. O ctypes libera o GIL
+durante as chamadas, então várias threads Python podem ordenar ao mesmo tempo.
+
+USO (a partir da pasta src/, depois de `make biblioteca`):
+    import numpy as np
+    import ordenacao
+
+    v = ordenacao.gerar_vetor(1_000_000, tipo=3, semente=42)
+    comparacoes, trocas = ordenacao.shell_sort(v)
+    print(ordenacao.medir("cycle", v[:20000], repeticoes=5))
+
+Treino para a compilação PGO (usado por `make pgo`):
+    python3 ordenacao.py --treino
+
+A biblioteca é procurada em ORDENACAO_BIBLIOTECA (caminho do .so) ou ao lado
+deste arquivo.
+"""
+
+import ctypes
+import os
+from pathlib import Path
+
+# ============================================
+# CONFIGURAÇÕES
+# ============================================
+
+VERSAO_ESPERADA = 1
+ALGORITMOS = {"shell": 0, "cycle": 1}
+ERROS = {
+    -1: "argumento invalido",
+    -2: "tamanho invalido",
+    -3: "falha de alocacao ou de criacao de threads",
+    -4: "saida nao ordenada ou nao e permutacao da entrada",
+}
+
+
+class ErroOrdenacao(RuntimeError):
+    """Erro devolvido por uma função da biblioteca (código ORDENACAO_ERRO_*)."""
+
+
+class _Contadores(ctypes.Structure):
+    _fields_ = [("comparacoes", ctypes.c_int64), ("trocas", ctypes.c_int64)]
+
+
+class _ResultadoMedicao(ctypes.Structure):
+    _fields_ = [
+        ("repeticoes", ctypes.c_int),
+        ("media_ms", ctypes.c_double),
+        ("desvio_ms", ctypes.c_double),
+        ("minimo_ms", ctypes.c_double),
+        ("maximo_ms", ctypes.c_double),
+        ("media_comparacoes", ctypes.c_double),
+        ("media_trocas", ctypes.c_double),
+        ("variante", ctypes.c_char * 16),
+    ]
+
+# ============================================
+# CARREGAMENTO DA BIBLIOTECA
+# ============================================
+
+def _carregar():
+    """
+    Carrega libordenacao.so e declara as assinaturas das funções exportadas.
+    """
+    caminho = os.environ.get("ORDENACAO_BIBLIOTECA") or str(Path(__file__).resolve().parent / "libordenacao.so")
+    try:
+        bib = ctypes.CDLL(caminho)
+    except OSError as erro:
+        raise ImportError(f"Nao foi possivel carregar {caminho} (execute `make biblioteca` em src/): {erro}")
+
+    ptr = ctypes.POINTER(ctypes.c_int32)
+    assinaturas = {
+        "ordenacaoVersao": (ctypes.c_int, []),
+        "ordenacaoVarianteShellSort": (ctypes.c_char_p, []),
+        "ordenacaoVarianteCycleSort": (ctypes.c_char_p, []),
+        "ordenacaoShellSort": (ctypes.c_int, [ptr, ctypes.c_int64, ctypes.POINTER(_Contadores)]),
+        "ordenacaoCycleSort": (ctypes.c_int, [ptr, ctypes.c_int64, ctypes.POINTER(_Contadores)]),
+        "ordenacaoShellSortParalelo": (ctypes.c_int, [ptr, ctypes.c_int64, ctypes.c_int]),
+        "ordenacaoSelecionarNesimo": (ctypes.c_int, [ptr, ctypes.c_int64, ctypes.c_int64, ptr]),
+        "ordenacaoOrdenarParcial": (ctypes.c_int, [ptr, ctypes.c_int64, ctypes.c_int64]),
+        "ordenacaoGerarVetor": (ctypes.c_int, [ptr, ctypes.c_int64, ctypes.c_int, ctypes.c_uint]),
+        "ordenacaoPrimeiraInversao": (ctypes.c_int64, [ptr, ctypes.c_int64]),
+        "ordenacaoMedir": (ctypes.c_int, [ctypes.c_int, ptr, ctypes.c_int64, ctypes.c_int,
+                                          ctypes.POINTER(_ResultadoMedicao)]),
+    }
+    for nome, (retorno, argumentos) in assinaturas.items():
+        funcao = getattr(bib, nome)
+        funcao.restype = retorno
+        funcao.argtypes = argumentos
+
+    if bib.ordenacaoVersao() != VERSAO_ESPERADA:
+        raise ImportError(f"Versao da biblioteca ({bib.ordenacaoVersao()}) diferente da esperada ({VERSAO_ESPERADA})")
+    return bib
+
+
+_bib = _carregar()
+
+# ============================================
+# AUXILIARES
+# ============================================
+
+def _buffer_int32(dados, gravavel=True):
+    """
+    Obtém (ponteiro, quantidade, referência) para o buffer int32 contíguo de dados, sem cópia.
+    A referência deve ser mantida viva até o fim da chamada à biblioteca.
+    """
+    memoria = memoryview(dados)
+    formato = memoria.format.lstrip("@=<")
+    if memoria.itemsize != 4 or formato not in ("i", "l") or memoria.format.startswith(">"):
+        raise TypeError(f"Esperado buffer de int32 nativo (ex.: numpy.int32), recebido formato '{memoria.format}'")
+    if not memoria.c_contiguous:
+        raise TypeError("O buffer precisa ser contiguo (use numpy.ascontiguousarray antes)")
+
+    quantidade = memoria.nbytes // 4
+    if quantidade == 0:
+        return None, 0, None
+    if memoria.readonly:
+        if gravavel:
+            raise TypeError("O buffer precisa ser gravavel para ordenacao no proprio lugar")
+        vetor = (ctypes.c_int32 * quantidade).from_buffer_copy(memoria)  # Somente leitura: cópia inevitável
+    else:
+        vetor = (ctypes.c_int32 * quantidade).from_buffer(memoria.cast("B"))
+    return ctypes.cast(vetor, ctypes.POINTER(ctypes.c_int32)), quantidade, vetor
+
+
+def _verificar(codigo):
+    if codigo < 0:
+        raise ErroOrdenacao(f"{ERROS.get(codigo, 'erro desconhecido')} (codigo {codigo})")
+
+
+def _algoritmo(nome):
+    if nome not in ALGORITMOS:
+        raise ValueError(f"Algoritmo deve ser um de {sorted(ALGORITMOS)}")
+    return ALGORITMOS[nome]
+
+# ============================================
+# INTERFACE
+# ============================================
+
+def versao():
+    return _bib.ordenacaoVersao()
+
+
+def variante(algoritmo="shell"):
+    """Variante de kernel em uso (escalar, sentinela/sem_desvio, avx2, avx512; ORDENACAO_VARIANTE=auto usa a mais larga)."""
+    funcao = _bib.ordenacaoVarianteShellSort if _algoritmo(algoritmo) == 0 else _bib.ordenacaoVarianteCycleSort
+    return funcao().decode()
+
+
+def shell_sort(dados):
+    """Ordena dados no próprio lugar com Shell Sort. Retorna (comparacoes, trocas)."""
+    ponteiro, n, _ref = _buffer_int32(dados)
+    contadores = _Contadores()
+    _verificar(_bib.ordenacaoShellSort(ponteiro, n, ctypes.byref(contadores)))
+    return contadores.comparacoes, contadores.trocas
+
+
+def cycle_sort(dados):
+    """Ordena dados no próprio lugar com Cycle Sort. Retorna (comparacoes, trocas)."""
+    ponteiro, n, _ref = _buffer_int32(dados)
+    contadores = _Contadores()
+    _verificar(_bib.ordenacaoCycleSort(ponteiro, n, ctypes.byref(contadores)))
+    return contadores.comparacoes, contadores.trocas
+
+
+def shell_sort_paralelo(dados, threads=0):
+    """Ordena dados no próprio lugar com o merge sort paralelo (0 = perfil de ajuste ou todos os núcleos)."""
+    ponteiro, n, _ref = _buffer_int32(dados)
+    _verificar(_bib.ordenacaoShellSortParalelo(ponteiro, n, threads))
+
+
+def selecionar_nesimo(dados, k):
+    """Reorganiza dados para que dados[k] seja o k-ésimo menor e o retorna."""
+    ponteiro, n, _ref = _buffer_int32(dados)
+    valor = ctypes.c_int32()
+    _verificar(_bib.ordenacaoSelecionarNesimo(ponteiro, n, k, ctypes.byref(valor)))
+    return valor.value
+
+
+def ordenar_parcial(dados, k):
+    """Deixa os k menores elementos de dados ordenados no início."""
+    ponteiro, n, _ref = _buffer_int32(dados)
+    _verificar(_bib.ordenacaoOrdenarParcial(ponteiro, n, k))
+
+
+def primeira_inversao(dados):
+    """Índice da primeira inversão (dados[i] > dados[i + 1]) ou -1 se estiver ordenado."""
+    ponteiro, n, _ref = _buffer_int32(dados, gravavel=False)
+    return _bib.ordenacaoPrimeiraInversao(ponteiro, n)
+
+
+def gerar_vetor(n, tipo=3, semente=0):
+    """
+    Gera um vetor com o gerador do harness (1 - crescente, 2 - decrescente, 3 - aleatório).
+    Retorna numpy.ndarray int32 se o NumPy estiver instalado, senão array.array('i').
+    """
+    try:
+        import numpy as np
+        dados = np.empty(n, dtype=np.int32)
+    except ImportError:
+        import array
+        dados = array.array("i", bytes(4 * n))
+    ponteiro, quantidade, _ref = _buffer_int32(dados)
+    _verificar(_bib.ordenacaoGerarVetor(ponteiro, quantidade, tipo, semente))
+    return dados
+
+
+def medir(algoritmo, dados, repeticoes=10):
+    """
+    Mede o algoritmo ("shell" ou "cycle") sobre cópias de dados (que não é alterado):
+    1 aquecimento + repeticoes, com a saída verificada a cada repetição.
+    """
+    ponteiro, n, _ref = _buffer_int32(dados, gravavel=False)
+    resultado = _ResultadoMedicao()
+    _verificar(_bib.ordenacaoMedir(_algoritmo(algoritmo), ponteiro, n, repeticoes, ctypes.byref(resultado)))
+    return {
+        "algoritmo": algoritmo,
+        "tamanho": n,
+        "repeticoes": resultado.repeticoes,
+        "media_ms": resultado.media_ms,
+        "desvio_ms": resultado.desvio_ms,
+        "minimo_ms": resultado.minimo_ms,
+        "maximo_ms": resultado.maximo_ms,
+        "media_comparacoes": resultado.media_comparacoes,
+        "media_trocas": resultado.media_trocas,
+        "variante": resultado.variante.decode(),
+    }
+
+
+def treinar():
+    """
+    Mistura de cenários usada pela compilação PGO da biblioteca (`make pgo`): o harness
+    ordenacaoMedir com os tamanhos do teste geral, vetores pequenos, seleção e ordenação paralela.
+    """
+    for algoritmo in ALGORITMOS:
+        for tamanho in (20000, 40000, 60000):
+            for tipo in (1, 2, 3):
+                medir(algoritmo, gerar_vetor(tamanho, tipo, semente=tipo), repeticoes=1)
+        for tamanho in (8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096):
+            for semente in range(16):
+                medir(algoritmo, gerar_vetor(tamanho, 3, semente), repeticoes=1)
+
+    vetor = gerar_vetor(1_000_000, 3, semente=1)
+    selecionar_nesimo(vetor, len(vetor) // 2)
+    ordenar_parcial(vetor, 1000)
+    shell_sort_paralelo(vetor)
+    print(f"Treino da biblioteca concluido (variante {variante('shell')})")
+
+
+if __name__ == "__main__":
+    import sys
+    if "--treino" in sys.argv[1:]:
+        treinar()
+        sys.exit(0)
+
+    vetor = gerar_vetor(1_000_000, tipo=3, semente=42)
+    comparacoes, trocas = shell_sort(vetor)
+    print(f"libordenacao v{versao()} | shell: {variante('shell')} | cycle: {variante('cycle')}")
+    print(f"Shell Sort de 1.000.000 elementos: {comparacoes} comparacoes, {trocas} trocas, "
+          f"ordenado: {primeira_inversao(vetor) == -1}")
+    print(medir("cycle", gerar_vetor(20000, semente=1), repeticoes=3))
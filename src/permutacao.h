@@ -0,0 +1,123 @@
+/*  ==================================================================
+ *  REGISTROS E PERMUTAÇÕES
+ *  Auxiliares da ordenação indireta (argsort) comuns aos dois programas:
+ *    - registros de tam_registro bytes com a chave (int) no início e uma
+ *      carga derivada da chave, conferida após a ordenação;
+ *    - aplicação de uma permutação no próprio vetor, seguindo os seus
+ *      ciclos, com uma escrita por posição.
+ *  ==================================================================*/
+#ifndef PERMUTACAO_H
+#define PERMUTACAO_H
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Chave (int) de um registro armazenado no início de cada bloco de tam_registro bytes */
+#define CHAVE_REGISTRO(registros, tam_registro, i) \
+    (*(const int *)((const char *)(registros) + (size_t)(i) * (tam_registro)))
+
+/**
+ * @brief Monta registros com as chaves dadas e carga derivada da chave, para que a
+ *        integridade de cada registro possa ser conferida após a ordenação.
+ * @param registros Registros armazenados de forma contígua.
+ * @param tam_registro Tamanho de cada registro em bytes.
+ * @param chaves Chaves dos registros (geradas pelo gerarVetor() de cada programa).
+ * @param tamanho Quantidade de registros.
+ * @return void
+ */
+static inline void preencherRegistros(void *registros, size_t tam_registro, const int chaves[], int tamanho)
+{
+    char *base = registros;
+
+    for (int i = 0; i < tamanho; i++)
+    {
+        char *registro = base + (size_t)i * tam_registro;
+        memcpy(registro, &chaves[i], sizeof(int));
+        for (size_t b = sizeof(int); b < tam_registro; b++)
+            registro[b] = (char)(chaves[i] + b);
+    }
+}
+
+/**
+ * @brief Confere se os registros estão ordenados pela chave e se cada carga corresponde à sua chave.
+ * @param registros Registros armazenados de forma contígua.
+ * @param tam_registro Tamanho de cada registro em bytes.
+ * @param tamanho Quantidade de registros.
+ * @return 1 se estiverem corretos, 0 caso contrário.
+ */
+static inline int registrosCorretos(const void *registros, size_t tam_registro, int tamanho)
+{
+    const char *base = registros;
+
+    for (int i = 0; i < tamanho; i++)
+    {
+        const char *registro = base + (size_t)i * tam_registro;
+        int chave = CHAVE_REGISTRO(base, tam_registro, i);
+
+        if (i > 0 && CHAVE_REGISTRO(base, tam_registro, i - 1) > chave)
+            return 0;
+        for (size_t b = sizeof(int); b < tam_registro; b++)
+            if (registro[b] != (char)(chave + b))
+                return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Aplica uma permutação a registros no próprio vetor, seguindo os ciclos da permutação
+ *        como o Cycle Sort: cada posição é escrita exatamente uma vez e apenas um registro
+ *        auxiliar é usado por ciclo. Ao final, registro[i] = registro_original[indices[i]].
+ *        O vetor de índices é usado como marcação durante o processo e restaurado ao final.
+ * @param registros Registros armazenados de forma contígua.
+ * @param tam_registro Tamanho de cada registro em bytes.
+ * @param indices Permutação a ser aplicada (por exemplo, gerada por shellSortIndices ou cycleSortIndices).
+ * @param tamanho Quantidade de registros.
+ * @return Número de registros escritos, ou -1 em caso de erro de alocação.
+ */
+static inline long aplicarPermutacao(void *registros, size_t tam_registro, int indices[], int tamanho)
+{
+    char *base = registros;
+    char *aux = malloc(tam_registro);
+    long escritas = 0;
+
+    if (!aux)
+        return -1;
+
+    for (int ciclo_inicio = 0; ciclo_inicio < tamanho; ciclo_inicio++)
+    {
+        /* Índices negativos (~k) marcam posições já escritas */
+        if (indices[ciclo_inicio] < 0)
+            continue;
+        if (indices[ciclo_inicio] == ciclo_inicio)
+        {
+            indices[ciclo_inicio] = ~ciclo_inicio;
+            continue;
+        }
+
+        memcpy(aux, base + (size_t)ciclo_inicio * tam_registro, tam_registro);
+        int pos = ciclo_inicio;
+
+        for (;;)
+        {
+            int origem = indices[pos];
+            indices[pos] = ~origem;
+            if (origem == ciclo_inicio)
+            {
+                memcpy(base + (size_t)pos * tam_registro, aux, tam_registro);
+                escritas++;
+                break;
+            }
+            memcpy(base + (size_t)pos * tam_registro, base + (size_t)origem * tam_registro, tam_registro);
+            escritas++;
+            pos = origem;
+        }
+    }
+
+    for (int i = 0; i < tamanho; i++)
+        indices[i] = ~indices[i];
+
+    free(aux);
+    return escritas;
+}
+
+#endif
@@ -0,0 +1,1499 @@
+/*  ==================================================================
+ *  REDES DE ORDENAÇÃO PARA TAMANHOS FIXOS
+ *  Gerado automaticamente por gerar_redes.py -- NÃO EDITAR À MÃO.
+ *  Redes odd-even merge de Batcher, validadas pelo princípio 0-1.
+ *  Defina SIMD_X86 e inclua <x86intrin.h> antes deste cabeçalho para
+ *  habilitar as variantes AVX2 (8 vetores) e AVX-512 (16 vetores).
+ *  ==================================================================*/
+#ifndef REDES_ORDENACAO_H
+#define REDES_ORDENACAO_H
+
+#define REDE_TAM_MIN 2
+#define REDE_TAM_MAX 32
+
+/* Comparador escalar: min/max sem desvio (compilado como cmov) */
+#define REDE_CE(i, j)                       \
+    do                                      \
+    {                                       \
+        int a_ = v[i], b_ = v[j];           \
+        v[i] = a_ < b_ ? a_ : b_;           \
+        v[j] = a_ < b_ ? b_ : a_;           \
+    } while (0)
+
+typedef void (*FuncaoRede)(int v[]);
+
+/* Número de comparadores de cada rede, indexado pelo tamanho */
+static const int redesComparadores[REDE_TAM_MAX + 1] = {0, 0, 1, 3, 5, 9, 12, 16, 19, 28, 32, 38, 42, 48, 53, 59, 63, 85, 90, 98, 103, 112, 119, 127, 132, 140, 147, 156, 162, 171, 178, 186, 191};
+
+static inline void redeOrdenacao2(int v[])
+{
+    REDE_CE(0, 1);
+}
+
+static inline void redeOrdenacao3(int v[])
+{
+    REDE_CE(0, 1);
+    REDE_CE(0, 2);
+    REDE_CE(1, 2);
+}
+
+static inline void redeOrdenacao4(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3);
+    REDE_CE(0, 2); REDE_CE(1, 3);
+    REDE_CE(1, 2);
+}
+
+static inline void redeOrdenacao5(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3);
+    REDE_CE(0, 2); REDE_CE(1, 3);
+    REDE_CE(1, 2); REDE_CE(0, 4);
+    REDE_CE(2, 4);
+    REDE_CE(1, 2); REDE_CE(3, 4);
+}
+
+static inline void redeOrdenacao6(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5);
+    REDE_CE(0, 2); REDE_CE(1, 3);
+    REDE_CE(1, 2); REDE_CE(0, 4);
+    REDE_CE(1, 5); REDE_CE(2, 4);
+    REDE_CE(3, 5); REDE_CE(1, 2);
+    REDE_CE(3, 4);
+}
+
+static inline void redeOrdenacao7(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(0, 4);
+    REDE_CE(1, 5); REDE_CE(2, 6);
+    REDE_CE(2, 4); REDE_CE(3, 5);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6);
+}
+
+static inline void redeOrdenacao8(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(0, 4); REDE_CE(3, 7);
+    REDE_CE(1, 5); REDE_CE(2, 6);
+    REDE_CE(2, 4); REDE_CE(3, 5);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6);
+}
+
+static inline void redeOrdenacao9(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(0, 4); REDE_CE(3, 7);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(0, 8);
+    REDE_CE(2, 4); REDE_CE(3, 5);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6);
+    REDE_CE(4, 8); REDE_CE(3, 5);
+    REDE_CE(2, 4); REDE_CE(6, 8);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8);
+}
+
+static inline void redeOrdenacao10(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(0, 4); REDE_CE(3, 7);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(0, 8);
+    REDE_CE(2, 4); REDE_CE(3, 5);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6);
+    REDE_CE(1, 9); REDE_CE(4, 8);
+    REDE_CE(5, 9); REDE_CE(2, 4); REDE_CE(6, 8);
+    REDE_CE(3, 5); REDE_CE(7, 9); REDE_CE(1, 2);
+    REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8);
+}
+
+static inline void redeOrdenacao11(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(0, 4); REDE_CE(3, 7);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 10); REDE_CE(0, 8);
+    REDE_CE(2, 4); REDE_CE(3, 5);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(4, 8);
+    REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(2, 4);
+    REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(1, 2);
+    REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10);
+}
+
+static inline void redeOrdenacao12(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(0, 4); REDE_CE(3, 7);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 10); REDE_CE(0, 8);
+    REDE_CE(2, 4); REDE_CE(3, 5);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 8);
+    REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(2, 4);
+    REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(1, 2);
+    REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10);
+}
+
+static inline void redeOrdenacao13(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(10, 12); REDE_CE(0, 8);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(9, 10); REDE_CE(11, 12);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12);
+}
+
+static inline void redeOrdenacao14(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 12); REDE_CE(0, 8);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(11, 13); REDE_CE(9, 10);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(11, 12);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12);
+}
+
+static inline void redeOrdenacao15(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(0, 8);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+}
+
+static inline void redeOrdenacao16(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(0, 8); REDE_CE(7, 15);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+}
+
+static inline void redeOrdenacao17(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(0, 8); REDE_CE(7, 15);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(8, 16); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11);
+    REDE_CE(4, 8); REDE_CE(12, 16); REDE_CE(3, 5); REDE_CE(7, 9); REDE_CE(11, 13);
+    REDE_CE(2, 4); REDE_CE(6, 8); REDE_CE(10, 12); REDE_CE(14, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16);
+}
+
+static inline void redeOrdenacao18(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(0, 8); REDE_CE(7, 15);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 17); REDE_CE(8, 16); REDE_CE(6, 10); REDE_CE(7, 11);
+    REDE_CE(9, 17); REDE_CE(4, 8); REDE_CE(12, 16);
+    REDE_CE(5, 9); REDE_CE(13, 17); REDE_CE(2, 4); REDE_CE(6, 8); REDE_CE(10, 12); REDE_CE(14, 16);
+    REDE_CE(3, 5); REDE_CE(7, 9); REDE_CE(11, 13); REDE_CE(15, 17); REDE_CE(1, 2);
+    REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16);
+}
+
+static inline void redeOrdenacao19(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 18); REDE_CE(0, 8); REDE_CE(7, 15);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(17, 18); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(8, 16); REDE_CE(7, 11);
+    REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(4, 8); REDE_CE(12, 16);
+    REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(2, 4);
+    REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(1, 2);
+    REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18);
+}
+
+static inline void redeOrdenacao20(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 18); REDE_CE(0, 8); REDE_CE(7, 15);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(17, 18); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(8, 16);
+    REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(4, 8); REDE_CE(12, 16);
+    REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(2, 4);
+    REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(1, 2);
+    REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18);
+}
+
+static inline void redeOrdenacao21(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(18, 20); REDE_CE(0, 8); REDE_CE(7, 15);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(18, 20);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(17, 18); REDE_CE(19, 20);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(8, 16);
+    REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(4, 8);
+    REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(2, 4);
+    REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(1, 2);
+    REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20);
+}
+
+static inline void redeOrdenacao22(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19); REDE_CE(20, 21);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 21); REDE_CE(18, 20); REDE_CE(0, 8); REDE_CE(7, 15);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(19, 21); REDE_CE(17, 18); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(19, 20);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(18, 20); REDE_CE(19, 21);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(17, 18); REDE_CE(19, 20);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(5, 21); REDE_CE(8, 16);
+    REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(13, 21); REDE_CE(4, 8);
+    REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(2, 4);
+    REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(1, 2);
+    REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20);
+}
+
+static inline void redeOrdenacao23(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19); REDE_CE(20, 21);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19); REDE_CE(20, 22);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(21, 22); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 21); REDE_CE(18, 22); REDE_CE(0, 8); REDE_CE(7, 15);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(18, 20); REDE_CE(19, 21);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(5, 21); REDE_CE(6, 22); REDE_CE(8, 16);
+    REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(13, 21); REDE_CE(14, 22); REDE_CE(4, 8);
+    REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(2, 4);
+    REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(1, 2);
+    REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22);
+}
+
+static inline void redeOrdenacao24(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19); REDE_CE(20, 21); REDE_CE(22, 23);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19); REDE_CE(20, 22); REDE_CE(21, 23);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(21, 22); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20); REDE_CE(19, 23);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 21); REDE_CE(18, 22); REDE_CE(0, 8); REDE_CE(7, 15);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(18, 20); REDE_CE(19, 21);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(5, 21); REDE_CE(6, 22); REDE_CE(7, 23); REDE_CE(8, 16);
+    REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(13, 21); REDE_CE(14, 22); REDE_CE(15, 23); REDE_CE(4, 8);
+    REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(2, 4);
+    REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(1, 2);
+    REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22);
+}
+
+static inline void redeOrdenacao25(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19); REDE_CE(20, 21); REDE_CE(22, 23);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19); REDE_CE(20, 22); REDE_CE(21, 23);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(21, 22); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20); REDE_CE(19, 23);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 21); REDE_CE(18, 22); REDE_CE(0, 8); REDE_CE(7, 15); REDE_CE(16, 24);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(20, 24); REDE_CE(19, 21);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(18, 20); REDE_CE(22, 24);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(5, 21); REDE_CE(6, 22); REDE_CE(7, 23); REDE_CE(8, 24);
+    REDE_CE(8, 16); REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(13, 21); REDE_CE(14, 22); REDE_CE(15, 23);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(20, 24);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24);
+}
+
+static inline void redeOrdenacao26(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19); REDE_CE(20, 21); REDE_CE(22, 23); REDE_CE(24, 25);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19); REDE_CE(20, 22); REDE_CE(21, 23);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(21, 22); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20); REDE_CE(19, 23);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 21); REDE_CE(18, 22); REDE_CE(0, 8); REDE_CE(7, 15); REDE_CE(16, 24);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(17, 25); REDE_CE(20, 24);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(21, 25); REDE_CE(18, 20); REDE_CE(22, 24);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(19, 21); REDE_CE(23, 25); REDE_CE(17, 18);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(5, 21); REDE_CE(6, 22); REDE_CE(7, 23); REDE_CE(8, 24); REDE_CE(9, 25);
+    REDE_CE(8, 16); REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(13, 21); REDE_CE(14, 22); REDE_CE(15, 23);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(20, 24); REDE_CE(21, 25);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24);
+}
+
+static inline void redeOrdenacao27(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19); REDE_CE(20, 21); REDE_CE(22, 23); REDE_CE(24, 25);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19); REDE_CE(20, 22); REDE_CE(21, 23); REDE_CE(24, 26);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(21, 22); REDE_CE(25, 26); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20); REDE_CE(19, 23);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 21); REDE_CE(18, 22); REDE_CE(25, 26); REDE_CE(0, 8); REDE_CE(7, 15); REDE_CE(16, 24);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(17, 25); REDE_CE(18, 26); REDE_CE(20, 24);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(21, 25); REDE_CE(22, 26); REDE_CE(18, 20);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25); REDE_CE(17, 18);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(5, 21); REDE_CE(6, 22); REDE_CE(7, 23); REDE_CE(8, 24); REDE_CE(9, 25); REDE_CE(10, 26);
+    REDE_CE(8, 16); REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(13, 21); REDE_CE(14, 22); REDE_CE(15, 23);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(20, 24); REDE_CE(21, 25); REDE_CE(22, 26);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26);
+}
+
+static inline void redeOrdenacao28(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19); REDE_CE(20, 21); REDE_CE(22, 23); REDE_CE(24, 25); REDE_CE(26, 27);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19); REDE_CE(20, 22); REDE_CE(21, 23); REDE_CE(24, 26); REDE_CE(25, 27);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(21, 22); REDE_CE(25, 26); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20); REDE_CE(19, 23);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 21); REDE_CE(18, 22); REDE_CE(25, 26); REDE_CE(0, 8); REDE_CE(7, 15); REDE_CE(16, 24);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(17, 25); REDE_CE(18, 26); REDE_CE(19, 27); REDE_CE(20, 24);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(21, 25); REDE_CE(22, 26); REDE_CE(23, 27); REDE_CE(18, 20);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25); REDE_CE(17, 18);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(5, 21); REDE_CE(6, 22); REDE_CE(7, 23); REDE_CE(8, 24); REDE_CE(9, 25); REDE_CE(10, 26); REDE_CE(11, 27);
+    REDE_CE(8, 16); REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(13, 21); REDE_CE(14, 22); REDE_CE(15, 23);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(20, 24); REDE_CE(21, 25); REDE_CE(22, 26); REDE_CE(23, 27);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26);
+}
+
+static inline void redeOrdenacao29(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19); REDE_CE(20, 21); REDE_CE(22, 23); REDE_CE(24, 25); REDE_CE(26, 27);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19); REDE_CE(20, 22); REDE_CE(21, 23); REDE_CE(24, 26); REDE_CE(25, 27);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(21, 22); REDE_CE(25, 26); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20); REDE_CE(19, 23); REDE_CE(24, 28);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 21); REDE_CE(18, 22); REDE_CE(26, 28); REDE_CE(0, 8); REDE_CE(7, 15); REDE_CE(16, 24);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(25, 26); REDE_CE(27, 28); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(17, 25); REDE_CE(18, 26); REDE_CE(19, 27); REDE_CE(20, 28);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(20, 24); REDE_CE(21, 25); REDE_CE(22, 26); REDE_CE(23, 27);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25); REDE_CE(26, 28);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26); REDE_CE(27, 28);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(5, 21); REDE_CE(6, 22); REDE_CE(7, 23); REDE_CE(8, 24); REDE_CE(9, 25); REDE_CE(10, 26); REDE_CE(11, 27); REDE_CE(12, 28);
+    REDE_CE(8, 16); REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(13, 21); REDE_CE(14, 22); REDE_CE(15, 23);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(20, 24); REDE_CE(21, 25); REDE_CE(22, 26); REDE_CE(23, 27);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25); REDE_CE(26, 28);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26); REDE_CE(27, 28);
+}
+
+static inline void redeOrdenacao30(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19); REDE_CE(20, 21); REDE_CE(22, 23); REDE_CE(24, 25); REDE_CE(26, 27); REDE_CE(28, 29);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19); REDE_CE(20, 22); REDE_CE(21, 23); REDE_CE(24, 26); REDE_CE(25, 27);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(21, 22); REDE_CE(25, 26); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20); REDE_CE(19, 23); REDE_CE(24, 28);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 21); REDE_CE(18, 22); REDE_CE(25, 29); REDE_CE(26, 28); REDE_CE(0, 8); REDE_CE(7, 15); REDE_CE(16, 24);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(27, 29); REDE_CE(25, 26); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(27, 28);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(17, 25); REDE_CE(18, 26); REDE_CE(19, 27); REDE_CE(20, 28); REDE_CE(21, 29);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(20, 24); REDE_CE(21, 25); REDE_CE(22, 26); REDE_CE(23, 27);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25); REDE_CE(26, 28); REDE_CE(27, 29);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26); REDE_CE(27, 28);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(5, 21); REDE_CE(6, 22); REDE_CE(7, 23); REDE_CE(8, 24); REDE_CE(9, 25); REDE_CE(10, 26); REDE_CE(11, 27); REDE_CE(12, 28); REDE_CE(13, 29);
+    REDE_CE(8, 16); REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(13, 21); REDE_CE(14, 22); REDE_CE(15, 23);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(20, 24); REDE_CE(21, 25); REDE_CE(22, 26); REDE_CE(23, 27);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25); REDE_CE(26, 28); REDE_CE(27, 29);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26); REDE_CE(27, 28);
+}
+
+static inline void redeOrdenacao31(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19); REDE_CE(20, 21); REDE_CE(22, 23); REDE_CE(24, 25); REDE_CE(26, 27); REDE_CE(28, 29);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19); REDE_CE(20, 22); REDE_CE(21, 23); REDE_CE(24, 26); REDE_CE(25, 27); REDE_CE(28, 30);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(21, 22); REDE_CE(25, 26); REDE_CE(29, 30); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20); REDE_CE(19, 23); REDE_CE(24, 28);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 21); REDE_CE(18, 22); REDE_CE(25, 29); REDE_CE(26, 30); REDE_CE(0, 8); REDE_CE(7, 15); REDE_CE(16, 24);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(26, 28); REDE_CE(27, 29); REDE_CE(0, 16);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(25, 26); REDE_CE(27, 28); REDE_CE(29, 30);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(17, 25); REDE_CE(18, 26); REDE_CE(19, 27); REDE_CE(20, 28); REDE_CE(21, 29); REDE_CE(22, 30);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(20, 24); REDE_CE(21, 25); REDE_CE(22, 26); REDE_CE(23, 27);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25); REDE_CE(26, 28); REDE_CE(27, 29);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26); REDE_CE(27, 28); REDE_CE(29, 30);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(5, 21); REDE_CE(6, 22); REDE_CE(7, 23); REDE_CE(8, 24); REDE_CE(9, 25); REDE_CE(10, 26); REDE_CE(11, 27); REDE_CE(12, 28); REDE_CE(13, 29); REDE_CE(14, 30);
+    REDE_CE(8, 16); REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(13, 21); REDE_CE(14, 22); REDE_CE(15, 23);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(20, 24); REDE_CE(21, 25); REDE_CE(22, 26); REDE_CE(23, 27);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25); REDE_CE(26, 28); REDE_CE(27, 29);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26); REDE_CE(27, 28); REDE_CE(29, 30);
+}
+
+static inline void redeOrdenacao32(int v[])
+{
+    REDE_CE(0, 1); REDE_CE(2, 3); REDE_CE(4, 5); REDE_CE(6, 7); REDE_CE(8, 9); REDE_CE(10, 11); REDE_CE(12, 13); REDE_CE(14, 15); REDE_CE(16, 17); REDE_CE(18, 19); REDE_CE(20, 21); REDE_CE(22, 23); REDE_CE(24, 25); REDE_CE(26, 27); REDE_CE(28, 29); REDE_CE(30, 31);
+    REDE_CE(0, 2); REDE_CE(1, 3); REDE_CE(4, 6); REDE_CE(5, 7); REDE_CE(8, 10); REDE_CE(9, 11); REDE_CE(12, 14); REDE_CE(13, 15); REDE_CE(16, 18); REDE_CE(17, 19); REDE_CE(20, 22); REDE_CE(21, 23); REDE_CE(24, 26); REDE_CE(25, 27); REDE_CE(28, 30); REDE_CE(29, 31);
+    REDE_CE(1, 2); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(21, 22); REDE_CE(25, 26); REDE_CE(29, 30); REDE_CE(0, 4); REDE_CE(3, 7); REDE_CE(8, 12); REDE_CE(11, 15); REDE_CE(16, 20); REDE_CE(19, 23); REDE_CE(24, 28); REDE_CE(27, 31);
+    REDE_CE(1, 5); REDE_CE(2, 6); REDE_CE(9, 13); REDE_CE(10, 14); REDE_CE(17, 21); REDE_CE(18, 22); REDE_CE(25, 29); REDE_CE(26, 30); REDE_CE(0, 8); REDE_CE(7, 15); REDE_CE(16, 24); REDE_CE(23, 31);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(26, 28); REDE_CE(27, 29); REDE_CE(0, 16); REDE_CE(15, 31);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(25, 26); REDE_CE(27, 28); REDE_CE(29, 30);
+    REDE_CE(1, 9); REDE_CE(2, 10); REDE_CE(3, 11); REDE_CE(4, 12); REDE_CE(5, 13); REDE_CE(6, 14); REDE_CE(17, 25); REDE_CE(18, 26); REDE_CE(19, 27); REDE_CE(20, 28); REDE_CE(21, 29); REDE_CE(22, 30);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(20, 24); REDE_CE(21, 25); REDE_CE(22, 26); REDE_CE(23, 27);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25); REDE_CE(26, 28); REDE_CE(27, 29);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26); REDE_CE(27, 28); REDE_CE(29, 30);
+    REDE_CE(1, 17); REDE_CE(2, 18); REDE_CE(3, 19); REDE_CE(4, 20); REDE_CE(5, 21); REDE_CE(6, 22); REDE_CE(7, 23); REDE_CE(8, 24); REDE_CE(9, 25); REDE_CE(10, 26); REDE_CE(11, 27); REDE_CE(12, 28); REDE_CE(13, 29); REDE_CE(14, 30);
+    REDE_CE(8, 16); REDE_CE(9, 17); REDE_CE(10, 18); REDE_CE(11, 19); REDE_CE(12, 20); REDE_CE(13, 21); REDE_CE(14, 22); REDE_CE(15, 23);
+    REDE_CE(4, 8); REDE_CE(5, 9); REDE_CE(6, 10); REDE_CE(7, 11); REDE_CE(12, 16); REDE_CE(13, 17); REDE_CE(14, 18); REDE_CE(15, 19); REDE_CE(20, 24); REDE_CE(21, 25); REDE_CE(22, 26); REDE_CE(23, 27);
+    REDE_CE(2, 4); REDE_CE(3, 5); REDE_CE(6, 8); REDE_CE(7, 9); REDE_CE(10, 12); REDE_CE(11, 13); REDE_CE(14, 16); REDE_CE(15, 17); REDE_CE(18, 20); REDE_CE(19, 21); REDE_CE(22, 24); REDE_CE(23, 25); REDE_CE(26, 28); REDE_CE(27, 29);
+    REDE_CE(1, 2); REDE_CE(3, 4); REDE_CE(5, 6); REDE_CE(7, 8); REDE_CE(9, 10); REDE_CE(11, 12); REDE_CE(13, 14); REDE_CE(15, 16); REDE_CE(17, 18); REDE_CE(19, 20); REDE_CE(21, 22); REDE_CE(23, 24); REDE_CE(25, 26); REDE_CE(27, 28); REDE_CE(29, 30);
+}
+
+static const FuncaoRede redesOrdenacao[REDE_TAM_MAX + 1] = {
+    NULL, NULL, redeOrdenacao2, redeOrdenacao3,
+    redeOrdenacao4, redeOrdenacao5, redeOrdenacao6, redeOrdenacao7,
+    redeOrdenacao8, redeOrdenacao9, redeOrdenacao10, redeOrdenacao11,
+    redeOrdenacao12, redeOrdenacao13, redeOrdenacao14, redeOrdenacao15,
+    redeOrdenacao16, redeOrdenacao17, redeOrdenacao18, redeOrdenacao19,
+    redeOrdenacao20, redeOrdenacao21, redeOrdenacao22, redeOrdenacao23,
+    redeOrdenacao24, redeOrdenacao25, redeOrdenacao26, redeOrdenacao27,
+    redeOrdenacao28, redeOrdenacao29, redeOrdenacao30, redeOrdenacao31,
+    redeOrdenacao32};
+
+#ifdef SIMD_X86
+/* Comparadores vetoriais: cada lane pertence a um vetor diferente */
+#define REDE_CE_AVX2(i, j)                            \
+    do                                                \
+    {                                                 \
+        __m256i a_ = v[i];                            \
+        v[i] = _mm256_min_epi32(a_, v[j]);            \
+        v[j] = _mm256_max_epi32(a_, v[j]);            \
+    } while (0)
+
+#define REDE_CE_AVX512(i, j)                          \
+    do                                                \
+    {                                                 \
+        __m512i a_ = v[i];                            \
+        v[i] = _mm512_min_epi32(a_, v[j]);            \
+        v[j] = _mm512_max_epi32(a_, v[j]);            \
+    } while (0)
+
+typedef void (*FuncaoRedeAVX2)(__m256i v[]);
+typedef void (*FuncaoRedeAVX512)(__m512i v[]);
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_2(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_3(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1);
+    REDE_CE_AVX2(0, 2);
+    REDE_CE_AVX2(1, 2);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_4(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3);
+    REDE_CE_AVX2(1, 2);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_5(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(0, 4);
+    REDE_CE_AVX2(2, 4);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_6(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(0, 4);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 4);
+    REDE_CE_AVX2(3, 5); REDE_CE_AVX2(1, 2);
+    REDE_CE_AVX2(3, 4);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_7(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(0, 4);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_8(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_9(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(0, 8);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(3, 5);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(6, 8);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_10(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(0, 8);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(4, 8);
+    REDE_CE_AVX2(5, 9); REDE_CE_AVX2(2, 4); REDE_CE_AVX2(6, 8);
+    REDE_CE_AVX2(3, 5); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(1, 2);
+    REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_11(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(0, 8);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(4, 8);
+    REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(2, 4);
+    REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(1, 2);
+    REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_12(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(0, 8);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 8);
+    REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(2, 4);
+    REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(1, 2);
+    REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_13(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(0, 8);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_14(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(0, 8);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(9, 10);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(11, 12);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_15(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(0, 8);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_16(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_17(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(8, 16); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(14, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_18(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(8, 16); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(9, 17); REDE_CE_AVX2(4, 8); REDE_CE_AVX2(12, 16);
+    REDE_CE_AVX2(5, 9); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(2, 4); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(14, 16);
+    REDE_CE_AVX2(3, 5); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(1, 2);
+    REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_19(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(8, 16); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(4, 8); REDE_CE_AVX2(12, 16);
+    REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(2, 4);
+    REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(1, 2);
+    REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_20(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(8, 16);
+    REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(4, 8); REDE_CE_AVX2(12, 16);
+    REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(2, 4);
+    REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(1, 2);
+    REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_21(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(18, 20);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(8, 16);
+    REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(4, 8);
+    REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(2, 4);
+    REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(1, 2);
+    REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_22(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19); REDE_CE_AVX2(20, 21);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 21); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(19, 20);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(5, 21); REDE_CE_AVX2(8, 16);
+    REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(13, 21); REDE_CE_AVX2(4, 8);
+    REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(2, 4);
+    REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(1, 2);
+    REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_23(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19); REDE_CE_AVX2(20, 21);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19); REDE_CE_AVX2(20, 22);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 21); REDE_CE_AVX2(18, 22); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(5, 21); REDE_CE_AVX2(6, 22); REDE_CE_AVX2(8, 16);
+    REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(13, 21); REDE_CE_AVX2(14, 22); REDE_CE_AVX2(4, 8);
+    REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(2, 4);
+    REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(1, 2);
+    REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_24(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19); REDE_CE_AVX2(20, 21); REDE_CE_AVX2(22, 23);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19); REDE_CE_AVX2(20, 22); REDE_CE_AVX2(21, 23);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20); REDE_CE_AVX2(19, 23);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 21); REDE_CE_AVX2(18, 22); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(5, 21); REDE_CE_AVX2(6, 22); REDE_CE_AVX2(7, 23); REDE_CE_AVX2(8, 16);
+    REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(13, 21); REDE_CE_AVX2(14, 22); REDE_CE_AVX2(15, 23); REDE_CE_AVX2(4, 8);
+    REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(2, 4);
+    REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(1, 2);
+    REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_25(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19); REDE_CE_AVX2(20, 21); REDE_CE_AVX2(22, 23);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19); REDE_CE_AVX2(20, 22); REDE_CE_AVX2(21, 23);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20); REDE_CE_AVX2(19, 23);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 21); REDE_CE_AVX2(18, 22); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15); REDE_CE_AVX2(16, 24);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(19, 21);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(22, 24);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(5, 21); REDE_CE_AVX2(6, 22); REDE_CE_AVX2(7, 23); REDE_CE_AVX2(8, 24);
+    REDE_CE_AVX2(8, 16); REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(13, 21); REDE_CE_AVX2(14, 22); REDE_CE_AVX2(15, 23);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(20, 24);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_26(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19); REDE_CE_AVX2(20, 21); REDE_CE_AVX2(22, 23); REDE_CE_AVX2(24, 25);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19); REDE_CE_AVX2(20, 22); REDE_CE_AVX2(21, 23);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20); REDE_CE_AVX2(19, 23);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 21); REDE_CE_AVX2(18, 22); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15); REDE_CE_AVX2(16, 24);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(17, 25); REDE_CE_AVX2(20, 24);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(22, 24);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(23, 25); REDE_CE_AVX2(17, 18);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(5, 21); REDE_CE_AVX2(6, 22); REDE_CE_AVX2(7, 23); REDE_CE_AVX2(8, 24); REDE_CE_AVX2(9, 25);
+    REDE_CE_AVX2(8, 16); REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(13, 21); REDE_CE_AVX2(14, 22); REDE_CE_AVX2(15, 23);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(21, 25);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_27(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19); REDE_CE_AVX2(20, 21); REDE_CE_AVX2(22, 23); REDE_CE_AVX2(24, 25);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19); REDE_CE_AVX2(20, 22); REDE_CE_AVX2(21, 23); REDE_CE_AVX2(24, 26);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20); REDE_CE_AVX2(19, 23);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 21); REDE_CE_AVX2(18, 22); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15); REDE_CE_AVX2(16, 24);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(17, 25); REDE_CE_AVX2(18, 26); REDE_CE_AVX2(20, 24);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26); REDE_CE_AVX2(18, 20);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25); REDE_CE_AVX2(17, 18);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(5, 21); REDE_CE_AVX2(6, 22); REDE_CE_AVX2(7, 23); REDE_CE_AVX2(8, 24); REDE_CE_AVX2(9, 25); REDE_CE_AVX2(10, 26);
+    REDE_CE_AVX2(8, 16); REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(13, 21); REDE_CE_AVX2(14, 22); REDE_CE_AVX2(15, 23);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_28(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19); REDE_CE_AVX2(20, 21); REDE_CE_AVX2(22, 23); REDE_CE_AVX2(24, 25); REDE_CE_AVX2(26, 27);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19); REDE_CE_AVX2(20, 22); REDE_CE_AVX2(21, 23); REDE_CE_AVX2(24, 26); REDE_CE_AVX2(25, 27);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20); REDE_CE_AVX2(19, 23);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 21); REDE_CE_AVX2(18, 22); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15); REDE_CE_AVX2(16, 24);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(17, 25); REDE_CE_AVX2(18, 26); REDE_CE_AVX2(19, 27); REDE_CE_AVX2(20, 24);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26); REDE_CE_AVX2(23, 27); REDE_CE_AVX2(18, 20);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25); REDE_CE_AVX2(17, 18);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(5, 21); REDE_CE_AVX2(6, 22); REDE_CE_AVX2(7, 23); REDE_CE_AVX2(8, 24); REDE_CE_AVX2(9, 25); REDE_CE_AVX2(10, 26); REDE_CE_AVX2(11, 27);
+    REDE_CE_AVX2(8, 16); REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(13, 21); REDE_CE_AVX2(14, 22); REDE_CE_AVX2(15, 23);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26); REDE_CE_AVX2(23, 27);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_29(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19); REDE_CE_AVX2(20, 21); REDE_CE_AVX2(22, 23); REDE_CE_AVX2(24, 25); REDE_CE_AVX2(26, 27);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19); REDE_CE_AVX2(20, 22); REDE_CE_AVX2(21, 23); REDE_CE_AVX2(24, 26); REDE_CE_AVX2(25, 27);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20); REDE_CE_AVX2(19, 23); REDE_CE_AVX2(24, 28);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 21); REDE_CE_AVX2(18, 22); REDE_CE_AVX2(26, 28); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15); REDE_CE_AVX2(16, 24);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(27, 28); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(17, 25); REDE_CE_AVX2(18, 26); REDE_CE_AVX2(19, 27); REDE_CE_AVX2(20, 28);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26); REDE_CE_AVX2(23, 27);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25); REDE_CE_AVX2(26, 28);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(27, 28);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(5, 21); REDE_CE_AVX2(6, 22); REDE_CE_AVX2(7, 23); REDE_CE_AVX2(8, 24); REDE_CE_AVX2(9, 25); REDE_CE_AVX2(10, 26); REDE_CE_AVX2(11, 27); REDE_CE_AVX2(12, 28);
+    REDE_CE_AVX2(8, 16); REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(13, 21); REDE_CE_AVX2(14, 22); REDE_CE_AVX2(15, 23);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26); REDE_CE_AVX2(23, 27);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25); REDE_CE_AVX2(26, 28);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(27, 28);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_30(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19); REDE_CE_AVX2(20, 21); REDE_CE_AVX2(22, 23); REDE_CE_AVX2(24, 25); REDE_CE_AVX2(26, 27); REDE_CE_AVX2(28, 29);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19); REDE_CE_AVX2(20, 22); REDE_CE_AVX2(21, 23); REDE_CE_AVX2(24, 26); REDE_CE_AVX2(25, 27);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20); REDE_CE_AVX2(19, 23); REDE_CE_AVX2(24, 28);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 21); REDE_CE_AVX2(18, 22); REDE_CE_AVX2(25, 29); REDE_CE_AVX2(26, 28); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15); REDE_CE_AVX2(16, 24);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(27, 29); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(27, 28);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(17, 25); REDE_CE_AVX2(18, 26); REDE_CE_AVX2(19, 27); REDE_CE_AVX2(20, 28); REDE_CE_AVX2(21, 29);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26); REDE_CE_AVX2(23, 27);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25); REDE_CE_AVX2(26, 28); REDE_CE_AVX2(27, 29);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(27, 28);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(5, 21); REDE_CE_AVX2(6, 22); REDE_CE_AVX2(7, 23); REDE_CE_AVX2(8, 24); REDE_CE_AVX2(9, 25); REDE_CE_AVX2(10, 26); REDE_CE_AVX2(11, 27); REDE_CE_AVX2(12, 28); REDE_CE_AVX2(13, 29);
+    REDE_CE_AVX2(8, 16); REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(13, 21); REDE_CE_AVX2(14, 22); REDE_CE_AVX2(15, 23);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26); REDE_CE_AVX2(23, 27);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25); REDE_CE_AVX2(26, 28); REDE_CE_AVX2(27, 29);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(27, 28);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_31(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19); REDE_CE_AVX2(20, 21); REDE_CE_AVX2(22, 23); REDE_CE_AVX2(24, 25); REDE_CE_AVX2(26, 27); REDE_CE_AVX2(28, 29);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19); REDE_CE_AVX2(20, 22); REDE_CE_AVX2(21, 23); REDE_CE_AVX2(24, 26); REDE_CE_AVX2(25, 27); REDE_CE_AVX2(28, 30);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(29, 30); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20); REDE_CE_AVX2(19, 23); REDE_CE_AVX2(24, 28);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 21); REDE_CE_AVX2(18, 22); REDE_CE_AVX2(25, 29); REDE_CE_AVX2(26, 30); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15); REDE_CE_AVX2(16, 24);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(26, 28); REDE_CE_AVX2(27, 29); REDE_CE_AVX2(0, 16);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(27, 28); REDE_CE_AVX2(29, 30);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(17, 25); REDE_CE_AVX2(18, 26); REDE_CE_AVX2(19, 27); REDE_CE_AVX2(20, 28); REDE_CE_AVX2(21, 29); REDE_CE_AVX2(22, 30);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26); REDE_CE_AVX2(23, 27);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25); REDE_CE_AVX2(26, 28); REDE_CE_AVX2(27, 29);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(27, 28); REDE_CE_AVX2(29, 30);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(5, 21); REDE_CE_AVX2(6, 22); REDE_CE_AVX2(7, 23); REDE_CE_AVX2(8, 24); REDE_CE_AVX2(9, 25); REDE_CE_AVX2(10, 26); REDE_CE_AVX2(11, 27); REDE_CE_AVX2(12, 28); REDE_CE_AVX2(13, 29); REDE_CE_AVX2(14, 30);
+    REDE_CE_AVX2(8, 16); REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(13, 21); REDE_CE_AVX2(14, 22); REDE_CE_AVX2(15, 23);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26); REDE_CE_AVX2(23, 27);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25); REDE_CE_AVX2(26, 28); REDE_CE_AVX2(27, 29);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(27, 28); REDE_CE_AVX2(29, 30);
+}
+
+static inline __attribute__((target("avx2"))) void redeOrdenacaoAVX2_32(__m256i v[])
+{
+    REDE_CE_AVX2(0, 1); REDE_CE_AVX2(2, 3); REDE_CE_AVX2(4, 5); REDE_CE_AVX2(6, 7); REDE_CE_AVX2(8, 9); REDE_CE_AVX2(10, 11); REDE_CE_AVX2(12, 13); REDE_CE_AVX2(14, 15); REDE_CE_AVX2(16, 17); REDE_CE_AVX2(18, 19); REDE_CE_AVX2(20, 21); REDE_CE_AVX2(22, 23); REDE_CE_AVX2(24, 25); REDE_CE_AVX2(26, 27); REDE_CE_AVX2(28, 29); REDE_CE_AVX2(30, 31);
+    REDE_CE_AVX2(0, 2); REDE_CE_AVX2(1, 3); REDE_CE_AVX2(4, 6); REDE_CE_AVX2(5, 7); REDE_CE_AVX2(8, 10); REDE_CE_AVX2(9, 11); REDE_CE_AVX2(12, 14); REDE_CE_AVX2(13, 15); REDE_CE_AVX2(16, 18); REDE_CE_AVX2(17, 19); REDE_CE_AVX2(20, 22); REDE_CE_AVX2(21, 23); REDE_CE_AVX2(24, 26); REDE_CE_AVX2(25, 27); REDE_CE_AVX2(28, 30); REDE_CE_AVX2(29, 31);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(29, 30); REDE_CE_AVX2(0, 4); REDE_CE_AVX2(3, 7); REDE_CE_AVX2(8, 12); REDE_CE_AVX2(11, 15); REDE_CE_AVX2(16, 20); REDE_CE_AVX2(19, 23); REDE_CE_AVX2(24, 28); REDE_CE_AVX2(27, 31);
+    REDE_CE_AVX2(1, 5); REDE_CE_AVX2(2, 6); REDE_CE_AVX2(9, 13); REDE_CE_AVX2(10, 14); REDE_CE_AVX2(17, 21); REDE_CE_AVX2(18, 22); REDE_CE_AVX2(25, 29); REDE_CE_AVX2(26, 30); REDE_CE_AVX2(0, 8); REDE_CE_AVX2(7, 15); REDE_CE_AVX2(16, 24); REDE_CE_AVX2(23, 31);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(26, 28); REDE_CE_AVX2(27, 29); REDE_CE_AVX2(0, 16); REDE_CE_AVX2(15, 31);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(27, 28); REDE_CE_AVX2(29, 30);
+    REDE_CE_AVX2(1, 9); REDE_CE_AVX2(2, 10); REDE_CE_AVX2(3, 11); REDE_CE_AVX2(4, 12); REDE_CE_AVX2(5, 13); REDE_CE_AVX2(6, 14); REDE_CE_AVX2(17, 25); REDE_CE_AVX2(18, 26); REDE_CE_AVX2(19, 27); REDE_CE_AVX2(20, 28); REDE_CE_AVX2(21, 29); REDE_CE_AVX2(22, 30);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26); REDE_CE_AVX2(23, 27);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25); REDE_CE_AVX2(26, 28); REDE_CE_AVX2(27, 29);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(27, 28); REDE_CE_AVX2(29, 30);
+    REDE_CE_AVX2(1, 17); REDE_CE_AVX2(2, 18); REDE_CE_AVX2(3, 19); REDE_CE_AVX2(4, 20); REDE_CE_AVX2(5, 21); REDE_CE_AVX2(6, 22); REDE_CE_AVX2(7, 23); REDE_CE_AVX2(8, 24); REDE_CE_AVX2(9, 25); REDE_CE_AVX2(10, 26); REDE_CE_AVX2(11, 27); REDE_CE_AVX2(12, 28); REDE_CE_AVX2(13, 29); REDE_CE_AVX2(14, 30);
+    REDE_CE_AVX2(8, 16); REDE_CE_AVX2(9, 17); REDE_CE_AVX2(10, 18); REDE_CE_AVX2(11, 19); REDE_CE_AVX2(12, 20); REDE_CE_AVX2(13, 21); REDE_CE_AVX2(14, 22); REDE_CE_AVX2(15, 23);
+    REDE_CE_AVX2(4, 8); REDE_CE_AVX2(5, 9); REDE_CE_AVX2(6, 10); REDE_CE_AVX2(7, 11); REDE_CE_AVX2(12, 16); REDE_CE_AVX2(13, 17); REDE_CE_AVX2(14, 18); REDE_CE_AVX2(15, 19); REDE_CE_AVX2(20, 24); REDE_CE_AVX2(21, 25); REDE_CE_AVX2(22, 26); REDE_CE_AVX2(23, 27);
+    REDE_CE_AVX2(2, 4); REDE_CE_AVX2(3, 5); REDE_CE_AVX2(6, 8); REDE_CE_AVX2(7, 9); REDE_CE_AVX2(10, 12); REDE_CE_AVX2(11, 13); REDE_CE_AVX2(14, 16); REDE_CE_AVX2(15, 17); REDE_CE_AVX2(18, 20); REDE_CE_AVX2(19, 21); REDE_CE_AVX2(22, 24); REDE_CE_AVX2(23, 25); REDE_CE_AVX2(26, 28); REDE_CE_AVX2(27, 29);
+    REDE_CE_AVX2(1, 2); REDE_CE_AVX2(3, 4); REDE_CE_AVX2(5, 6); REDE_CE_AVX2(7, 8); REDE_CE_AVX2(9, 10); REDE_CE_AVX2(11, 12); REDE_CE_AVX2(13, 14); REDE_CE_AVX2(15, 16); REDE_CE_AVX2(17, 18); REDE_CE_AVX2(19, 20); REDE_CE_AVX2(21, 22); REDE_CE_AVX2(23, 24); REDE_CE_AVX2(25, 26); REDE_CE_AVX2(27, 28); REDE_CE_AVX2(29, 30);
+}
+
+static const FuncaoRedeAVX2 redesOrdenacaoAVX2[REDE_TAM_MAX + 1] = {
+    NULL, NULL, redeOrdenacaoAVX2_2, redeOrdenacaoAVX2_3,
+    redeOrdenacaoAVX2_4, redeOrdenacaoAVX2_5, redeOrdenacaoAVX2_6, redeOrdenacaoAVX2_7,
+    redeOrdenacaoAVX2_8, redeOrdenacaoAVX2_9, redeOrdenacaoAVX2_10, redeOrdenacaoAVX2_11,
+    redeOrdenacaoAVX2_12, redeOrdenacaoAVX2_13, redeOrdenacaoAVX2_14, redeOrdenacaoAVX2_15,
+    redeOrdenacaoAVX2_16, redeOrdenacaoAVX2_17, redeOrdenacaoAVX2_18, redeOrdenacaoAVX2_19,
+    redeOrdenacaoAVX2_20, redeOrdenacaoAVX2_21, redeOrdenacaoAVX2_22, redeOrdenacaoAVX2_23,
+    redeOrdenacaoAVX2_24, redeOrdenacaoAVX2_25, redeOrdenacaoAVX2_26, redeOrdenacaoAVX2_27,
+    redeOrdenacaoAVX2_28, redeOrdenacaoAVX2_29, redeOrdenacaoAVX2_30, redeOrdenacaoAVX2_31,
+    redeOrdenacaoAVX2_32};
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_2(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_3(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1);
+    REDE_CE_AVX512(0, 2);
+    REDE_CE_AVX512(1, 2);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_4(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3);
+    REDE_CE_AVX512(1, 2);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_5(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(0, 4);
+    REDE_CE_AVX512(2, 4);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_6(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(0, 4);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 4);
+    REDE_CE_AVX512(3, 5); REDE_CE_AVX512(1, 2);
+    REDE_CE_AVX512(3, 4);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_7(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(0, 4);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_8(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_9(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(0, 8);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(3, 5);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(6, 8);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_10(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(0, 8);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(4, 8);
+    REDE_CE_AVX512(5, 9); REDE_CE_AVX512(2, 4); REDE_CE_AVX512(6, 8);
+    REDE_CE_AVX512(3, 5); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(1, 2);
+    REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_11(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(0, 8);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(4, 8);
+    REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(2, 4);
+    REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(1, 2);
+    REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_12(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(0, 8);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 8);
+    REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(2, 4);
+    REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(1, 2);
+    REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_13(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(0, 8);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_14(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(0, 8);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(9, 10);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(11, 12);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_15(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(0, 8);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_16(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_17(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(8, 16); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(14, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_18(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(8, 16); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(9, 17); REDE_CE_AVX512(4, 8); REDE_CE_AVX512(12, 16);
+    REDE_CE_AVX512(5, 9); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(2, 4); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(14, 16);
+    REDE_CE_AVX512(3, 5); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(1, 2);
+    REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_19(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(8, 16); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(4, 8); REDE_CE_AVX512(12, 16);
+    REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(2, 4);
+    REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(1, 2);
+    REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_20(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(8, 16);
+    REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(4, 8); REDE_CE_AVX512(12, 16);
+    REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(2, 4);
+    REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(1, 2);
+    REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_21(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(18, 20);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(8, 16);
+    REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(4, 8);
+    REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(2, 4);
+    REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(1, 2);
+    REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_22(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19); REDE_CE_AVX512(20, 21);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 21); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(19, 20);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(5, 21); REDE_CE_AVX512(8, 16);
+    REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(13, 21); REDE_CE_AVX512(4, 8);
+    REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(2, 4);
+    REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(1, 2);
+    REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_23(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19); REDE_CE_AVX512(20, 21);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19); REDE_CE_AVX512(20, 22);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 21); REDE_CE_AVX512(18, 22); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(5, 21); REDE_CE_AVX512(6, 22); REDE_CE_AVX512(8, 16);
+    REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(13, 21); REDE_CE_AVX512(14, 22); REDE_CE_AVX512(4, 8);
+    REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(2, 4);
+    REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(1, 2);
+    REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_24(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19); REDE_CE_AVX512(20, 21); REDE_CE_AVX512(22, 23);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19); REDE_CE_AVX512(20, 22); REDE_CE_AVX512(21, 23);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20); REDE_CE_AVX512(19, 23);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 21); REDE_CE_AVX512(18, 22); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(5, 21); REDE_CE_AVX512(6, 22); REDE_CE_AVX512(7, 23); REDE_CE_AVX512(8, 16);
+    REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(13, 21); REDE_CE_AVX512(14, 22); REDE_CE_AVX512(15, 23); REDE_CE_AVX512(4, 8);
+    REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(2, 4);
+    REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(1, 2);
+    REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_25(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19); REDE_CE_AVX512(20, 21); REDE_CE_AVX512(22, 23);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19); REDE_CE_AVX512(20, 22); REDE_CE_AVX512(21, 23);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20); REDE_CE_AVX512(19, 23);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 21); REDE_CE_AVX512(18, 22); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15); REDE_CE_AVX512(16, 24);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(19, 21);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(22, 24);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(5, 21); REDE_CE_AVX512(6, 22); REDE_CE_AVX512(7, 23); REDE_CE_AVX512(8, 24);
+    REDE_CE_AVX512(8, 16); REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(13, 21); REDE_CE_AVX512(14, 22); REDE_CE_AVX512(15, 23);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(20, 24);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_26(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19); REDE_CE_AVX512(20, 21); REDE_CE_AVX512(22, 23); REDE_CE_AVX512(24, 25);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19); REDE_CE_AVX512(20, 22); REDE_CE_AVX512(21, 23);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20); REDE_CE_AVX512(19, 23);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 21); REDE_CE_AVX512(18, 22); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15); REDE_CE_AVX512(16, 24);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(17, 25); REDE_CE_AVX512(20, 24);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(22, 24);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(23, 25); REDE_CE_AVX512(17, 18);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(5, 21); REDE_CE_AVX512(6, 22); REDE_CE_AVX512(7, 23); REDE_CE_AVX512(8, 24); REDE_CE_AVX512(9, 25);
+    REDE_CE_AVX512(8, 16); REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(13, 21); REDE_CE_AVX512(14, 22); REDE_CE_AVX512(15, 23);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(21, 25);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_27(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19); REDE_CE_AVX512(20, 21); REDE_CE_AVX512(22, 23); REDE_CE_AVX512(24, 25);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19); REDE_CE_AVX512(20, 22); REDE_CE_AVX512(21, 23); REDE_CE_AVX512(24, 26);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20); REDE_CE_AVX512(19, 23);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 21); REDE_CE_AVX512(18, 22); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15); REDE_CE_AVX512(16, 24);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(17, 25); REDE_CE_AVX512(18, 26); REDE_CE_AVX512(20, 24);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26); REDE_CE_AVX512(18, 20);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25); REDE_CE_AVX512(17, 18);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(5, 21); REDE_CE_AVX512(6, 22); REDE_CE_AVX512(7, 23); REDE_CE_AVX512(8, 24); REDE_CE_AVX512(9, 25); REDE_CE_AVX512(10, 26);
+    REDE_CE_AVX512(8, 16); REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(13, 21); REDE_CE_AVX512(14, 22); REDE_CE_AVX512(15, 23);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_28(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19); REDE_CE_AVX512(20, 21); REDE_CE_AVX512(22, 23); REDE_CE_AVX512(24, 25); REDE_CE_AVX512(26, 27);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19); REDE_CE_AVX512(20, 22); REDE_CE_AVX512(21, 23); REDE_CE_AVX512(24, 26); REDE_CE_AVX512(25, 27);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20); REDE_CE_AVX512(19, 23);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 21); REDE_CE_AVX512(18, 22); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15); REDE_CE_AVX512(16, 24);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(17, 25); REDE_CE_AVX512(18, 26); REDE_CE_AVX512(19, 27); REDE_CE_AVX512(20, 24);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26); REDE_CE_AVX512(23, 27); REDE_CE_AVX512(18, 20);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25); REDE_CE_AVX512(17, 18);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(5, 21); REDE_CE_AVX512(6, 22); REDE_CE_AVX512(7, 23); REDE_CE_AVX512(8, 24); REDE_CE_AVX512(9, 25); REDE_CE_AVX512(10, 26); REDE_CE_AVX512(11, 27);
+    REDE_CE_AVX512(8, 16); REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(13, 21); REDE_CE_AVX512(14, 22); REDE_CE_AVX512(15, 23);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26); REDE_CE_AVX512(23, 27);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_29(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19); REDE_CE_AVX512(20, 21); REDE_CE_AVX512(22, 23); REDE_CE_AVX512(24, 25); REDE_CE_AVX512(26, 27);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19); REDE_CE_AVX512(20, 22); REDE_CE_AVX512(21, 23); REDE_CE_AVX512(24, 26); REDE_CE_AVX512(25, 27);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20); REDE_CE_AVX512(19, 23); REDE_CE_AVX512(24, 28);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 21); REDE_CE_AVX512(18, 22); REDE_CE_AVX512(26, 28); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15); REDE_CE_AVX512(16, 24);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(27, 28); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(17, 25); REDE_CE_AVX512(18, 26); REDE_CE_AVX512(19, 27); REDE_CE_AVX512(20, 28);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26); REDE_CE_AVX512(23, 27);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25); REDE_CE_AVX512(26, 28);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(27, 28);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(5, 21); REDE_CE_AVX512(6, 22); REDE_CE_AVX512(7, 23); REDE_CE_AVX512(8, 24); REDE_CE_AVX512(9, 25); REDE_CE_AVX512(10, 26); REDE_CE_AVX512(11, 27); REDE_CE_AVX512(12, 28);
+    REDE_CE_AVX512(8, 16); REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(13, 21); REDE_CE_AVX512(14, 22); REDE_CE_AVX512(15, 23);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26); REDE_CE_AVX512(23, 27);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25); REDE_CE_AVX512(26, 28);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(27, 28);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_30(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19); REDE_CE_AVX512(20, 21); REDE_CE_AVX512(22, 23); REDE_CE_AVX512(24, 25); REDE_CE_AVX512(26, 27); REDE_CE_AVX512(28, 29);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19); REDE_CE_AVX512(20, 22); REDE_CE_AVX512(21, 23); REDE_CE_AVX512(24, 26); REDE_CE_AVX512(25, 27);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20); REDE_CE_AVX512(19, 23); REDE_CE_AVX512(24, 28);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 21); REDE_CE_AVX512(18, 22); REDE_CE_AVX512(25, 29); REDE_CE_AVX512(26, 28); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15); REDE_CE_AVX512(16, 24);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(27, 29); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(27, 28);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(17, 25); REDE_CE_AVX512(18, 26); REDE_CE_AVX512(19, 27); REDE_CE_AVX512(20, 28); REDE_CE_AVX512(21, 29);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26); REDE_CE_AVX512(23, 27);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25); REDE_CE_AVX512(26, 28); REDE_CE_AVX512(27, 29);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(27, 28);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(5, 21); REDE_CE_AVX512(6, 22); REDE_CE_AVX512(7, 23); REDE_CE_AVX512(8, 24); REDE_CE_AVX512(9, 25); REDE_CE_AVX512(10, 26); REDE_CE_AVX512(11, 27); REDE_CE_AVX512(12, 28); REDE_CE_AVX512(13, 29);
+    REDE_CE_AVX512(8, 16); REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(13, 21); REDE_CE_AVX512(14, 22); REDE_CE_AVX512(15, 23);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26); REDE_CE_AVX512(23, 27);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25); REDE_CE_AVX512(26, 28); REDE_CE_AVX512(27, 29);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(27, 28);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_31(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19); REDE_CE_AVX512(20, 21); REDE_CE_AVX512(22, 23); REDE_CE_AVX512(24, 25); REDE_CE_AVX512(26, 27); REDE_CE_AVX512(28, 29);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19); REDE_CE_AVX512(20, 22); REDE_CE_AVX512(21, 23); REDE_CE_AVX512(24, 26); REDE_CE_AVX512(25, 27); REDE_CE_AVX512(28, 30);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(29, 30); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20); REDE_CE_AVX512(19, 23); REDE_CE_AVX512(24, 28);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 21); REDE_CE_AVX512(18, 22); REDE_CE_AVX512(25, 29); REDE_CE_AVX512(26, 30); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15); REDE_CE_AVX512(16, 24);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(26, 28); REDE_CE_AVX512(27, 29); REDE_CE_AVX512(0, 16);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(27, 28); REDE_CE_AVX512(29, 30);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(17, 25); REDE_CE_AVX512(18, 26); REDE_CE_AVX512(19, 27); REDE_CE_AVX512(20, 28); REDE_CE_AVX512(21, 29); REDE_CE_AVX512(22, 30);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26); REDE_CE_AVX512(23, 27);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25); REDE_CE_AVX512(26, 28); REDE_CE_AVX512(27, 29);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(27, 28); REDE_CE_AVX512(29, 30);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(5, 21); REDE_CE_AVX512(6, 22); REDE_CE_AVX512(7, 23); REDE_CE_AVX512(8, 24); REDE_CE_AVX512(9, 25); REDE_CE_AVX512(10, 26); REDE_CE_AVX512(11, 27); REDE_CE_AVX512(12, 28); REDE_CE_AVX512(13, 29); REDE_CE_AVX512(14, 30);
+    REDE_CE_AVX512(8, 16); REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(13, 21); REDE_CE_AVX512(14, 22); REDE_CE_AVX512(15, 23);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26); REDE_CE_AVX512(23, 27);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25); REDE_CE_AVX512(26, 28); REDE_CE_AVX512(27, 29);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(27, 28); REDE_CE_AVX512(29, 30);
+}
+
+static inline __attribute__((target("avx512f"))) void redeOrdenacaoAVX512_32(__m512i v[])
+{
+    REDE_CE_AVX512(0, 1); REDE_CE_AVX512(2, 3); REDE_CE_AVX512(4, 5); REDE_CE_AVX512(6, 7); REDE_CE_AVX512(8, 9); REDE_CE_AVX512(10, 11); REDE_CE_AVX512(12, 13); REDE_CE_AVX512(14, 15); REDE_CE_AVX512(16, 17); REDE_CE_AVX512(18, 19); REDE_CE_AVX512(20, 21); REDE_CE_AVX512(22, 23); REDE_CE_AVX512(24, 25); REDE_CE_AVX512(26, 27); REDE_CE_AVX512(28, 29); REDE_CE_AVX512(30, 31);
+    REDE_CE_AVX512(0, 2); REDE_CE_AVX512(1, 3); REDE_CE_AVX512(4, 6); REDE_CE_AVX512(5, 7); REDE_CE_AVX512(8, 10); REDE_CE_AVX512(9, 11); REDE_CE_AVX512(12, 14); REDE_CE_AVX512(13, 15); REDE_CE_AVX512(16, 18); REDE_CE_AVX512(17, 19); REDE_CE_AVX512(20, 22); REDE_CE_AVX512(21, 23); REDE_CE_AVX512(24, 26); REDE_CE_AVX512(25, 27); REDE_CE_AVX512(28, 30); REDE_CE_AVX512(29, 31);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(29, 30); REDE_CE_AVX512(0, 4); REDE_CE_AVX512(3, 7); REDE_CE_AVX512(8, 12); REDE_CE_AVX512(11, 15); REDE_CE_AVX512(16, 20); REDE_CE_AVX512(19, 23); REDE_CE_AVX512(24, 28); REDE_CE_AVX512(27, 31);
+    REDE_CE_AVX512(1, 5); REDE_CE_AVX512(2, 6); REDE_CE_AVX512(9, 13); REDE_CE_AVX512(10, 14); REDE_CE_AVX512(17, 21); REDE_CE_AVX512(18, 22); REDE_CE_AVX512(25, 29); REDE_CE_AVX512(26, 30); REDE_CE_AVX512(0, 8); REDE_CE_AVX512(7, 15); REDE_CE_AVX512(16, 24); REDE_CE_AVX512(23, 31);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(26, 28); REDE_CE_AVX512(27, 29); REDE_CE_AVX512(0, 16); REDE_CE_AVX512(15, 31);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(27, 28); REDE_CE_AVX512(29, 30);
+    REDE_CE_AVX512(1, 9); REDE_CE_AVX512(2, 10); REDE_CE_AVX512(3, 11); REDE_CE_AVX512(4, 12); REDE_CE_AVX512(5, 13); REDE_CE_AVX512(6, 14); REDE_CE_AVX512(17, 25); REDE_CE_AVX512(18, 26); REDE_CE_AVX512(19, 27); REDE_CE_AVX512(20, 28); REDE_CE_AVX512(21, 29); REDE_CE_AVX512(22, 30);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26); REDE_CE_AVX512(23, 27);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25); REDE_CE_AVX512(26, 28); REDE_CE_AVX512(27, 29);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(27, 28); REDE_CE_AVX512(29, 30);
+    REDE_CE_AVX512(1, 17); REDE_CE_AVX512(2, 18); REDE_CE_AVX512(3, 19); REDE_CE_AVX512(4, 20); REDE_CE_AVX512(5, 21); REDE_CE_AVX512(6, 22); REDE_CE_AVX512(7, 23); REDE_CE_AVX512(8, 24); REDE_CE_AVX512(9, 25); REDE_CE_AVX512(10, 26); REDE_CE_AVX512(11, 27); REDE_CE_AVX512(12, 28); REDE_CE_AVX512(13, 29); REDE_CE_AVX512(14, 30);
+    REDE_CE_AVX512(8, 16); REDE_CE_AVX512(9, 17); REDE_CE_AVX512(10, 18); REDE_CE_AVX512(11, 19); REDE_CE_AVX512(12, 20); REDE_CE_AVX512(13, 21); REDE_CE_AVX512(14, 22); REDE_CE_AVX512(15, 23);
+    REDE_CE_AVX512(4, 8); REDE_CE_AVX512(5, 9); REDE_CE_AVX512(6, 10); REDE_CE_AVX512(7, 11); REDE_CE_AVX512(12, 16); REDE_CE_AVX512(13, 17); REDE_CE_AVX512(14, 18); REDE_CE_AVX512(15, 19); REDE_CE_AVX512(20, 24); REDE_CE_AVX512(21, 25); REDE_CE_AVX512(22, 26); REDE_CE_AVX512(23, 27);
+    REDE_CE_AVX512(2, 4); REDE_CE_AVX512(3, 5); REDE_CE_AVX512(6, 8); REDE_CE_AVX512(7, 9); REDE_CE_AVX512(10, 12); REDE_CE_AVX512(11, 13); REDE_CE_AVX512(14, 16); REDE_CE_AVX512(15, 17); REDE_CE_AVX512(18, 20); REDE_CE_AVX512(19, 21); REDE_CE_AVX512(22, 24); REDE_CE_AVX512(23, 25); REDE_CE_AVX512(26, 28); REDE_CE_AVX512(27, 29);
+    REDE_CE_AVX512(1, 2); REDE_CE_AVX512(3, 4); REDE_CE_AVX512(5, 6); REDE_CE_AVX512(7, 8); REDE_CE_AVX512(9, 10); REDE_CE_AVX512(11, 12); REDE_CE_AVX512(13, 14); REDE_CE_AVX512(15, 16); REDE_CE_AVX512(17, 18); REDE_CE_AVX512(19, 20); REDE_CE_AVX512(21, 22); REDE_CE_AVX512(23, 24); REDE_CE_AVX512(25, 26); REDE_CE_AVX512(27, 28); REDE_CE_AVX512(29, 30);
+}
+
+static const FuncaoRedeAVX512 redesOrdenacaoAVX512[REDE_TAM_MAX + 1] = {
+    NULL, NULL, redeOrdenacaoAVX512_2, redeOrdenacaoAVX512_3,
+    redeOrdenacaoAVX512_4, redeOrdenacaoAVX512_5, redeOrdenacaoAVX512_6, redeOrdenacaoAVX512_7,
+    redeOrdenacaoAVX512_8, redeOrdenacaoAVX512_9, redeOrdenacaoAVX512_10, redeOrdenacaoAVX512_11,
+    redeOrdenacaoAVX512_12, redeOrdenacaoAVX512_13, redeOrdenacaoAVX512_14, redeOrdenacaoAVX512_15,
+    redeOrdenacaoAVX512_16, redeOrdenacaoAVX512_17, redeOrdenacaoAVX512_18, redeOrdenacaoAVX512_19,
+    redeOrdenacaoAVX512_20, redeOrdenacaoAVX512_21, redeOrdenacaoAVX512_22, redeOrdenacaoAVX512_23,
+    redeOrdenacaoAVX512_24, redeOrdenacaoAVX512_25, redeOrdenacaoAVX512_26, redeOrdenacaoAVX512_27,
+    redeOrdenacaoAVX512_28, redeOrdenacaoAVX512_29, redeOrdenacaoAVX512_30, redeOrdenacaoAVX512_31,
+    redeOrdenacaoAVX512_32};
+#endif
+
+#endif
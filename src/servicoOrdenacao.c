@@ -0,0 +1,560 @@
+/*  ==================================================================
+ *  SERVIÇO LOCAL DE ORDENAÇÃO EM LOTE
+ *  Processo de longa duração que executa os kernels de libordenacao
+ *  sobre vetores dos clientes, sem copiá-los:
+ *    - a thread principal aceita conexões no socket Unix e lê pedidos
+ *      (protocolo em servicoOrdenacao.h) com poll();
+ *    - cada conexão mapeia uma vez o segmento de memória compartilhada
+ *      do cliente, e os pedidos apenas indicam trechos dele;
+ *    - um conjunto de threads retira da fila lotes de pedidos pequenos
+ *      (ou um pedido grande sozinho), ordena os trechos no próprio lugar
+ *      e devolve as respostas do lote numa única escrita por conexão;
+ *      as respostas decididas na leitura (anexação, pedido inválido)
+ *      também passam pela fila, e a thread principal nunca escreve;
+ *    - pedidos SERVICO_PARALELO usam o pool da biblioteca, com a largura
+ *      do serviço e um de cada vez.
+ *  Uso: ./servicoOrdenacao [threads]   (socket em ORDENACAO_SERVICO)
+ *  ==================================================================*/
+
+/*  ============================ BIBLIOTECAS ===========================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "ordenacao.h"
+#include "servicoOrdenacao.h"
+
+/*  ============================ CONSTANTES ===========================*/
+#define MAX_CONEXOES 64
+#define MAX_THREADS_SERVICO 64
+#define CAPACIDADE_FILA 4096      /* Pedidos aguardando; a leitura dos sockets para quando a fila enche */
+#define LOTE_MAX_PEDIDOS 64       /* Pedidos pequenos atendidos por uma thread de uma só vez */
+#define LOTE_MAX_ELEMENTOS 65536  /* Soma dos tamanhos num lote (mantém o lote dentro da L2) */
+#define LIMITE_PEDIDO_PEQUENO 4096 /* Acima disso, o pedido é atendido sozinho */
+#define PEDIDOS_POR_LEITURA 64
+#define INTERVALO_POLL_MS 200     /* Frequência com que o laço principal confere o sinal de término */
+#define LIMITE_ENVIO_MS 1000      /* Prazo de envio de uma resposta; depois, o cliente é desconectado */
+
+/* ================= ESTRUTURAS ================= */
+typedef struct
+{
+    int fd;
+    int em_uso;
+    int fechada;  /* O cliente desconectou; libera ao terminar os pedidos pendentes */
+    int pendentes; /* Pedidos na fila ou em ordenação */
+    int32_t *dados; /* Segmento do cliente mapeado (SERVICO_ANEXAR) */
+    int64_t elementos;
+    size_t bytes_mapeados;
+    char recebido[PEDIDOS_POR_LEITURA * sizeof(PedidoServico)];
+    size_t bytes_recebidos;
+    pthread_mutex_t escrita; /* Serializa as respostas enviadas pelas threads */
+    int descartada; /* Um envio esgotou o prazo: as próximas respostas são ignoradas (protegido por escrita) */
+} Conexao;
+
+typedef struct
+{
+    PedidoServico pedido;
+    int conexao;
+    uint64_t chegada_ns;
+    int pronta;     /* Resposta já decidida na leitura: a thread só a envia, com este código */
+    int32_t codigo;
+} PedidoFila;
+
+typedef struct
+{
+    PedidoFila itens[CAPACIDADE_FILA];
+    int inicio;
+    int tamanho;
+    int encerrar;
+    pthread_mutex_t trava;
+    pthread_cond_t tem_pedido;
+    pthread_cond_t tem_espaco;
+} FilaPedidos;
+
+/* ================= ESTADO GLOBAL ================= */
+static Conexao conexoes[MAX_CONEXOES];
+static pthread_mutex_t travaConexoes = PTHREAD_MUTEX_INITIALIZER; /* Protege em_uso, fechada e pendentes */
+static FilaPedidos fila = {.trava = PTHREAD_MUTEX_INITIALIZER,
+                           .tem_pedido = PTHREAD_COND_INITIALIZER,
+                           .tem_espaco = PTHREAD_COND_INITIALIZER};
+static volatile sig_atomic_t terminar = 0;
+static int numThreads = 1;
+
+/* Estatísticas exibidas ao encerrar */
+static unsigned long long totalPedidos = 0, totalLotes = 0, totalElementos = 0;
+static pthread_mutex_t travaEstatisticas = PTHREAD_MUTEX_INITIALIZER;
+
+/* ================= FUNÇÕES AUXILIARES ================= */
+void tratarSinal(int sinal)
+{
+    (void)sinal;
+    terminar = 1;
+}
+
+/**
+ * @brief Desfaz o mapeamento e fecha o socket de uma conexão sem pedidos pendentes.
+ *        Deve ser chamada com travaConexoes adquirida.
+ */
+void liberarConexao(Conexao *c)
+{
+    if (c->dados)
+        munmap(c->dados, c->bytes_mapeados);
+    close(c->fd);
+    pthread_mutex_destroy(&c->escrita);
+    c->dados = NULL;
+    c->elementos = 0;
+    c->bytes_mapeados = 0;
+    c->bytes_recebidos = 0;
+    c->em_uso = 0;
+}
+
+/**
+ * @brief Conclui um pedido da conexão; a última conclusão após a desconexão libera a conexão.
+ */
+void concluirPedido(int indice)
+{
+    pthread_mutex_lock(&travaConexoes);
+    Conexao *c = &conexoes[indice];
+    c->pendentes--;
+    if (c->fechada && c->pendentes == 0)
+        liberarConexao(c);
+    pthread_mutex_unlock(&travaConexoes);
+}
+
+/**
+ * @brief Envia respostas a uma conexão (uma única escrita para todo o grupo), com prazo de
+ *        LIMITE_ENVIO_MS. Se o cliente não lê as respostas (ou o envio falha), a conexão é
+ *        descartada: o socket é desligado, o laço principal a fecha ao ver o fim da leitura e os
+ *        pedidos ainda pendentes são concluídos sem resposta.
+ */
+void responder(Conexao *c, const RespostaServico respostas[], int quantidade)
+{
+    pthread_mutex_lock(&c->escrita);
+    if (!c->descartada &&
+        !servicoEscreverComLimite(c->fd, respostas, (size_t)quantidade * sizeof(RespostaServico), LIMITE_ENVIO_MS))
+    {
+        c->descartada = 1;
+        shutdown(c->fd, SHUT_RDWR);
+        printf("Erro: cliente (fd %d) nao recebeu as respostas em %d ms; conexao descartada.\n", c->fd,
+               LIMITE_ENVIO_MS);
+    }
+    pthread_mutex_unlock(&c->escrita);
+}
+
+/**
+ * @brief Mapeia o segmento de memória compartilhada indicado pelo cliente.
+ * @return ORDENACAO_OK ou um código ORDENACAO_ERRO_*.
+ */
+int anexarSegmento(Conexao *c, const PedidoServico *p)
+{
+    char nome[SERVICO_NOME_SHM];
+    memcpy(nome, p->nome_shm, sizeof(nome));
+    nome[sizeof(nome) - 1] = '\0';
+
+    if (c->dados || nome[0] != '/' || p->quantidade <= 0 || p->quantidade > INT64_MAX / (int64_t)sizeof(int32_t))
+        return ORDENACAO_ERRO_ARGUMENTO;
+
+    int fd = shm_open(nome, O_RDWR, 0);
+    if (fd < 0)
+        return ORDENACAO_ERRO_ARGUMENTO;
+
+    struct stat info;
+    size_t bytes = (size_t)p->quantidade * sizeof(int32_t);
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < bytes)
+    {
+        close(fd);
+        return ORDENACAO_ERRO_TAMANHO;
+    }
+
+    void *dados = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (dados == MAP_FAILED)
+        return ORDENACAO_ERRO_MEMORIA;
+
+    c->dados = (int32_t *)dados;
+    c->elementos = p->quantidade;
+    c->bytes_mapeados = bytes;
+    return ORDENACAO_OK;
+}
+
+/**
+ * @brief Valida um pedido SERVICO_ORDENAR contra o segmento da conexão.
+ * @return ORDENACAO_OK ou um código ORDENACAO_ERRO_*.
+ */
+int validarPedido(const Conexao *c, const PedidoServico *p)
+{
+    if (!c->dados || p->tipo != SERVICO_TIPO_INT32)
+        return ORDENACAO_ERRO_ARGUMENTO;
+    if (p->algoritmo != ORDENACAO_SHELL && p->algoritmo != ORDENACAO_CYCLE && p->algoritmo != SERVICO_PARALELO)
+        return ORDENACAO_ERRO_ARGUMENTO;
+    if (p->inicio < 0 || p->quantidade < 0 || p->inicio > c->elementos || p->quantidade > c->elementos - p->inicio)
+        return ORDENACAO_ERRO_TAMANHO;
+    return ORDENACAO_OK;
+}
+
+/**
+ * @brief Executa o kernel pedido sobre o trecho, no próprio segmento do cliente. O merge sort
+ *        paralelo usa numThreads threads do pool da biblioteca, que atende um pedido por vez.
+ */
+int executarPedido(const Conexao *c, const PedidoServico *p)
+{
+    int32_t *trecho = c->dados + p->inicio;
+    switch (p->algoritmo)
+    {
+    case ORDENACAO_SHELL:
+        return ordenacaoShellSort(trecho, p->quantidade, NULL);
+    case ORDENACAO_CYCLE:
+        return ordenacaoCycleSort(trecho, p->quantidade, NULL);
+    default:
+        return ordenacaoShellSortParalelo(trecho, p->quantidade, numThreads);
+    }
+}
+
+/* ================= FILA DE PEDIDOS ================= */
+/**
+ * @brief Enfileira um pedido, aguardando espaço se a fila estiver cheia. Com pronta = 1, o item só
+ *        leva a resposta (codigo) decidida na leitura, que a thread de trabalho envia.
+ */
+void enfileirar(const PedidoServico *p, int conexao, int pronta, int32_t codigo)
+{
+    pthread_mutex_lock(&fila.trava);
+    while (fila.tamanho == CAPACIDADE_FILA)
+        pthread_cond_wait(&fila.tem_espaco, &fila.trava);
+    PedidoFila *item = &fila.itens[(fila.inicio + fila.tamanho) % CAPACIDADE_FILA];
+    item->pedido = *p;
+    item->conexao = conexao;
+    item->chegada_ns = servicoAgoraNs();
+    item->pronta = pronta;
+    item->codigo = codigo;
+    fila.tamanho++;
+    pthread_cond_signal(&fila.tem_pedido);
+    pthread_mutex_unlock(&fila.trava);
+}
+
+/**
+ * @brief Retira o próximo lote: um pedido grande sozinho, ou pedidos pequenos consecutivos
+ *        até LOTE_MAX_PEDIDOS / LOTE_MAX_ELEMENTOS. Cada thread leva no máximo a sua parte
+ *        da fila, para que um lote grande não deixe as demais ociosas.
+ * @return Número de pedidos retirados (0 quando o serviço está encerrando).
+ */
+int retirarLote(PedidoFila lote[])
+{
+    pthread_mutex_lock(&fila.trava);
+    while (fila.tamanho == 0 && !fila.encerrar)
+        pthread_cond_wait(&fila.tem_pedido, &fila.trava);
+
+    int limite = (fila.tamanho + numThreads - 1) / numThreads;
+    if (limite > LOTE_MAX_PEDIDOS)
+        limite = LOTE_MAX_PEDIDOS;
+
+    int quantidade = 0;
+    int64_t elementos = 0;
+    while (fila.tamanho > 0 && quantidade < limite)
+    {
+        PedidoFila *item = &fila.itens[fila.inicio];
+        int64_t n = item->pronta ? 0 : item->pedido.quantidade;
+        if (quantidade > 0 && (n > LIMITE_PEDIDO_PEQUENO || elementos + n > LOTE_MAX_ELEMENTOS))
+            break;
+        lote[quantidade++] = *item;
+        elementos += n;
+        fila.inicio = (fila.inicio + 1) % CAPACIDADE_FILA;
+        fila.tamanho--;
+        if (n > LIMITE_PEDIDO_PEQUENO)
+            break;
+    }
+
+    if (quantidade > 0)
+        pthread_cond_broadcast(&fila.tem_espaco);
+    if (fila.tamanho > 0)
+        pthread_cond_signal(&fila.tem_pedido);
+    pthread_mutex_unlock(&fila.trava);
+    return quantidade;
+}
+
+/**
+ * @brief Thread de trabalho: ordena os lotes e agrupa as respostas por conexão.
+ */
+void *threadTrabalho(void *arg)
+{
+    (void)arg;
+    PedidoFila lote[LOTE_MAX_PEDIDOS];
+    RespostaServico respostas[LOTE_MAX_PEDIDOS];
+    int atendido[LOTE_MAX_PEDIDOS];
+    int quantidade;
+
+    while ((quantidade = retirarLote(lote)) > 0)
+    {
+        int64_t elementos = 0;
+        int ordenados = 0;
+        for (int i = 0; i < quantidade; i++)
+        {
+            uint64_t comeco = servicoAgoraNs();
+            respostas[i].id = lote[i].pedido.id;
+            respostas[i].lote = (uint32_t)quantidade;
+            respostas[i].fila_ns = comeco - lote[i].chegada_ns;
+            respostas[i].codigo = lote[i].pronta ? lote[i].codigo
+                                                 : executarPedido(&conexoes[lote[i].conexao], &lote[i].pedido);
+            respostas[i].ordenacao_ns = servicoAgoraNs() - comeco;
+            if (!lote[i].pronta)
+            {
+                elementos += lote[i].pedido.quantidade;
+                ordenados++;
+            }
+            atendido[i] = 0;
+        }
+
+        /* Uma escrita por conexão presente no lote, na ordem de chegada */
+        for (int i = 0; i < quantidade; i++)
+        {
+            if (atendido[i])
+                continue;
+            RespostaServico grupo[LOTE_MAX_PEDIDOS];
+            int tamanho_grupo = 0, conexao = lote[i].conexao;
+            for (int j = i; j < quantidade; j++)
+            {
+                if (!atendido[j] && lote[j].conexao == conexao)
+                {
+                    grupo[tamanho_grupo++] = respostas[j];
+                    atendido[j] = 1;
+                }
+            }
+            responder(&conexoes[conexao], grupo, tamanho_grupo);
+            for (int k = 0; k < tamanho_grupo; k++)
+                concluirPedido(conexao);
+        }
+
+        /* As estatísticas contam só as ordenações (respostas prontas não formam lote) */
+        pthread_mutex_lock(&travaEstatisticas);
+        totalPedidos += (unsigned long long)ordenados;
+        totalLotes += ordenados > 0;
+        totalElementos += (unsigned long long)elementos;
+        pthread_mutex_unlock(&travaEstatisticas);
+    }
+    return NULL;
+}
+
+/* ================= CONEXÕES ================= */
+/**
+ * @brief Aceita uma nova conexão, se houver posição livre.
+ */
+void aceitarConexao(int servidor)
+{
+    int fd = accept(servidor, NULL, NULL);
+    if (fd < 0)
+        return;
+
+    pthread_mutex_lock(&travaConexoes);
+    int livre = -1;
+    for (int i = 0; i < MAX_CONEXOES && livre < 0; i++)
+        if (!conexoes[i].em_uso)
+            livre = i;
+    if (livre < 0)
+    {
+        pthread_mutex_unlock(&travaConexoes);
+        printf("Erro: limite de %d conexoes atingido.\n", MAX_CONEXOES);
+        close(fd);
+        return;
+    }
+    Conexao *c = &conexoes[livre];
+    memset(c, 0, sizeof(*c));
+    c->fd = fd;
+    c->em_uso = 1;
+    pthread_mutex_init(&c->escrita, NULL);
+    pthread_mutex_unlock(&travaConexoes);
+}
+
+/**
+ * @brief Marca a conexão como fechada; é liberada agora ou pela última thread que a atender.
+ */
+void fecharConexao(int indice)
+{
+    pthread_mutex_lock(&travaConexoes);
+    Conexao *c = &conexoes[indice];
+    c->fechada = 1;
+    shutdown(c->fd, SHUT_RD);
+    if (c->pendentes == 0)
+        liberarConexao(c);
+    pthread_mutex_unlock(&travaConexoes);
+}
+
+/**
+ * @brief Lê os pedidos disponíveis na conexão. Anexações e pedidos inválidos são decididos aqui
+ *        e vão para a fila só com a resposta; os válidos vão para a fila para ordenação. Assim a
+ *        thread principal nunca espera por um cliente que não lê as respostas.
+ * @return 0 se a conexão foi encerrada pelo cliente (ou por um pedido sem SERVICO_MAGICA).
+ */
+int lerPedidos(int indice)
+{
+    Conexao *c = &conexoes[indice];
+    ssize_t lidos = read(c->fd, c->recebido + c->bytes_recebidos, sizeof(c->recebido) - c->bytes_recebidos);
+    if (lidos < 0 && errno == EINTR)
+        return 1;
+    if (lidos <= 0)
+        return 0;
+    c->bytes_recebidos += (size_t)lidos;
+
+    size_t completos = c->bytes_recebidos / sizeof(PedidoServico);
+    for (size_t i = 0; i < completos; i++)
+    {
+        PedidoServico p;
+        memcpy(&p, c->recebido + i * sizeof(PedidoServico), sizeof(p));
+        int32_t codigo;
+
+        /* Fluxo dessincronizado ou cliente de outro protocolo: avisa e encerra a leitura */
+        int protocolo_invalido = p.magica != SERVICO_MAGICA;
+        if (protocolo_invalido)
+            codigo = SERVICO_ERRO_PROTOCOLO;
+        else if (p.operacao == SERVICO_ANEXAR)
+            codigo = anexarSegmento(c, &p);
+        else if (p.operacao == SERVICO_ORDENAR)
+            codigo = validarPedido(c, &p);
+        else
+            codigo = ORDENACAO_ERRO_ARGUMENTO;
+
+        pthread_mutex_lock(&travaConexoes);
+        c->pendentes++;
+        pthread_mutex_unlock(&travaConexoes);
+        enfileirar(&p, indice, protocolo_invalido || p.operacao != SERVICO_ORDENAR || codigo != ORDENACAO_OK, codigo);
+        if (protocolo_invalido)
+            return 0;
+    }
+
+    size_t consumidos = completos * sizeof(PedidoServico);
+    memmove(c->recebido, c->recebido + consumidos, c->bytes_recebidos - consumidos);
+    c->bytes_recebidos -= consumidos;
+    return 1;
+}
+
+/**
+ * @brief Cria o socket Unix do serviço (substitui um socket antigo no mesmo caminho).
+ * @return Descritor do socket, ou -1 em caso de erro.
+ */
+int criarServidor(const char *caminho)
+{
+    struct sockaddr_un endereco = {.sun_family = AF_UNIX};
+    if (strlen(caminho) >= sizeof(endereco.sun_path))
+    {
+        printf("Erro: caminho do socket muito longo: %s\n", caminho);
+        return -1;
+    }
+    strcpy(endereco.sun_path, caminho);
+
+    int servidor = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (servidor < 0)
+    {
+        printf("Erro ao criar o socket.\n");
+        return -1;
+    }
+    unlink(caminho);
+    if (bind(servidor, (struct sockaddr *)&endereco, sizeof(endereco)) != 0 || listen(servidor, MAX_CONEXOES) != 0)
+    {
+        printf("Erro ao escutar em %s.\n", caminho);
+        close(servidor);
+        return -1;
+    }
+    return servidor;
+}
+
+void exibirUso(const char *programa)
+{
+    printf("Uso: %s [threads]\n", programa);
+    printf("  threads : threads de ordenacao (padrao: numero de nucleos, maximo %d)\n", MAX_THREADS_SERVICO);
+    printf("Socket: ORDENACAO_SERVICO (padrao %s). Encerrar com Ctrl+C.\n", SERVICO_SOCKET_PADRAO);
+}
+
+/* ================= PROGRAMA PRINCIPAL ================= */
+int main(int argc, char *argv[])
+{
+    numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (numThreads > MAX_THREADS_SERVICO)
+        numThreads = MAX_THREADS_SERVICO;
+    if (argc > 1)
+        numThreads = atoi(argv[1]);
+    if (numThreads < 1 || numThreads > MAX_THREADS_SERVICO)
+    {
+        exibirUso(argv[0]);
+        return 1;
+    }
+
+    const char *caminho = servicoCaminhoSocket();
+    int servidor = criarServidor(caminho);
+    if (servidor < 0)
+        return 1;
+
+    struct sigaction acao = {.sa_handler = tratarSinal};
+    sigaction(SIGINT, &acao, NULL);
+    sigaction(SIGTERM, &acao, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    pthread_t threads[MAX_THREADS_SERVICO];
+    for (int i = 0; i < numThreads; i++)
+    {
+        if (pthread_create(&threads[i], NULL, threadTrabalho, NULL) != 0)
+        {
+            printf("Erro ao criar as threads de ordenacao.\n");
+            close(servidor);
+            unlink(caminho);
+            return 1;
+        }
+    }
+
+    printf("Servico de ordenacao em %s (%d threads, lotes de ate %d pedidos / %d elementos)\n",
+           caminho, numThreads, LOTE_MAX_PEDIDOS, LOTE_MAX_ELEMENTOS);
+    fflush(stdout);
+
+    struct pollfd monitorados[MAX_CONEXOES + 1];
+    int indices[MAX_CONEXOES + 1];
+    while (!terminar)
+    {
+        int n = 0;
+        monitorados[n].fd = servidor;
+        monitorados[n].events = POLLIN;
+        indices[n++] = -1;
+
+        pthread_mutex_lock(&travaConexoes);
+        for (int i = 0; i < MAX_CONEXOES; i++)
+        {
+            if (conexoes[i].em_uso && !conexoes[i].fechada)
+            {
+                monitorados[n].fd = conexoes[i].fd;
+                monitorados[n].events = POLLIN;
+                indices[n++] = i;
+            }
+        }
+        pthread_mutex_unlock(&travaConexoes);
+
+        if (poll(monitorados, (nfds_t)n, INTERVALO_POLL_MS) <= 0)
+            continue;
+
+        for (int i = 1; i < n; i++)
+            if (monitorados[i].revents & (POLLIN | POLLHUP | POLLERR))
+                if (!lerPedidos(indices[i]))
+                    fecharConexao(indices[i]);
+        if (monitorados[0].revents & POLLIN)
+            aceitarConexao(servidor);
+    }
+
+    /* Término: as threads esvaziam a fila antes de sair */
+    pthread_mutex_lock(&fila.trava);
+    fila.encerrar = 1;
+    pthread_cond_broadcast(&fila.tem_pedido);
+    pthread_mutex_unlock(&fila.trava);
+    for (int i = 0; i < numThreads; i++)
+        pthread_join(threads[i], NULL);
+
+    for (int i = 0; i < MAX_CONEXOES; i++)
+        if (conexoes[i].em_uso && !conexoes[i].fechada)
+            fecharConexao(i);
+    close(servidor);
+    unlink(caminho);
+
+    printf("\nServico encerrado: %llu pedidos em %llu lotes (%.1f pedidos/lote, %llu elementos)\n",
+           totalPedidos, totalLotes, totalLotes ? (double)totalPedidos / (double)totalLotes : 0.0, totalElementos);
+    return 0;
+}
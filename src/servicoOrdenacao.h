@@ -0,0 +1,156 @@
+/*  ==================================================================
+ *  PROTOCOLO DO SERVIÇO DE ORDENAÇÃO
+ *  Comum ao servidor (servicoOrdenacao.c) e aos clientes (clienteCarga.c).
+ *    - Os dados ficam num segmento de memória compartilhada POSIX criado
+ *      pelo cliente (shm_open); o servidor o mapeia uma vez por conexão
+ *      (SERVICO_ANEXAR) e ordena trechos dele no próprio lugar.
+ *    - Pedidos e respostas são estruturas de tamanho fixo trocadas por um
+ *      socket Unix local (ORDENACAO_SERVICO ou SERVICO_SOCKET_PADRAO).
+ *    - Cada pedido SERVICO_ORDENAR traz algoritmo, tipo do elemento e o
+ *      trecho [inicio, inicio + quantidade) do segmento; a resposta, com o
+ *      mesmo id, sinaliza a conclusão. As respostas podem chegar fora de
+ *      ordem, e pedidos em voo não devem ter trechos sobrepostos.
+ *    - Um pedido sem SERVICO_MAGICA recebe SERVICO_ERRO_PROTOCOLO e a
+ *      conexão é encerrada; um cliente que deixa de ler as respostas por
+ *      mais que o limite de envio do servidor também é desconectado.
+ *  ==================================================================*/
+#ifndef SERVICO_ORDENACAO_H
+#define SERVICO_ORDENACAO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+
+#define SERVICO_SOCKET_PADRAO "/tmp/ordenacao.sock"
+#define SERVICO_MAGICA 0x3144524fu /* "ORD1" */
+#define SERVICO_NOME_SHM 64
+
+#define SERVICO_ANEXAR 1  /* Mapeia o segmento nome_shm, com quantidade elementos */
+#define SERVICO_ORDENAR 2 /* Ordena o trecho [inicio, inicio + quantidade) do segmento */
+
+#define SERVICO_PARALELO 2   /* Algoritmo: merge sort paralelo (além de ORDENACAO_SHELL e ORDENACAO_CYCLE) */
+#define SERVICO_TIPO_INT32 0 /* Único tipo de elemento dos kernels */
+
+#define SERVICO_ERRO_PROTOCOLO -100 /* Código de resposta: pedido sem SERVICO_MAGICA (a conexão é encerrada) */
+
+typedef struct
+{
+    uint32_t magica;
+    uint32_t operacao;
+    uint64_t id; /* Devolvido na resposta */
+    int32_t algoritmo;
+    int32_t tipo;
+    int64_t inicio;
+    int64_t quantidade;
+    char nome_shm[SERVICO_NOME_SHM];
+} PedidoServico;
+
+typedef struct
+{
+    uint64_t id;
+    int32_t codigo;       /* ORDENACAO_OK ou ORDENACAO_ERRO_* */
+    uint32_t lote;        /* Pedidos atendidos no mesmo lote que este */
+    uint64_t fila_ns;     /* Espera na fila do servidor */
+    uint64_t ordenacao_ns;
+} RespostaServico;
+
+/**
+ * @brief Caminho do socket do serviço (ORDENACAO_SERVICO ou o padrão).
+ */
+static inline const char *servicoCaminhoSocket()
+{
+    const char *caminho = getenv("ORDENACAO_SERVICO");
+    return caminho && caminho[0] ? caminho : SERVICO_SOCKET_PADRAO;
+}
+
+/**
+ * @brief Relógio monotônico em nanossegundos.
+ */
+static inline uint64_t servicoAgoraNs()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+/**
+ * @brief Lê exatamente n bytes (repetindo leituras parciais).
+ * @return 1 em caso de sucesso, 0 no fim da conexão ou em erro.
+ */
+static inline int servicoLerTudo(int fd, void *dados, size_t n)
+{
+    char *p = (char *)dados;
+    while (n > 0)
+    {
+        ssize_t lidos = read(fd, p, n);
+        if (lidos < 0 && errno == EINTR)
+            continue;
+        if (lidos <= 0)
+            return 0;
+        p += lidos;
+        n -= (size_t)lidos;
+    }
+    return 1;
+}
+
+/**
+ * @brief Escreve exatamente n bytes (repetindo escritas parciais, sem SIGPIPE).
+ * @return 1 em caso de sucesso, 0 em erro.
+ */
+static inline int servicoEscreverTudo(int fd, const void *dados, size_t n)
+{
+    const char *p = (const char *)dados;
+    while (n > 0)
+    {
+        ssize_t escritos = send(fd, p, n, MSG_NOSIGNAL);
+        if (escritos < 0 && errno == EINTR)
+            continue;
+        if (escritos <= 0)
+            return 0;
+        p += escritos;
+        n -= (size_t)escritos;
+    }
+    return 1;
+}
+
+/**
+ * @brief Escreve exatamente n bytes sem bloquear além de limite_ms: cada envio é não bloqueante
+ *        (MSG_DONTWAIT) e, com o buffer do socket cheio, espera por poll() até o prazo total.
+ *        Usada pelo servidor, para que um cliente que não lê as respostas não o trave.
+ * @return 1 em caso de sucesso, 0 em erro ou se o prazo acabou (a resposta pode ter saído pela metade).
+ */
+static inline int servicoEscreverComLimite(int fd, const void *dados, size_t n, int limite_ms)
+{
+    const char *p = (const char *)dados;
+    uint64_t prazo = servicoAgoraNs() + (uint64_t)limite_ms * 1000000ULL;
+
+    while (n > 0)
+    {
+        ssize_t escritos = send(fd, p, n, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (escritos > 0)
+        {
+            p += escritos;
+            n -= (size_t)escritos;
+            continue;
+        }
+        if (escritos < 0 && errno == EINTR)
+            continue;
+        if (escritos == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+            return 0;
+
+        uint64_t agora = servicoAgoraNs();
+        if (agora >= prazo)
+            return 0;
+        struct pollfd monitorado = {.fd = fd, .events = POLLOUT};
+        int espera_ms = (int)((prazo - agora + 999999ULL) / 1000000ULL);
+        if (poll(&monitorado, 1, espera_ms) < 0 && errno != EINTR)
+            return 0;
+    }
+    return 1;
+}
+
+#endif
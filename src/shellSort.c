@@ -4,12 +4,66 @@
 #include <time.h>
 #include <math.h>
 #include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#if defined(__GNUC__)
+#define SIMD_X86 1 /* Caminhos AVX2/AVX-512 compilados com target() e escolhidos em tempo de execução */
+#endif
+#endif
+#include "redesOrdenacao.h"
+#include "telemetria.h"
+#include "execucaoLonga.h"
+#include "tsc.h"
+#include "verificacao.h"
+#include "permutacao.h"
+#include "cacheResultados.h"
+#include "ambiente.h"
+#include "hierarquiaCache.h"
 
 /*  ============================ CONSTANTES ===========================*/
 #define TAM_VETOR 20000 /* Usado apenas nas opções 1-3 do menu */
 #define REPETICOES 11   /* Número total de repetições */
 #define QTD_DESCARTES 1 /* Quantidade de repetições descartadas (normalmente 1 para warm-up) */
 #define TAM_MAX 150000  /* valor máximo dos elementos do vetor */
+#define TREINO_SEMENTE 12345 /* Semente fixa do modo --treino (perfil PGO reproduzível) */
+#define TREINO_REPETICOES 2  /* Repetições de cada combinação do teste geral no modo --treino */
+#define TESTE_GERAL_SEMENTE 20240611u /* Base das sementes fixas das células do teste geral (cache de resultados) */
+#define MAX_PASSOS 32   /* Número máximo de gaps (passos) registrados por ordenação */
+#define LOTE_REPETICOES 5 /* Repetições (após 1 warm-up) de cada medição do benchmark de lote */
+#define REDES_VETORES 65536 /* Vetores ordenados por medição no micro-benchmark de redes */
+
+#define SELECAO_CORTE 32 /* Padrão: intervalos menores que isto são resolvidos por ordenação na seleção */
+#define GAPS_KNUTH 0     /* Sequências de gaps do Shell Sort selecionáveis pelo perfil de ajuste */
+#define GAPS_CIURA 1
+#define GAPS_SEDGEWICK 2
+#define GAPS_TOKUDA 3
+#define NUM_SEQUENCIAS 4
+#define PERFIL_PADRAO "perfil_ajuste.txt" /* Arquivo do perfil de ajuste (ou ORDENACAO_PERFIL) */
+#define AJUSTE_REPETICOES 3               /* Repetições (após 1 warm-up) de cada medição do autoajuste */
+#define LIMITE_REPOSICIONAMENTO 1000 /* Maior lote medido com atualizarChave() chave a chave */
+#define VARIANTE_ESCALAR 0    /* Inserção escalar com desvios (laço original) */
+#define VARIANTE_SENTINELA 1  /* Inserção escalar com sentinela: sem teste de limite no laço interno */
+#define VARIANTE_AVX2 2       /* 8 inserções consecutivas em lockstep (gaps >= 8) */
+#define VARIANTE_AVX512 3     /* 16 inserções consecutivas em lockstep (gaps >= 16) */
+#define NUM_VARIANTES 4
+#define TAREFA_FOLHA 0
+#define TAREFA_INTERCALAR 1
+#define MAX_THREADS 64         /* Número máximo de threads da ordenação paralela */
+#define SEGMENTO_MINIMO 16384  /* Menor trecho de saída de uma tarefa de intercalação */
+#define L2_PADRAO (256 * 1024) /* Tamanho de L2 assumido quando o sistema não informa */
+#define ESCALA_REPETICOES 3    /* Repetições (após 1 warm-up) do relatório de escalabilidade */
+#define HIERARQUIA_LIMITE_MB 256      /* Teto do maior vetor padrão (4x o último nível de cache) */
+#define MAX_COLUNAS 8   /* Número máximo de colunas de carga na ordenação SoA */
+#define SOA_JUNTO 0       /* Modo SoA: carga movida junto com a chave em cada deslocamento */
+#define SOA_PASSO_FINAL 1 /* Modo SoA: ordena pares chave+índice e permuta a carga uma vez no final */
+#define STRING_MAX 64         /* Bytes reservados por string gerada (incluindo o terminador) */
+#define STRINGS_ALEATORIAS 0   /* Letras aleatórias, 4 a 24 caracteres */
+#define STRINGS_PREFIXO_COMUM 1 /* Caminhos com um diretório longo compartilhado por todas */
+#define STRINGS_URL 2          /* URLs de poucos domínios, com caminho e identificador */
+#define NUM_DISTRIBUICOES_STRINGS 3
 
 /* ================= ESTRUTURAS ================= */
 typedef struct
@@ -21,8 +75,48 @@ typedef struct
     double tempo;
     long comparacoes;
     long trocas;
+    char variante[20];
 } ResultadoCSV;
 
+typedef struct
+{
+    int h;
+    long comparacoes;
+    long trocas;
+    unsigned long long ciclos;
+} PerfilPasso;
+
+typedef struct
+{
+    char cenario[20];
+    int tamanho;
+    int repeticao;
+    int passo;
+    PerfilPasso perfil;
+} ResultadoPassoCSV;
+
+/* Medições de uma célula do teste geral, no formato guardado pelo cache de resultados */
+typedef struct
+{
+    double tempos[REPETICOES];
+    long comparacoes[REPETICOES];
+    long trocas[REPETICOES];
+    int num_passos[REPETICOES];
+    PerfilPasso passos[REPETICOES][MAX_PASSOS];
+} MedicaoTesteGeral;
+
+typedef struct
+{
+    int chave;
+    int indice;
+} ParChaveIndice;
+
+typedef struct
+{
+    void *dados;   /* Elementos da coluna, contíguos */
+    size_t largura; /* Bytes por elemento */
+} ColunaCarga;
+
 typedef struct
 {
     char cenario[20];
@@ -31,8 +125,86 @@ typedef struct
     double desvio_tempo;
     double media_comparacoes;
     double media_trocas;
+    char origem_cache[CACHE_AMBIENTE]; /* Ambiente da medição reaproveitada do cache ("" se medida agora) */
 } Estatisticas;
 
+/* Tarefa da ordenação paralela: ordenar uma folha ou intercalar um segmento (merge path) */
+typedef struct
+{
+    int tipo; /* TAREFA_FOLHA ou TAREFA_INTERCALAR */
+    int *origem;
+    int *destino;
+    int inicio, meio, fim; /* Folha: [inicio, fim). Intercalação: [inicio, meio) com [meio, fim) */
+    int parte, partes;     /* Segmento da saída desta tarefa na intercalação */
+} TarefaOrdenacao;
+
+/* Deque de tarefas de uma thread: a dona retira do fim, as outras roubam do início */
+typedef struct
+{
+    TarefaOrdenacao *tarefas;
+    int inicio, fim, capacidade;
+    long roubos;
+    pthread_mutex_t trava;
+} FilaTrabalho;
+
+/* Pool da ordenação paralela: criado uma vez e reutilizado por várias ordenações (uma por vez) */
+typedef struct PoolTrabalho PoolTrabalho;
+
+typedef struct
+{
+    PoolTrabalho *pool;
+    int id;
+} ArgumentoThread;
+
+struct PoolTrabalho
+{
+    pthread_t threads[MAX_THREADS];
+    FilaTrabalho filas[MAX_THREADS];
+    ArgumentoThread argumentos[MAX_THREADS];
+    int num_threads;
+    int criadas;   /* Threads do pool, contando a chamadora (thread 0) */
+    int pendentes; /* Tarefas enviadas e ainda não concluídas */
+    int geracao;   /* Incrementada a cada envio, acorda as threads ociosas */
+    int encerrar;
+    pthread_mutex_t trava;
+    pthread_cond_t trabalho;
+    pthread_cond_t concluido;
+};
+
+/* Parâmetros ajustáveis por host, carregados do perfil de ajuste no início do programa */
+typedef struct
+{
+    int sequencia_gaps; /* GAPS_* usado por shellSort() */
+    int corte_selecao;  /* Intervalos até este tamanho são ordenados na seleção (introselect) */
+    int folha_paralela; /* Elementos por folha na ordenação paralela (0 = metade da L2) */
+    int threads;        /* Threads da ordenação paralela quando não informado (0 = todos os núcleos) */
+    int variante;       /* VARIANTE_* preferida (-1 = a mais larga suportada) */
+} PerfilAjuste;
+
+/* Chave de ordenação de string: os 8 primeiros bytes (após o prefixo comum a todas as strings)
+   em big-endian, completados com zeros, ficam ao lado do ponteiro. A comparação de dois prefixos
+   como inteiros sem sinal equivale à de strcmp nesses bytes; o texto só é lido em empates. */
+typedef struct
+{
+    uint64_t prefixo;
+    const char *texto; /* Início da string após o prefixo comum */
+    uint32_t tamanho;  /* Bytes a partir de texto */
+} ChaveString;
+
+/* Passo de inserção do Shell Sort para um gap h (uma implementação por variante) */
+typedef void (*FuncaoPassoShell)(int v[], int tamanho, int h, long *comparacoes, long *trocas);
+
+/* ================= VARIÁVEIS GLOBAIS ================= */
+const char *nomesVariantes[NUM_VARIANTES] = {"escalar", "sentinela", "avx2", "avx512"};
+int varianteAtiva = VARIANTE_ESCALAR; /* Definida em selecionarVariante() no início do programa */
+int modoInterativo = 1; /* 0 nos modos de linha de comando: pausar() não espera ENTER */
+const char *nomesSequencias[NUM_SEQUENCIAS] = {"knuth", "ciura", "sedgewick", "tokuda"};
+PerfilAjuste perfilAtivo = {GAPS_KNUTH, SELECAO_CORTE, 0, 0, -1};
+char arquivoPerfil[256] = "";  /* Perfil carregado (vazio se foram usados os padrões) */
+const char *nomesDistribuicoesStrings[NUM_DISTRIBUICOES_STRINGS] = {"aleatorio", "prefixo_comum", "url"};
+long comparacoesQsort = 0; /* Contadores dos comparadores de qsort() na ordenação de strings */
+long desempatesQsort = 0;
+
 /* ================= FUNÇÕES AUXILIARES ================= */
 #ifdef _WIN32
 #define limpar_tela() system("cls")
@@ -46,6 +218,8 @@ typedef struct
 */
 void pausar()
 {
+    if (!modoInterativo)
+        return;
     printf("\nPressione ENTER para continuar...");
     getchar();
     getchar();
@@ -83,496 +257,4371 @@ void imprimirVetor(int v[], int tamanho)
     printf("\n");
 }
 
+/**
+ * @brief Sorteia um valor aleatório, do gerador local (xorshift32) quando há estado, ou de rand().
+ *        Com estado local, a sequência depende só da semente: não altera nem depende do rand()
+ *        global, e chamadas simultâneas com estados distintos são seguras entre threads.
+ * @param estado Estado do gerador local (não nulo, ver iniciarGerador()), ou NULL para usar rand().
+ * @return Valor entre 0 e 2^31 - 1.
+ */
+int sortear(uint32_t *estado)
+{
+    if (!estado)
+        return rand();
+
+    uint32_t x = *estado;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *estado = x;
+    return (int)(x >> 1);
+}
+
+/**
+ * @brief Inicia o estado do gerador local a partir de uma semente (sementes próximas geram
+ *        estados bem diferentes, e o estado nunca é zero).
+ * @param semente Semente do gerador.
+ * @return Estado inicial para sortear().
+ */
+uint32_t iniciarGerador(unsigned int semente)
+{
+    uint32_t estado = (uint32_t)semente * 2654435761u + 0x9e3779b9u;
+    estado ^= estado >> 16;
+    return estado ? estado : 1u;
+}
+
 /**
  * @brief Embaralha os elementos do vetor.
  * @param v Vetor a ser embaralhado.
  * @param n Tamanho do vetor.
+ * @param estado Estado do gerador local, ou NULL para usar rand().
  * @return void 
 */
-void shuffle(int v[], int n)
+void shuffleComEstado(int v[], int n, uint32_t *estado)
 {
     for (int i = n - 1; i > 0; i--)
     {
-        int j = rand() % (i + 1);
+        int j = sortear(estado) % (i + 1);
         int temp = v[i];
         v[i] = v[j];
         v[j] = temp;
     }
 }
 
+/**
+ * @brief Embaralha os elementos do vetor (com rand()).
+ * @param v Vetor a ser embaralhado.
+ * @param n Tamanho do vetor.
+ * @return void 
+*/
+void shuffle(int v[], int n)
+{
+    shuffleComEstado(v, n, NULL);
+}
+
 /**
  * @brief Gera um vetor com elementos em ordem crescente, decrescente ou aleatória.
  * @param v Vetor a ser preenchido.
  * @param tipo Tipo de vetor: 1 - crescente, 2 - decrescente, 3 - aleatório.
  * @param tamanho Tamanho do vetor.
+ * @param estado Estado do gerador local, ou NULL para usar rand().
  * @return void
 */
-void gerarVetor(int v[], int tipo, int tamanho)
+void gerarVetorComEstado(int v[], int tipo, int tamanho, uint32_t *estado)
 {
     if (tipo == 1)
     { /* CRESCENTE */
-        int valor = rand() % (TAM_MAX / 10);
+        int valor = sortear(estado) % (TAM_MAX / 10);
         for (int i = 0; i < tamanho; i++)
         {
             v[i] = valor;
-            int incremento = 1 + (rand() % (TAM_MAX / tamanho));
+            int incremento = 1 + (sortear(estado) % (TAM_MAX / tamanho));
             valor += incremento;
             if (valor > TAM_MAX)
-                valor = TAM_MAX - (rand() % (TAM_MAX / 10));
+                valor = TAM_MAX - (sortear(estado) % (TAM_MAX / 10));
         }
     }
     else if (tipo == 2)
     { /* DECRESCENTE */
-        int valor = TAM_MAX - (rand() % (TAM_MAX / 10));
+        int valor = TAM_MAX - (sortear(estado) % (TAM_MAX / 10));
         for (int i = 0; i < tamanho; i++)
         {
             v[i] = valor;
-            int decremento = 1 + (rand() % (TAM_MAX / tamanho));
+            int decremento = 1 + (sortear(estado) % (TAM_MAX / tamanho));
             valor -= decremento;
             if (valor < 0)
-                valor = rand() % (TAM_MAX / 10);
+                valor = sortear(estado) % (TAM_MAX / 10);
         }
     }
     else if (tipo == 3)
     { /* ALEATÓRIO */
         for (int i = 0; i < tamanho; i++)
-            v[i] = rand() % TAM_MAX;
-        shuffle(v, tamanho);
+            v[i] = sortear(estado) % TAM_MAX;
+        shuffleComEstado(v, tamanho, estado);
     }
 }
 
-
 /**
- * @brief Implementa o algoritmo Shell Sort para ordenar um vetor.
- * @param v Vetor a ser ordenado.
+ * @brief Gera um vetor com elementos em ordem crescente, decrescente ou aleatória (com rand()).
+ * @param v Vetor a ser preenchido.
+ * @param tipo Tipo de vetor: 1 - crescente, 2 - decrescente, 3 - aleatório.
  * @param tamanho Tamanho do vetor.
- * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
- * @param trocas Ponteiro para armazenar o número de trocas realizadas.
  * @return void
- */
-void shellSort(int v[], int tamanho, long *comparacoes, long *trocas)
+*/
+void gerarVetor(int v[], int tipo, int tamanho)
 {
-    *comparacoes = 0;
-    *trocas = 0;
+    gerarVetorComEstado(v, tipo, tamanho, NULL);
+}
+
 
+/**
+ * @brief Calcula o gap inicial da sequência de Knuth (h = (3^k - 1) / 2) para um tamanho de vetor.
+ * @param tamanho Tamanho do vetor.
+ * @return Gap inicial.
+ */
+int gapInicialKnuth(int tamanho)
+{
     float k = log(tamanho + 1) / log(3);
     k = floor(k + 0.5);
-    int h = (pow(3, k) - 1) / 2;
+    return (pow(3, k) - 1) / 2;
+}
 
-    while (h >= 1)
+/* ================= VARIANTES DO PASSO DE INSERÇÃO ================= */
+/**
+ * @brief Passo de inserção para o gap h, versão escalar com desvios (laço original).
+ *        Todas as variantes acumulam os mesmos contadores lógicos de comparações e trocas.
+ * @param v Vetor sendo ordenado.
+ * @param tamanho Tamanho do vetor.
+ * @param h Gap do passo.
+ * @param comparacoes Contador de comparações (acumulado).
+ * @param trocas Contador de trocas (acumulado).
+ */
+void passoShellEscalar(int v[], int tamanho, int h, long *comparacoes, long *trocas)
+{
+    for (int i = h; i < tamanho; i++)
     {
-        for (int i = h; i < tamanho; i++)
+        int aux = v[i];
+        int j = i;
+        int continuar = 1;
+
+        while (j >= h && continuar)
+        {
+            (*comparacoes)++;
+            if (v[j - h] > aux)
+            {
+                v[j] = v[j - h];
+                (*trocas)++;
+                j = j - h;
+            }
+            else
+            {
+                continuar = 0;
+            }
+        }
+        v[j] = aux;
+    }
+}
+
+/**
+ * @brief Passo de inserção com sentinela. O primeiro elemento de cada cadeia é o menor dela;
+ *        se o novo elemento não for menor que ele, o laço interno roda sem o teste j >= h
+ *        (esse elemento serve de sentinela). Caso contrário, a cadeia inteira é deslocada
+ *        sem comparações. Os contadores são atualizados fora dos desvios.
+ */
+void passoShellSentinela(int v[], int tamanho, int h, long *comparacoes, long *trocas)
+{
+    long comp = 0, desl = 0;
+
+    /* bloco: posições [inicio, inicio + h), cada uma com inicio / h elementos antes na cadeia */
+    for (int inicio = h; inicio < tamanho; inicio += h)
+    {
+        int fim = inicio + h < tamanho ? inicio + h : tamanho;
+        long anteriores = inicio / h;
+
+        for (int i = inicio; i < fim; i++)
         {
             int aux = v[i];
+            int primeiro = i - inicio;
             int j = i;
-            int continuar = 1;
 
-            while (j >= h && continuar)
+            if (aux < v[primeiro])
             {
-                (*comparacoes)++;
-                if (v[j - h] > aux)
+                for (; j > primeiro; j -= h)
+                    v[j] = v[j - h];
+                comp += anteriores;
+                desl += anteriores;
+            }
+            else
+            {
+                long deslocados = 0;
+                while (v[j - h] > aux)
                 {
                     v[j] = v[j - h];
-                    (*trocas)++;
-                    j = j - h;
+                    j -= h;
+                    deslocados++;
                 }
-                else
+                comp += deslocados + 1;
+                desl += deslocados;
+            }
+            v[j] = aux;
+        }
+    }
+
+    *comparacoes += comp;
+    *trocas += desl;
+}
+
+#ifdef SIMD_X86
+/**
+ * @brief Passo de inserção AVX2: com h >= 8, os elementos i..i+7 pertencem a cadeias distintas
+ *        e só leem posições anteriores a i, então as 8 inserções andam juntas. Em cada degrau,
+ *        v[atual-h .. atual-h+7] é carregado de uma vez; as lanes maiores que o elemento inserido
+ *        deslocam, as demais gravam o elemento e saem da máscara ativa. Perto do início do vetor,
+ *        as lanes restantes terminam de forma escalar. Gaps menores usam passoShellSentinela().
+ */
+__attribute__((target("avx2"))) void passoShellAVX2(int v[], int tamanho, int h, long *comparacoes, long *trocas)
+{
+    if (h < 8)
+    {
+        passoShellSentinela(v, tamanho, h, comparacoes, trocas);
+        return;
+    }
+
+    long comp = 0, desl = 0;
+    int i = h;
+
+    for (; i + 8 <= tamanho; i += 8)
+    {
+        __m256i aux = _mm256_loadu_si256((const __m256i *)&v[i]);
+        __m256i ativo = _mm256_set1_epi32(-1);
+        int atual = i;
+
+        for (;;)
+        {
+            int mascara_ativa = _mm256_movemask_ps(_mm256_castsi256_ps(ativo));
+            int base = atual - h;
+
+            if (base < 0)
+            {
+                int valores[8];
+                _mm256_storeu_si256((__m256i *)valores, aux);
+                for (int k = 0; k < 8; k++)
                 {
-                    continuar = 0;
+                    if (!(mascara_ativa >> k & 1))
+                        continue;
+                    int j = atual + k;
+                    while (j >= h)
+                    {
+                        comp++;
+                        if (v[j - h] <= valores[k])
+                            break;
+                        v[j] = v[j - h];
+                        desl++;
+                        j -= h;
+                    }
+                    v[j] = valores[k];
                 }
+                break;
             }
-            v[j] = aux;
+
+            __m256i anterior = _mm256_loadu_si256((const __m256i *)&v[base]);
+            __m256i maior = _mm256_and_si256(_mm256_cmpgt_epi32(anterior, aux), ativo);
+            __m256i parar = _mm256_andnot_si256(maior, ativo);
+
+            /* Lanes inativas regravam o próprio valor; paradas recebem aux; maiores, o deslocado */
+            __m256i bloco = _mm256_loadu_si256((const __m256i *)&v[atual]);
+            bloco = _mm256_blendv_epi8(bloco, aux, parar);
+            bloco = _mm256_blendv_epi8(bloco, anterior, maior);
+            _mm256_storeu_si256((__m256i *)&v[atual], bloco);
+
+            int mascara_maior = _mm256_movemask_ps(_mm256_castsi256_ps(maior));
+            comp += __builtin_popcount(mascara_ativa);
+            desl += __builtin_popcount(mascara_maior);
+            if (!mascara_maior)
+                break;
+
+            ativo = maior;
+            atual = base;
+        }
+    }
+
+    *comparacoes += comp;
+    *trocas += desl;
+
+    /* Cauda com menos de 8 elementos */
+    for (; i < tamanho; i++)
+    {
+        int aux = v[i];
+        int j = i;
+        while (j >= h)
+        {
+            (*comparacoes)++;
+            if (v[j - h] <= aux)
+                break;
+            v[j] = v[j - h];
+            (*trocas)++;
+            j -= h;
         }
-        h = (h - 1) / 3;
+        v[j] = aux;
     }
 }
 
 /**
- * @brief Mede o tempo decorrido entre dois instantes.
- * @param inicio Instante inicial.
- * @param fim Instante final.
- * @return Tempo decorrido em milissegundos.
-*/
-double medirTempo(struct timespec inicio, struct timespec fim)
+ * @brief Passo de inserção AVX-512: mesma ideia de passoShellAVX2() com 16 lanes (h >= 16),
+ *        usando registradores de máscara e gravações mascaradas.
+ */
+__attribute__((target("avx512f"))) void passoShellAVX512(int v[], int tamanho, int h, long *comparacoes, long *trocas)
 {
-    return (fim.tv_sec - inicio.tv_sec) * 1000.0 +
-           (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
+    if (h < 16)
+    {
+        passoShellSentinela(v, tamanho, h, comparacoes, trocas);
+        return;
+    }
+
+    long comp = 0, desl = 0;
+    int i = h;
+
+    for (; i + 16 <= tamanho; i += 16)
+    {
+        __m512i aux = _mm512_loadu_si512(&v[i]);
+        __mmask16 ativo = 0xFFFF;
+        int atual = i;
+
+        for (;;)
+        {
+            int base = atual - h;
+
+            if (base < 0)
+            {
+                int valores[16];
+                _mm512_storeu_si512(valores, aux);
+                for (int k = 0; k < 16; k++)
+                {
+                    if (!(ativo >> k & 1))
+                        continue;
+                    int j = atual + k;
+                    while (j >= h)
+                    {
+                        comp++;
+                        if (v[j - h] <= valores[k])
+                            break;
+                        v[j] = v[j - h];
+                        desl++;
+                        j -= h;
+                    }
+                    v[j] = valores[k];
+                }
+                break;
+            }
+
+            __m512i anterior = _mm512_loadu_si512(&v[base]);
+            __mmask16 maior = _mm512_mask_cmpgt_epi32_mask(ativo, anterior, aux);
+            _mm512_mask_storeu_epi32(&v[atual], ativo & ~maior, aux);
+            _mm512_mask_storeu_epi32(&v[atual], maior, anterior);
+
+            comp += __builtin_popcount(ativo);
+            desl += __builtin_popcount(maior);
+            if (!maior)
+                break;
+
+            ativo = maior;
+            atual = base;
+        }
+    }
+
+    *comparacoes += comp;
+    *trocas += desl;
+
+    for (; i < tamanho; i++)
+    {
+        int aux = v[i];
+        int j = i;
+        while (j >= h)
+        {
+            (*comparacoes)++;
+            if (v[j - h] <= aux)
+                break;
+            v[j] = v[j - h];
+            (*trocas)++;
+            j -= h;
+        }
+        v[j] = aux;
+    }
 }
+#endif
+
+/* Tabela de despacho, indexada por VARIANTE_* */
+const FuncaoPassoShell passosShell[NUM_VARIANTES] = {
+    passoShellEscalar,
+    passoShellSentinela,
+#ifdef SIMD_X86
+    passoShellAVX2,
+    passoShellAVX512,
+#else
+    NULL,
+    NULL,
+#endif
+};
 
 /**
- * @brief Calcula a média dos valores do tipo double em um intervalo do vetor.
- * @param valores Vetor de valores do tipo double.
- * @param inicio Índice inicial do intervalo.
- * @param fim Índice final do intervalo.
- * @return Média dos valores no intervalo.
+ * @brief Indica se a CPU atual executa a variante (CPUID via __builtin_cpu_supports).
+ * @param variante Uma das constantes VARIANTE_*.
+ * @return 1 se suportada, 0 caso contrário.
  */
-double calcularMediaDouble(double valores[], int inicio, int fim)
+int varianteSuportada(int variante)
 {
-    double soma = 0.0;
-    for (int i = inicio; i <= fim; i++)
-        soma += valores[i];
-    return soma / (fim - inicio + 1);
+    if (variante == VARIANTE_ESCALAR || variante == VARIANTE_SENTINELA)
+        return 1;
+#ifdef SIMD_X86
+    if (variante == VARIANTE_AVX2)
+        return __builtin_cpu_supports("avx2");
+    if (variante == VARIANTE_AVX512)
+        return __builtin_cpu_supports("avx512f");
+#endif
+    return 0;
 }
 
 /**
- * @brief Calcula o desvio padrão dos valores em um intervalo do vetor.
- * @param valores Vetor de valores.
- * @param inicio Índice inicial do intervalo.
- * @param fim Índice final do intervalo.
- * @param media Média dos valores no intervalo.
- * @return Desvio padrão dos valores no intervalo.
+ * @brief Procura um nome em uma tabela de nomes.
+ * @return Índice do nome, ou -1 se não existir.
  */
-double calcularDesvioPadraoDouble(double valores[], int inicio, int fim, double media)
+int indiceNome(const char *nomes[], int num_nomes, const char *nome)
 {
-    double soma = 0.0;
-    for (int i = inicio; i <= fim; i++)
-        soma += pow(valores[i] - media, 2);
-    return sqrt(soma / (fim - inicio + 1));
+    for (int k = 0; k < num_nomes; k++)
+        if (strcmp(nomes[k], nome) == 0)
+            return k;
+    return -1;
 }
 
 /**
- * @brief Calcula a média dos valores do tipo long em um intervalo do vetor.
- * @param valores Vetor de valores do tipo long.
- * @param inicio Índice inicial do intervalo.
- * @param fim Índice final do intervalo.
- * @return Média dos valores no intervalo convertida para double.
+ * @brief Variante mais larga suportada pela CPU (usada com ORDENACAO_VARIANTE=auto).
  */
-double calcularMediaLong(long valores[], int inicio, int fim)
+int varianteMaisLarga()
 {
-    long soma = 0;
-    for (int i = inicio; i <= fim; i++)
-        soma += valores[i];
-    return (double)soma / (fim - inicio + 1);
+    for (int k = VARIANTE_AVX512; k >= VARIANTE_AVX2; k--)
+        if (varianteSuportada(k))
+            return k;
+    return VARIANTE_SENTINELA;
 }
 
 /**
- * @brief Salva os resultados gerais em um arquivo CSV.
- * @param resultados Vetor de resultados individuais.
- * @param num_resultados Número de resultados individuais.
- * @param estatisticas Vetor de estatísticas calculadas.
- * @param num_estatisticas Número de estatísticas calculadas.
+ * @brief Índice de uma variante pelo nome. Aceita "sem_desvio", nome antigo da variante
+ *        sentinela, para perfis e variáveis de ambiente gravados antes da troca de nome.
+ * @return VARIANTE_*, ou -1 se o nome não existir.
+ */
+int indiceVariante(const char *nome)
+{
+    if (strcmp(nome, "sem_desvio") == 0)
+        return VARIANTE_SENTINELA;
+    return indiceNome(nomesVariantes, NUM_VARIANTES, nome);
+}
+
+/**
+ * @brief Escolhe a variante dos kernels no início do programa: a escalar (mesmo laço dos
+ *        resultados de referência), a do perfil de ajuste (se houver) ou, com prioridade, a indicada
+ *        na variável de ambiente ORDENACAO_VARIANTE (escalar, sentinela, avx2, avx512 ou auto, a mais
+ *        larga suportada pela CPU). Uma variante forçada que a CPU não suporta é recusada com aviso.
  * @return void
  */
-void salvarCSVGeral(ResultadoCSV resultados[], int num_resultados, Estatisticas estatisticas[], int num_estatisticas)
+void selecionarVariante()
 {
-    time_t agora = time(NULL);
-    struct tm *info = localtime(&agora);
-    char nomeCSV[150];
+    varianteAtiva = VARIANTE_ESCALAR;
+    if (perfilAtivo.variante >= 0 && varianteSuportada(perfilAtivo.variante))
+        varianteAtiva = perfilAtivo.variante;
 
-    sprintf(nomeCSV, "../results/files/shellSort/shellsort_geral_%04d-%02d-%02d_%02d-%02d-%02d.csv",
-            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
-            info->tm_hour, info->tm_min, info->tm_sec);
+    const char *forcada = getenv("ORDENACAO_VARIANTE");
+    if (!forcada || !*forcada)
+        return;
 
-    FILE *csv = fopen(nomeCSV, "w");
-    if (!csv)
+    if (strcmp(forcada, "auto") == 0)
     {
-        printf("Erro ao criar o arquivo CSV.\n");
+        varianteAtiva = varianteMaisLarga();
         return;
     }
 
-    fprintf(csv, "algoritmo;cenario;tamanho;repeticao;tempo_ms;comparacoes;trocas\n");
-
-    for (int i = 0; i < num_resultados; i++)
-    {
-        fprintf(csv, "%s;%s;%d;%d;%.3f;%ld;%ld\n",
-                resultados[i].algoritmo, resultados[i].cenario,
-                resultados[i].tamanho, resultados[i].repeticao,
-                resultados[i].tempo, resultados[i].comparacoes,
-                resultados[i].trocas);
-    }
+    int k = indiceVariante(forcada);
+    if (k < 0)
+        printf("AVISO: variante desconhecida '%s' em ORDENACAO_VARIANTE; usando '%s'.\n",
+               forcada, nomesVariantes[varianteAtiva]);
+    else if (varianteSuportada(k))
+        varianteAtiva = k;
+    else
+        printf("AVISO: variante '%s' nao suportada por esta CPU; usando '%s'.\n",
+               forcada, nomesVariantes[varianteAtiva]);
+}
 
-    fprintf(csv, "\nESTATISTICAS (descartadas as %d primeiras repeticoes)\n", QTD_DESCARTES);
-    fprintf(csv, "algoritmo;cenario;tamanho;media_tempo_ms;desvio_tempo_ms;media_comparacoes;media_trocas\n");
+/* ================= PERFIL DE AJUSTE ================= */
+/**
+ * @brief Caminho do perfil de ajuste: variável ORDENACAO_PERFIL ou PERFIL_PADRAO.
+ */
+const char *caminhoPerfil()
+{
+    const char *caminho = getenv("ORDENACAO_PERFIL");
+    return caminho && *caminho ? caminho : PERFIL_PADRAO;
+}
 
-    for (int i = 0; i < num_estatisticas; i++)
+/**
+ * @brief Carrega o perfil de ajuste (linhas chave=valor; '#' inicia comentário) em perfilAtivo.
+ *        Chaves ausentes mantêm o padrão; chaves ou valores inválidos geram aviso e são ignorados.
+ * @param caminho Arquivo do perfil.
+ * @return 1 se o arquivo foi lido, 0 se não existe.
+ */
+int carregarPerfil(const char *caminho)
+{
+    FILE *arquivo = fopen(caminho, "r");
+    if (!arquivo)
+        return 0;
+
+    char linha[256];
+    while (fgets(linha, sizeof(linha), arquivo))
+    {
+        linha[strcspn(linha, "#\r\n")] = '\0';
+        char *igual = strchr(linha, '=');
+        if (!igual)
+            continue;
+        *igual = '\0';
+        const char *chave = linha, *valor = igual + 1;
+
+        if (strcmp(chave, "sequencia_gaps") == 0 && indiceNome(nomesSequencias, NUM_SEQUENCIAS, valor) >= 0)
+            perfilAtivo.sequencia_gaps = indiceNome(nomesSequencias, NUM_SEQUENCIAS, valor);
+        else if (strcmp(chave, "variante") == 0 && indiceVariante(valor) >= 0)
+            perfilAtivo.variante = indiceVariante(valor);
+        else if (strcmp(chave, "corte_selecao") == 0 && atoi(valor) > 0)
+            perfilAtivo.corte_selecao = atoi(valor);
+        else if (strcmp(chave, "folha_paralela") == 0 && atoi(valor) >= 0)
+            perfilAtivo.folha_paralela = atoi(valor);
+        else if (strcmp(chave, "threads") == 0 && atoi(valor) >= 0)
+            perfilAtivo.threads = atoi(valor);
+        else
+            printf("AVISO: entrada invalida no perfil %s: %s=%s\n", caminho, chave, valor);
+    }
+
+    fclose(arquivo);
+    snprintf(arquivoPerfil, sizeof(arquivoPerfil), "%s", caminho);
+    return 1;
+}
+
+/**
+ * @brief Grava perfilAtivo no arquivo de perfil de ajuste.
+ * @param caminho Arquivo do perfil.
+ * @return 1 em caso de sucesso, 0 em caso de erro.
+ */
+int salvarPerfil(const char *caminho)
+{
+    FILE *arquivo = fopen(caminho, "w");
+    if (!arquivo)
+        return 0;
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    fprintf(arquivo, "# Perfil de ajuste gerado pelo autoajuste em %04d-%02d-%02d %02d:%02d:%02d\n",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday, info->tm_hour, info->tm_min, info->tm_sec);
+    fprintf(arquivo, "sequencia_gaps=%s\n", nomesSequencias[perfilAtivo.sequencia_gaps]);
+    fprintf(arquivo, "corte_selecao=%d\n", perfilAtivo.corte_selecao);
+    fprintf(arquivo, "folha_paralela=%d\n", perfilAtivo.folha_paralela);
+    fprintf(arquivo, "threads=%d\n", perfilAtivo.threads);
+    fprintf(arquivo, "variante=%s\n", nomesVariantes[perfilAtivo.variante >= 0 ? perfilAtivo.variante : varianteAtiva]);
+    fclose(arquivo);
+    return 1;
+}
+
+/**
+ * @brief Descreve perfilAtivo em uma linha (todos os campos), usada na chave do cache de resultados.
+ * @param texto Recebe a descrição.
+ * @param tamanho Tamanho de texto.
+ * @return void
+ */
+void descreverPerfil(char *texto, size_t tamanho)
+{
+    snprintf(texto, tamanho, "gaps=%s,corte=%d,folha=%d,threads=%d,variante=%s",
+             nomesSequencias[perfilAtivo.sequencia_gaps], perfilAtivo.corte_selecao, perfilAtivo.folha_paralela,
+             perfilAtivo.threads, perfilAtivo.variante >= 0 ? nomesVariantes[perfilAtivo.variante] : "-");
+}
+
+/**
+ * @brief Gera a sequência de gaps do Shell Sort em ordem decrescente, terminando em 1.
+ *        Knuth mantém o gap inicial de gapInicialKnuth() e h = (h - 1) / 3. As demais
+ *        usam apenas os gaps menores que o tamanho do vetor (com tamanho >= 2, o gap 1 sempre está).
+ * @param tamanho Tamanho do vetor.
+ * @param sequencia Uma das constantes GAPS_*.
+ * @param gaps Vetor com MAX_PASSOS posições que recebe os gaps.
+ * @return Quantidade de gaps.
+ */
+int gerarGaps(int tamanho, int sequencia, int gaps[])
+{
+    long crescentes[MAX_PASSOS];
+    int num = 0;
+
+    /* Vetores com menos de 2 elementos já estão ordenados: nenhum gap (todos seriam >= tamanho) */
+    if (tamanho < 2)
+        return 0;
+
+    if (sequencia == GAPS_KNUTH)
+    {
+        for (int h = gapInicialKnuth(tamanho); h >= 1 && num < MAX_PASSOS; h = (h - 1) / 3)
+            gaps[num++] = h;
+        return num;
+    }
+
+    if (sequencia == GAPS_CIURA)
+    {
+        static const int ciura[] = {1, 4, 10, 23, 57, 132, 301, 701, 1750};
+        long h = 0;
+        for (int k = 0; k < 9 && ciura[k] < tamanho; k++)
+            crescentes[num++] = h = ciura[k];
+        /* Extensão usual além de 1750: h = 2,25 * h */
+        if (num == 9)
+            while (num < MAX_PASSOS && (long)(h * 2.25) < tamanho)
+                crescentes[num++] = h = (long)(h * 2.25);
+    }
+    else if (sequencia == GAPS_SEDGEWICK)
+    {
+        /* 1, 8, 23, 77, 281, ...: 4^k + 3 * 2^(k-1) + 1 */
+        crescentes[num++] = 1;
+        for (int k = 1; num < MAX_PASSOS; k++)
+        {
+            long h = (1L << (2 * k)) + 3 * (1L << (k - 1)) + 1;
+            if (h >= tamanho)
+                break;
+            crescentes[num++] = h;
+        }
+    }
+    else
+    {
+        /* Tokuda: ceil((9 * (9/4)^k - 4) / 5) */
+        double potencia = 1.0;
+        for (int k = 0; num < MAX_PASSOS; k++, potencia *= 2.25)
+        {
+            long h = (long)ceil((9.0 * potencia - 4.0) / 5.0);
+            if (h >= tamanho)
+                break;
+            crescentes[num++] = h;
+        }
+    }
+
+    for (int k = 0; k < num; k++)
+        gaps[k] = (int)crescentes[num - 1 - k];
+    return num;
+}
+
+/**
+ * @brief Implementa o Shell Sort registrando, opcionalmente, o custo de cada passo (gap).
+ *        O passo de inserção de cada gap é o da variante ativa (ver selecionarVariante()).
+ *        Os contadores por passo são obtidos pela diferença dos totais no início e no fim
+ *        de cada gap, e os ciclos são lidos apenas nas fronteiras dos passos, de modo que
+ *        o laço interno não sofre custo adicional.
+ * @param v Vetor a ser ordenado.
+ * @param tamanho Tamanho do vetor.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ * @param passos Vetor (com MAX_PASSOS posições) que recebe o perfil de cada gap, ou NULL.
+ * @param num_passos Ponteiro para armazenar o número de passos registrados, ou NULL.
+ * @return void
+ */
+void shellSortPerfilado(int v[], int tamanho, long *comparacoes, long *trocas,
+                        PerfilPasso passos[], int *num_passos)
+{
+    *comparacoes = 0;
+    *trocas = 0;
+
+    FuncaoPassoShell passoShell = passosShell[varianteAtiva];
+    int gaps[MAX_PASSOS];
+    int num_gaps = gerarGaps(tamanho, perfilAtivo.sequencia_gaps, gaps);
+    int passo = 0;
+
+    for (int g = 0; g < num_gaps; g++)
+    {
+        int h = gaps[g];
+        long comparacoes_inicio = *comparacoes;
+        long trocas_inicio = *trocas;
+        unsigned long long ciclos_inicio = passos ? lerCiclos() : 0;
+
+        passoShell(v, tamanho, h, comparacoes, trocas);
+
+        if (passos && passo < MAX_PASSOS)
+        {
+            passos[passo].ciclos = lerCiclos() - ciclos_inicio;
+            passos[passo].h = h;
+            passos[passo].comparacoes = *comparacoes - comparacoes_inicio;
+            passos[passo].trocas = *trocas - trocas_inicio;
+            passo++;
+        }
+    }
+
+    if (num_passos)
+        *num_passos = passo;
+}
+
+/**
+ * @brief Implementa o algoritmo Shell Sort para ordenar um vetor.
+ * @param v Vetor a ser ordenado.
+ * @param tamanho Tamanho do vetor.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ * @return void
+ */
+void shellSort(int v[], int tamanho, long *comparacoes, long *trocas)
+{
+    shellSortPerfilado(v, tamanho, comparacoes, trocas, NULL, NULL);
+}
+
+/* ================= ORDENAÇÃO EM LOTE (VETORES PEQUENOS) ================= */
+/**
+ * @brief Ordena um lote de vetores de mesmo tamanho, um após o outro, sem contadores.
+ *        Os gaps são calculados uma única vez para todo o lote.
+ * @param dados Vetores armazenados de forma contígua (vetor k começa em dados[k * tamanho]).
+ * @param num_vetores Quantidade de vetores no lote.
+ * @param tamanho Tamanho de cada vetor.
+ * @return void
+ */
+void shellSortLoteEscalar(int dados[], int num_vetores, int tamanho)
+{
+    int gaps[MAX_PASSOS];
+    int num_gaps = 0;
+
+    for (int h = gapInicialKnuth(tamanho); h >= 1 && num_gaps < MAX_PASSOS; h = (h - 1) / 3)
+        gaps[num_gaps++] = h;
+
+    for (int k = 0; k < num_vetores; k++)
+    {
+        int *v = dados + (size_t)k * tamanho;
+
+        if (tamanho >= REDE_TAM_MIN && tamanho <= REDE_TAM_MAX)
+        {
+            redesOrdenacao[tamanho](v);
+            continue;
+        }
+
+        for (int g = 0; g < num_gaps; g++)
+        {
+            int h = gaps[g];
+            for (int i = h; i < tamanho; i++)
+            {
+                int aux = v[i];
+                int j = i;
+                while (j >= h && v[j - h] > aux)
+                {
+                    v[j] = v[j - h];
+                    j -= h;
+                }
+                v[j] = aux;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Ordena um vetor de tamanho fixo pequeno com uma rede de ordenação sem desvios
+ *        (ver redesOrdenacao.h). Tamanhos fora de [REDE_TAM_MIN, REDE_TAM_MAX] usam o Shell Sort.
+ * @param v Vetor a ser ordenado.
+ * @param tamanho Tamanho do vetor.
+ * @return void
+ */
+void ordenarFixo(int v[], int tamanho)
+{
+    if (tamanho >= REDE_TAM_MIN && tamanho <= REDE_TAM_MAX)
+        redesOrdenacao[tamanho](v);
+    else if (tamanho > REDE_TAM_MAX)
+        shellSortLoteEscalar(v, 1, tamanho);
+}
+
+#ifdef SIMD_X86
+/**
+ * @brief Ordena grupos de 8 vetores simultaneamente, um vetor por lane AVX2.
+ *        Os 8 vetores são intercalados (elemento i de todos os vetores em um registrador)
+ *        e a inserção de cada gap anda em lockstep: uma máscara indica as lanes que ainda
+ *        estão deslocando elementos, e o laço termina quando nenhuma lane está ativa.
+ *        Para tamanhos até REDE_TAM_MAX, a rede de ordenação AVX2 substitui os passos de gap.
+ * @param dados Vetores armazenados de forma contígua.
+ * @param num_vetores Quantidade de vetores no lote.
+ * @param tamanho Tamanho de cada vetor.
+ * @return Quantidade de vetores ordenados (múltiplo de 8); o restante fica para o caminho escalar.
+ */
+__attribute__((target("avx2")))
+int shellSortLoteAVX2(int dados[], int num_vetores, int tamanho)
+{
+    __m256i *buf = aligned_alloc(32, (size_t)tamanho * sizeof(__m256i));
+    if (!buf)
+        return 0;
+
+    int *lanes = (int *)buf;
+    int grupos = num_vetores / 8;
+    __m256i todos = _mm256_set1_epi32(-1);
+
+    for (int g = 0; g < grupos; g++)
+    {
+        int *base = dados + (size_t)g * 8 * tamanho;
+
+        for (int i = 0; i < tamanho; i++)
+            for (int a = 0; a < 8; a++)
+                lanes[i * 8 + a] = base[a * tamanho + i];
+
+        /* Tamanhos cobertos por rede de ordenação dispensam os passos de gap */
+        int usa_rede = tamanho >= REDE_TAM_MIN && tamanho <= REDE_TAM_MAX;
+        if (usa_rede)
+            redesOrdenacaoAVX2[tamanho](buf);
+
+        for (int h = usa_rede ? 0 : gapInicialKnuth(tamanho); h >= 1; h = (h - 1) / 3)
+        {
+            for (int i = h; i < tamanho; i++)
+            {
+                __m256i aux = buf[i];
+                __m256i ativo = todos;
+                int j = i;
+
+                for (;;)
+                {
+                    if (j < h)
+                    {
+                        buf[j] = _mm256_blendv_epi8(buf[j], aux, ativo);
+                        break;
+                    }
+                    __m256i anterior = buf[j - h];
+                    __m256i maior = _mm256_and_si256(_mm256_cmpgt_epi32(anterior, aux), ativo);
+                    __m256i novo = _mm256_blendv_epi8(aux, anterior, maior);
+                    buf[j] = _mm256_blendv_epi8(buf[j], novo, ativo);
+                    if (_mm256_testz_si256(maior, maior))
+                        break;
+                    ativo = maior;
+                    j -= h;
+                }
+            }
+        }
+
+        for (int a = 0; a < 8; a++)
+            for (int i = 0; i < tamanho; i++)
+                base[a * tamanho + i] = lanes[i * 8 + a];
+    }
+
+    free(buf);
+    return grupos * 8;
+}
+
+/**
+ * @brief Versão AVX-512 de shellSortLoteAVX2, com 16 vetores por grupo e máscaras de bits.
+ * @param dados Vetores armazenados de forma contígua.
+ * @param num_vetores Quantidade de vetores no lote.
+ * @param tamanho Tamanho de cada vetor.
+ * @return Quantidade de vetores ordenados (múltiplo de 16); o restante fica para o chamador.
+ */
+__attribute__((target("avx512f")))
+int shellSortLoteAVX512(int dados[], int num_vetores, int tamanho)
+{
+    __m512i *buf = aligned_alloc(64, (size_t)tamanho * sizeof(__m512i));
+    if (!buf)
+        return 0;
+
+    int *lanes = (int *)buf;
+    int grupos = num_vetores / 16;
+
+    for (int g = 0; g < grupos; g++)
+    {
+        int *base = dados + (size_t)g * 16 * tamanho;
+
+        for (int i = 0; i < tamanho; i++)
+            for (int a = 0; a < 16; a++)
+                lanes[i * 16 + a] = base[a * tamanho + i];
+
+        /* Tamanhos cobertos por rede de ordenação dispensam os passos de gap */
+        int usa_rede = tamanho >= REDE_TAM_MIN && tamanho <= REDE_TAM_MAX;
+        if (usa_rede)
+            redesOrdenacaoAVX512[tamanho](buf);
+
+        for (int h = usa_rede ? 0 : gapInicialKnuth(tamanho); h >= 1; h = (h - 1) / 3)
+        {
+            for (int i = h; i < tamanho; i++)
+            {
+                __m512i aux = buf[i];
+                __mmask16 ativo = 0xFFFF;
+                int j = i;
+
+                for (;;)
+                {
+                    if (j < h)
+                    {
+                        buf[j] = _mm512_mask_mov_epi32(buf[j], ativo, aux);
+                        break;
+                    }
+                    __m512i anterior = buf[j - h];
+                    __mmask16 maior = _mm512_mask_cmpgt_epi32_mask(ativo, anterior, aux);
+                    /* Lanes que continuam recebem o anterior; as que param recebem aux */
+                    __m512i novo = _mm512_mask_mov_epi32(aux, maior, anterior);
+                    buf[j] = _mm512_mask_mov_epi32(buf[j], ativo, novo);
+                    if (!maior)
+                        break;
+                    ativo = maior;
+                    j -= h;
+                }
+            }
+        }
+
+        for (int a = 0; a < 16; a++)
+            for (int i = 0; i < tamanho; i++)
+                base[a * tamanho + i] = lanes[i * 16 + a];
+    }
+
+    free(buf);
+    return grupos * 16;
+}
+#endif
+
+/**
+ * @brief Ordena um lote de vetores de mesmo tamanho em uma única chamada.
+ *        Usa o caminho AVX-512 (16 vetores por vez) ou AVX2 (8 vetores por vez) quando o
+ *        processador suporta, e o caminho escalar para os vetores restantes.
+ * @param dados Vetores armazenados de forma contígua (vetor k começa em dados[k * tamanho]).
+ * @param num_vetores Quantidade de vetores no lote.
+ * @param tamanho Tamanho de cada vetor.
+ * @return void
+ */
+void shellSortLote(int dados[], int num_vetores, int tamanho)
+{
+    int feitos = 0;
+
+#ifdef SIMD_X86
+    if (__builtin_cpu_supports("avx512f"))
+        feitos = shellSortLoteAVX512(dados, num_vetores, tamanho);
+    else if (__builtin_cpu_supports("avx2"))
+        feitos = shellSortLoteAVX2(dados, num_vetores, tamanho);
+#endif
+
+    shellSortLoteEscalar(dados + (size_t)feitos * tamanho, num_vetores - feitos, tamanho);
+}
+
+/* ================= ORDENAÇÃO INDIRETA (ARGSORT) ================= */
+/**
+ * @brief Shell Sort indireto: ordena um vetor de índices pelas chaves que eles referenciam,
+ *        sem mover as chaves. Empates são desfeitos pelo índice, tornando o resultado estável.
+ * @param chaves Vetor de chaves (não é modificado).
+ * @param indices Vetor que recebe a permutação ordenada (chaves[indices[0]] <= chaves[indices[1]] <= ...).
+ * @param tamanho Tamanho dos vetores.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ * @return void
+ */
+void shellSortIndices(const int chaves[], int indices[], int tamanho, long *comparacoes, long *trocas)
+{
+    *comparacoes = 0;
+    *trocas = 0;
+
+    for (int i = 0; i < tamanho; i++)
+        indices[i] = i;
+
+    for (int h = gapInicialKnuth(tamanho); h >= 1; h = (h - 1) / 3)
+    {
+        for (int i = h; i < tamanho; i++)
+        {
+            int aux = indices[i];
+            int chave = chaves[aux];
+            int j = i;
+
+            while (j >= h)
+            {
+                int anterior = indices[j - h];
+                (*comparacoes)++;
+                if (chaves[anterior] > chave || (chaves[anterior] == chave && anterior > aux))
+                {
+                    indices[j] = anterior;
+                    (*trocas)++;
+                    j -= h;
+                }
+                else
+                    break;
+            }
+            indices[j] = aux;
+        }
+    }
+}
+
+/**
+ * @brief Shell Sort sobre pares (chave, índice). Mantém a chave ao lado do índice, de modo que
+ *        as comparações não precisam buscar a chave em outro vetor (melhor localidade).
+ * @param pares Vetor de pares a ser ordenado.
+ * @param tamanho Tamanho do vetor.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ * @return void
+ */
+void shellSortPares(ParChaveIndice pares[], int tamanho, long *comparacoes, long *trocas)
+{
+    *comparacoes = 0;
+    *trocas = 0;
+
+    for (int h = gapInicialKnuth(tamanho); h >= 1; h = (h - 1) / 3)
+    {
+        for (int i = h; i < tamanho; i++)
+        {
+            ParChaveIndice aux = pares[i];
+            int j = i;
+
+            while (j >= h)
+            {
+                (*comparacoes)++;
+                if (pares[j - h].chave > aux.chave ||
+                    (pares[j - h].chave == aux.chave && pares[j - h].indice > aux.indice))
+                {
+                    pares[j] = pares[j - h];
+                    (*trocas)++;
+                    j -= h;
+                }
+                else
+                    break;
+            }
+            pares[j] = aux;
+        }
+    }
+}
+
+/**
+ * @brief Shell Sort direto sobre registros de tam_registro bytes com a chave (int) no início.
+ *        Cada deslocamento move o registro inteiro.
+ * @param registros Registros armazenados de forma contígua.
+ * @param tam_registro Tamanho de cada registro em bytes (múltiplo de sizeof(int)).
+ * @param tamanho Quantidade de registros.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas (registros movidos).
+ * @return void
+ */
+void shellSortRegistros(void *registros, size_t tam_registro, int tamanho, long *comparacoes, long *trocas)
+{
+    char *base = registros;
+    char *aux = malloc(tam_registro);
+
+    *comparacoes = 0;
+    *trocas = 0;
+    if (!aux)
+    {
+        printf("Erro ao alocar registro auxiliar!\n");
+        return;
+    }
+
+    for (int h = gapInicialKnuth(tamanho); h >= 1; h = (h - 1) / 3)
+    {
+        for (int i = h; i < tamanho; i++)
+        {
+            memcpy(aux, base + (size_t)i * tam_registro, tam_registro);
+            int chave = *(const int *)aux;
+            int j = i;
+
+            while (j >= h)
+            {
+                (*comparacoes)++;
+                if (CHAVE_REGISTRO(base, tam_registro, j - h) > chave)
+                {
+                    memcpy(base + (size_t)j * tam_registro, base + (size_t)(j - h) * tam_registro, tam_registro);
+                    (*trocas)++;
+                    j -= h;
+                }
+                else
+                    break;
+            }
+            memcpy(base + (size_t)j * tam_registro, aux, tam_registro);
+        }
+    }
+
+    free(aux);
+}
+
+/* ================= ORDENAÇÃO SoA (CHAVE + COLUNAS DE CARGA) ================= */
+/**
+ * @brief Ordena uma coluna de chaves permutando junto uma ou mais colunas de carga paralelas
+ *        (estrutura de vetores). Todas as comparações usam apenas o vetor de chaves.
+ *        Modo SOA_JUNTO: cada deslocamento da cadeia h move a chave e o elemento de cada coluna.
+ *        Modo SOA_PASSO_FINAL: ordena pares chave+índice e depois reúne cada coluna uma única vez
+ *        (com um buffer do tamanho da maior coluna, ou aplicarPermutacao() se faltar memória).
+ * @param chaves Vetor de chaves a ser ordenado.
+ * @param tamanho Quantidade de elementos.
+ * @param colunas Colunas de carga (cada uma com tamanho elementos).
+ * @param num_colunas Número de colunas (até MAX_COLUNAS).
+ * @param modo SOA_JUNTO ou SOA_PASSO_FINAL.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ * @return 1 em caso de sucesso, 0 em caso de erro de alocação ou parâmetros inválidos.
+ */
+int shellSortSoA(int chaves[], int tamanho, ColunaCarga colunas[], int num_colunas, int modo,
+                 long *comparacoes, long *trocas)
+{
+    *comparacoes = 0;
+    *trocas = 0;
+
+    if (num_colunas < 0 || num_colunas > MAX_COLUNAS)
+        return 0;
+
+    if (modo == SOA_JUNTO)
+    {
+        char *aux[MAX_COLUNAS];
+        for (int c = 0; c < num_colunas; c++)
+        {
+            aux[c] = malloc(colunas[c].largura);
+            if (!aux[c])
+            {
+                while (c-- > 0)
+                    free(aux[c]);
+                return 0;
+            }
+        }
+
+        for (int h = gapInicialKnuth(tamanho); h >= 1; h = (h - 1) / 3)
+        {
+            for (int i = h; i < tamanho; i++)
+            {
+                int chave = chaves[i];
+                int j = i;
+
+                while (j >= h)
+                {
+                    (*comparacoes)++;
+                    if (chaves[j - h] <= chave)
+                        break;
+                    j -= h;
+                }
+
+                /* Desloca a cadeia [j, i) de uma posição h, uma coluna por vez */
+                if (j != i)
+                {
+                    for (int c = 0; c < num_colunas; c++)
+                    {
+                        char *col = colunas[c].dados;
+                        size_t w = colunas[c].largura;
+                        memcpy(aux[c], col + (size_t)i * w, w);
+                        for (int k = i; k > j; k -= h)
+                            memcpy(col + (size_t)k * w, col + (size_t)(k - h) * w, w);
+                        memcpy(col + (size_t)j * w, aux[c], w);
+                    }
+                    for (int k = i; k > j; k -= h)
+                    {
+                        chaves[k] = chaves[k - h];
+                        (*trocas)++;
+                    }
+                    chaves[j] = chave;
+                }
+            }
+        }
+
+        for (int c = 0; c < num_colunas; c++)
+            free(aux[c]);
+        return 1;
+    }
+
+    ParChaveIndice *pares = malloc(tamanho * sizeof(ParChaveIndice));
+    int *indices = malloc(tamanho * sizeof(int));
+    if (!pares || !indices)
+    {
+        free(pares);
+        free(indices);
+        return 0;
+    }
+
+    for (int i = 0; i < tamanho; i++)
+    {
+        pares[i].chave = chaves[i];
+        pares[i].indice = i;
+    }
+    shellSortPares(pares, tamanho, comparacoes, trocas);
+
+    size_t maior_largura = 0;
+    for (int c = 0; c < num_colunas; c++)
+        if (colunas[c].largura > maior_largura)
+            maior_largura = colunas[c].largura;
+
+    for (int i = 0; i < tamanho; i++)
+    {
+        chaves[i] = pares[i].chave;
+        indices[i] = pares[i].indice;
+    }
+    free(pares);
+
+    char *buffer = num_colunas > 0 ? malloc((size_t)tamanho * maior_largura) : NULL;
+    for (int c = 0; c < num_colunas; c++)
+    {
+        char *col = colunas[c].dados;
+        size_t w = colunas[c].largura;
+
+        if (buffer)
+        {
+            /* Reunião sequencial na escrita: uma leitura aleatória e uma escrita por elemento */
+            for (int i = 0; i < tamanho; i++)
+                memcpy(buffer + (size_t)i * w, col + (size_t)indices[i] * w, w);
+            memcpy(col, buffer, (size_t)tamanho * w);
+        }
+        else if (aplicarPermutacao(col, w, indices, tamanho) < 0)
+        {
+            free(indices);
+            return 0;
+        }
+    }
+
+    free(buffer);
+    free(indices);
+    return 1;
+}
+
+/* ================= ORDENAÇÃO DE STRINGS (PREFIXO EM LINHA) ================= */
+/**
+ * @brief Monta o prefixo de 8 bytes em big-endian de uma string (bytes ausentes valem zero).
+ */
+uint64_t prefixoString(const char *texto, uint32_t tamanho)
+{
+    uint64_t prefixo = 0;
+    for (uint32_t b = 0; b < 8; b++)
+        prefixo = (prefixo << 8) | (b < tamanho ? (unsigned char)texto[b] : 0);
+    return prefixo;
+}
+
+/**
+ * @brief Prepara as chaves de ordenação de um vetor de strings. Os bytes iniciais comuns a todas
+ *        as strings não decidem nenhuma comparação: o prefixo em linha começa depois deles.
+ * @param textos Strings a ordenar.
+ * @param tamanho Quantidade de strings.
+ * @param chaves Vetor de saída com uma chave por string.
+ * @return Tamanho do prefixo comum (para recuperar as strings com extrairStrings()).
+ */
+uint32_t prepararChavesString(char *const textos[], int tamanho, ChaveString chaves[])
+{
+    uint32_t comum = tamanho > 0 ? (uint32_t)strlen(textos[0]) : 0;
+    for (int i = 1; i < tamanho && comum > 0; i++)
+    {
+        uint32_t b = 0;
+        while (b < comum && textos[i][b] == textos[0][b])
+            b++;
+        comum = b;
+    }
+
+    for (int i = 0; i < tamanho; i++)
+    {
+        chaves[i].texto = textos[i] + comum;
+        chaves[i].tamanho = (uint32_t)strlen(textos[i]) - comum;
+        chaves[i].prefixo = prefixoString(chaves[i].texto, chaves[i].tamanho);
+    }
+    return comum;
+}
+
+/**
+ * @brief Grava em textos as strings na ordem das chaves.
+ */
+void extrairStrings(const ChaveString chaves[], int tamanho, uint32_t comum, char *textos[])
+{
+    for (int i = 0; i < tamanho; i++)
+        textos[i] = (char *)chaves[i].texto - comum;
+}
+
+/**
+ * @brief Compara duas chaves de string com a mesma ordem de strcmp. Prefixos diferentes decidem
+ *        com uma comparação de inteiros; com prefixos iguais, strings de até 8 bytes se distinguem
+ *        pelo tamanho, e só as demais leem o texto (memcmp a partir do 9º byte).
+ * @param desempates Incrementado a cada comparação que precisou ler o texto.
+ * @return Negativo, zero ou positivo, como strcmp.
+ */
+int compararChavesString(const ChaveString *a, const ChaveString *b, long *desempates)
+{
+    if (a->prefixo != b->prefixo)
+        return a->prefixo < b->prefixo ? -1 : 1;
+    if (a->tamanho > 8 && b->tamanho > 8)
+    {
+        (*desempates)++;
+        uint32_t menor = a->tamanho < b->tamanho ? a->tamanho : b->tamanho;
+        int resultado = memcmp(a->texto + 8, b->texto + 8, menor - 8);
+        if (resultado != 0)
+            return resultado;
+    }
+    return (a->tamanho > b->tamanho) - (a->tamanho < b->tamanho);
+}
+
+/**
+ * @brief Shell Sort sobre chaves de string com prefixo em linha (ver compararChavesString()).
+ * @param chaves Vetor de chaves a ser ordenado (preparado com prepararChavesString()).
+ * @param tamanho Tamanho do vetor.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ * @param desempates Ponteiro para armazenar quantas comparações leram o texto das strings.
+ * @return void
+ */
+void shellSortStrings(ChaveString chaves[], int tamanho, long *comparacoes, long *trocas, long *desempates)
+{
+    *comparacoes = 0;
+    *trocas = 0;
+    *desempates = 0;
+
+    for (int h = gapInicialKnuth(tamanho); h >= 1; h = (h - 1) / 3)
+    {
+        for (int i = h; i < tamanho; i++)
+        {
+            ChaveString aux = chaves[i];
+            int j = i;
+
+            while (j >= h)
+            {
+                (*comparacoes)++;
+                if (compararChavesString(&chaves[j - h], &aux, desempates) > 0)
+                {
+                    chaves[j] = chaves[j - h];
+                    (*trocas)++;
+                    j -= h;
+                }
+                else
+                    break;
+            }
+            chaves[j] = aux;
+        }
+    }
+}
+
+/**
+ * @brief Shell Sort de referência sobre os ponteiros das strings, com strcmp em toda comparação.
+ * @param textos Vetor de ponteiros a ser ordenado.
+ * @param tamanho Tamanho do vetor.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ * @return void
+ */
+void shellSortStringsDireto(char *textos[], int tamanho, long *comparacoes, long *trocas)
+{
+    *comparacoes = 0;
+    *trocas = 0;
+
+    for (int h = gapInicialKnuth(tamanho); h >= 1; h = (h - 1) / 3)
+    {
+        for (int i = h; i < tamanho; i++)
+        {
+            char *aux = textos[i];
+            int j = i;
+
+            while (j >= h)
+            {
+                (*comparacoes)++;
+                if (strcmp(textos[j - h], aux) > 0)
+                {
+                    textos[j] = textos[j - h];
+                    (*trocas)++;
+                    j -= h;
+                }
+                else
+                    break;
+            }
+            textos[j] = aux;
+        }
+    }
+}
+
+/**
+ * @brief Comparadores de qsort() para ponteiros de string (strcmp) e para chaves com prefixo.
+ *        Contam as chamadas em comparacoesQsort e desempatesQsort.
+ */
+int compararStringsQsort(const void *a, const void *b)
+{
+    comparacoesQsort++;
+    desempatesQsort++;
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+int compararChavesQsort(const void *a, const void *b)
+{
+    comparacoesQsort++;
+    return compararChavesString((const ChaveString *)a, (const ChaveString *)b, &desempatesQsort);
+}
+
+/**
+ * @brief Gera tamanho strings de uma distribuição (STRINGS_*) na área contígua fornecida
+ *        (STRING_MAX bytes por string) e aponta textos[i] para cada uma.
+ * @param area Área com tamanho * STRING_MAX bytes.
+ * @return void
+ */
+void gerarStrings(char *area, char *textos[], int distribuicao, int tamanho)
+{
+    static const char *diretorios[] = {"/home/usuario/projetos/ordenacao/src/",
+                                       "/home/usuario/projetos/ordenacao/results/"};
+    static const char *dominios[] = {"exemplo.com.br", "exemplo.org", "loja.exemplo.com", "docs.exemplo.net"};
+    static const char *secoes[] = {"produtos", "usuarios", "busca", "artigos", "categorias", "api/v2"};
+
+    for (int i = 0; i < tamanho; i++)
+    {
+        char *s = area + (size_t)i * STRING_MAX;
+        textos[i] = s;
+
+        if (distribuicao == STRINGS_ALEATORIAS)
+        {
+            int comprimento = 4 + rand() % 21;
+            for (int c = 0; c < comprimento; c++)
+                s[c] = (char)('a' + rand() % 26);
+            s[comprimento] = '\0';
+        }
+        else if (distribuicao == STRINGS_PREFIXO_COMUM)
+        {
+            /* O primeiro diretório é prefixo do segundo até "ordenacao/": desempates frequentes */
+            int n = snprintf(s, STRING_MAX, "%s", diretorios[rand() % 2]);
+            int comprimento = 3 + rand() % 12;
+            for (int c = 0; c < comprimento && n < STRING_MAX - 3; c++)
+                s[n++] = (char)('a' + rand() % 26);
+            snprintf(s + n, STRING_MAX - n, ".c");
+        }
+        else
+        {
+            snprintf(s, STRING_MAX, "https://www.%s/%s/%d", dominios[rand() % 4], secoes[rand() % 6],
+                     rand() % TAM_MAX);
+        }
+    }
+}
+
+/* ================= SELEÇÃO E ORDENAÇÃO PARCIAL ================= */
+/**
+ * @brief Reorganiza o vetor para que v[k] seja o elemento que ocuparia a posição k no vetor ordenado,
+ *        com todos os anteriores <= v[k] e todos os posteriores >= v[k] (nth_element).
+ *        Usa introselect: quickselect com pivô mediana de 3 e partição de Hoare; se a profundidade
+ *        passar de 2*log2(n) o intervalo restante é ordenado com shellSort, limitando o pior caso.
+ *        Intervalos de até perfilAtivo.corte_selecao elementos também são resolvidos com shellSort.
+ * @param v Vetor a ser reorganizado.
+ * @param tamanho Quantidade de elementos.
+ * @param k Posição desejada (0 a tamanho-1).
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ * @return O valor do k-ésimo menor elemento (v[k]).
+ */
+int selecionarNesimo(int v[], int tamanho, int k, long *comparacoes, long *trocas)
+{
+    *comparacoes = 0;
+    *trocas = 0;
+
+    int inicio = 0, fim = tamanho - 1;
+    int profundidade = 0;
+    for (int n = tamanho; n > 1; n /= 2)
+        profundidade += 2;
+
+    while (fim - inicio + 1 > perfilAtivo.corte_selecao && profundidade-- > 0)
+    {
+        int meio = inicio + (fim - inicio) / 2;
+
+        /* Mediana de 3: ordena v[inicio], v[meio], v[fim] (também servem de sentinelas) */
+        if (v[meio] < v[inicio])
+        {
+            int temp = v[meio]; v[meio] = v[inicio]; v[inicio] = temp;
+            (*trocas)++;
+        }
+        if (v[fim] < v[meio])
+        {
+            int temp = v[fim]; v[fim] = v[meio]; v[meio] = temp;
+            (*trocas)++;
+            if (v[meio] < v[inicio])
+            {
+                temp = v[meio]; v[meio] = v[inicio]; v[inicio] = temp;
+                (*trocas)++;
+            }
+        }
+        *comparacoes += 3;
+
+        int pivo = v[meio];
+        int i = inicio, j = fim;
+        while (i <= j)
+        {
+            while (v[i] < pivo)
+            {
+                i++;
+                (*comparacoes)++;
+            }
+            while (v[j] > pivo)
+            {
+                j--;
+                (*comparacoes)++;
+            }
+            *comparacoes += 2;
+
+            if (i <= j)
+            {
+                int temp = v[i]; v[i] = v[j]; v[j] = temp;
+                (*trocas)++;
+                i++;
+                j--;
+            }
+        }
+
+        /* [inicio, j] <= pivo, [i, fim] >= pivo e (j, i) == pivo */
+        if (k <= j)
+            fim = j;
+        else if (k >= i)
+            inicio = i;
+        else
+            return v[k];
+    }
+
+    long comp_intervalo, trocas_intervalo;
+    shellSort(v + inicio, fim - inicio + 1, &comp_intervalo, &trocas_intervalo);
+    *comparacoes += comp_intervalo;
+    *trocas += trocas_intervalo;
+
+    return v[k];
+}
+
+/**
+ * @brief Restaura a propriedade de max-heap descendo o elemento da posição i.
+ * @param heap Vetor organizado como heap.
+ * @param tamanho Quantidade de elementos no heap.
+ * @param i Posição do elemento a descer.
+ * @param comparacoes Contador de comparações.
+ * @param trocas Contador de trocas.
+ */
+void descerHeap(int heap[], int tamanho, int i, long *comparacoes, long *trocas)
+{
+    int valor = heap[i];
+    while (2 * i + 1 < tamanho)
+    {
+        int filho = 2 * i + 1;
+        if (filho + 1 < tamanho)
+        {
+            (*comparacoes)++;
+            if (heap[filho + 1] > heap[filho])
+                filho++;
+        }
+        (*comparacoes)++;
+        if (heap[filho] <= valor)
+            break;
+        heap[i] = heap[filho];
+        (*trocas)++;
+        i = filho;
+    }
+    heap[i] = valor;
+}
+
+/**
+ * @brief Copia para saida os k menores elementos de v, em ordem crescente, sem alterar v (top-k).
+ *        Mantém um max-heap com os k menores vistos até o momento: cada elemento restante
+ *        custa uma comparação com a raiz e, se menor, uma descida de O(log k).
+ * @param v Vetor de entrada.
+ * @param tamanho Quantidade de elementos.
+ * @param k Quantidade de menores elementos desejada (1 a tamanho).
+ * @param saida Vetor com espaço para k elementos.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ */
+void selecionarMenores(const int v[], int tamanho, int k, int saida[], long *comparacoes, long *trocas)
+{
+    *comparacoes = 0;
+    *trocas = 0;
+
+    memcpy(saida, v, k * sizeof(int));
+    for (int i = k / 2 - 1; i >= 0; i--)
+        descerHeap(saida, k, i, comparacoes, trocas);
+
+    for (int i = k; i < tamanho; i++)
+    {
+        (*comparacoes)++;
+        if (v[i] < saida[0])
+        {
+            saida[0] = v[i];
+            descerHeap(saida, k, 0, comparacoes, trocas);
+        }
+    }
+
+    /* Extração do heap: o maior vai para o fim, deixando a saída em ordem crescente */
+    for (int fim = k - 1; fim > 0; fim--)
+    {
+        int temp = saida[0];
+        saida[0] = saida[fim];
+        saida[fim] = temp;
+        (*trocas)++;
+        descerHeap(saida, fim, 0, comparacoes, trocas);
+    }
+}
+
+/**
+ * @brief Ordena apenas os k primeiros elementos do resultado (partial sort): após a chamada,
+ *        v[0..k-1] contém os k menores em ordem crescente e o restante fica em ordem arbitrária.
+ *        Seleciona a posição k-1 com selecionarNesimo() e ordena o prefixo com shellSort.
+ * @param v Vetor a ser parcialmente ordenado.
+ * @param tamanho Quantidade de elementos.
+ * @param k Tamanho do prefixo ordenado (1 a tamanho).
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de trocas realizadas.
+ */
+void ordenarParcial(int v[], int tamanho, int k, long *comparacoes, long *trocas)
+{
+    long comp_prefixo, trocas_prefixo;
+
+    selecionarNesimo(v, tamanho, k - 1, comparacoes, trocas);
+    shellSort(v, k - 1, &comp_prefixo, &trocas_prefixo);
+    *comparacoes += comp_prefixo;
+    *trocas += trocas_prefixo;
+}
+
+/* ================= ATUALIZAÇÃO INCREMENTAL DE VETOR ORDENADO ================= */
+/**
+ * @brief Busca binária: primeira posição em v[inicio, fim) cujo valor é >= chave (ou > chave,
+ *        se estrito for 0, isto é, a posição logo após os iguais).
+ * @param v Vetor ordenado.
+ * @param inicio Início do intervalo.
+ * @param fim Fim (exclusivo) do intervalo.
+ * @param chave Valor procurado.
+ * @param estrito 1 para o limite inferior (>=), 0 para o limite superior (>).
+ * @param comparacoes Contador de comparações.
+ * @return Posição encontrada.
+ */
+int buscarPosicao(const int v[], int inicio, int fim, int chave, int estrito, long *comparacoes)
+{
+    while (inicio < fim)
+    {
+        int meio = inicio + (fim - inicio) / 2;
+        (*comparacoes)++;
+        if (estrito ? v[meio] < chave : v[meio] <= chave)
+            inicio = meio + 1;
+        else
+            fim = meio;
+    }
+    return inicio;
+}
+
+/**
+ * @brief Ordena um lote pequeno de chaves (rede de ordenação até REDE_TAM_MAX, shellSort acima).
+ * @param delta Lote a ser ordenado.
+ * @param tam_delta Quantidade de chaves.
+ * @param comparacoes Contador de comparações (acumulado).
+ * @param trocas Contador de trocas (acumulado).
+ */
+void ordenarDelta(int delta[], int tam_delta, long *comparacoes, long *trocas)
+{
+    if (tam_delta <= REDE_TAM_MAX)
+    {
+        ordenarFixo(delta, tam_delta);
+        *comparacoes += tam_delta >= REDE_TAM_MIN ? redesComparadores[tam_delta] : 0;
+        return;
+    }
+
+    long comp_delta, trocas_delta;
+    shellSort(delta, tam_delta, &comp_delta, &trocas_delta);
+    *comparacoes += comp_delta;
+    *trocas += trocas_delta;
+}
+
+/**
+ * @brief Insere um lote de chaves em um vetor já ordenado, mantendo-o ordenado.
+ *        O lote é ordenado com um kernel para vetores pequenos e intercalado de trás para frente
+ *        dentro da própria capacidade do vetor: para cada chave do lote (da maior para a menor),
+ *        uma busca binária acha seu destino e o bloco de elementos maiores é deslocado com um
+ *        único memmove. Comparações são O(m log n); os elementos à frente da menor chave
+ *        inserida são movidos uma única vez.
+ * @param v Vetor ordenado, com espaço para pelo menos *tamanho + tam_delta elementos.
+ * @param tamanho Ponteiro para a quantidade atual de elementos (atualizado).
+ * @param capacidade Quantidade máxima de elementos de v.
+ * @param delta Chaves a inserir (o lote é reordenado no próprio vetor).
+ * @param tam_delta Quantidade de chaves a inserir.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de elementos deslocados.
+ * @return 1 em caso de sucesso, 0 se a capacidade for insuficiente.
+ */
+int inserirLote(int v[], int *tamanho, int capacidade, int delta[], int tam_delta, long *comparacoes, long *trocas)
+{
+    *comparacoes = 0;
+    *trocas = 0;
+
+    if (*tamanho + tam_delta > capacidade)
+        return 0;
+
+    ordenarDelta(delta, tam_delta, comparacoes, trocas);
+
+    int fim = *tamanho; /* v[0, fim) ainda não foi deslocado */
+    for (int j = tam_delta - 1; j >= 0; j--)
+    {
+        /* Limite superior: chaves iguais do lote ficam depois das já existentes */
+        int pos = buscarPosicao(v, 0, fim, delta[j], 0, comparacoes);
+        int bloco = fim - pos;
+
+        if (bloco > 0)
+        {
+            memmove(&v[pos + j + 1], &v[pos], bloco * sizeof(int));
+            *trocas += bloco;
+        }
+        v[pos + j] = delta[j];
+        fim = pos;
+    }
+
+    *tamanho += tam_delta;
+    return 1;
+}
+
+/**
+ * @brief Remove de um vetor ordenado uma ocorrência de cada chave do lote, compactando o vetor.
+ *        O lote é ordenado, cada chave é localizada por busca binária a partir da posição da
+ *        anterior e os trechos entre as posições removidas são deslocados com memmove.
+ * @param v Vetor ordenado.
+ * @param tamanho Ponteiro para a quantidade atual de elementos (atualizado).
+ * @param remover Chaves a remover (o lote é reordenado no próprio vetor).
+ * @param tam_remover Quantidade de chaves no lote.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de elementos deslocados.
+ * @return Quantidade de chaves efetivamente removidas (chaves ausentes são ignoradas).
+ */
+int removerLote(int v[], int *tamanho, int remover[], int tam_remover, long *comparacoes, long *trocas)
+{
+    *comparacoes = 0;
+    *trocas = 0;
+
+    ordenarDelta(remover, tam_remover, comparacoes, trocas);
+
+    int leitura = 0, escrita = 0, removidos = 0;
+    for (int j = 0; j < tam_remover; j++)
+    {
+        int pos = buscarPosicao(v, leitura, *tamanho, remover[j], 1, comparacoes);
+        (*comparacoes)++;
+        if (pos == *tamanho || v[pos] != remover[j])
+            continue;
+
+        /* Compacta o trecho mantido [leitura, pos) e pula a posição removida */
+        int bloco = pos - leitura;
+        if (bloco > 0 && escrita != leitura)
+        {
+            memmove(&v[escrita], &v[leitura], bloco * sizeof(int));
+            *trocas += bloco;
+        }
+        escrita += bloco;
+        leitura = pos + 1;
+        removidos++;
+    }
+
+    int bloco = *tamanho - leitura;
+    if (bloco > 0 && escrita != leitura)
+    {
+        memmove(&v[escrita], &v[leitura], bloco * sizeof(int));
+        *trocas += bloco;
+    }
+
+    *tamanho -= removidos;
+    return removidos;
+}
+
+/**
+ * @brief Troca a chave da posição indicada e a reposiciona localmente, mantendo o vetor ordenado.
+ *        O novo destino é achado por busca binária apenas no lado para onde a chave se moveu,
+ *        e somente os elementos entre a posição antiga e a nova são deslocados.
+ * @param v Vetor ordenado.
+ * @param tamanho Quantidade de elementos.
+ * @param posicao Posição da chave a atualizar.
+ * @param nova_chave Novo valor da chave.
+ * @param comparacoes Contador de comparações (acumulado).
+ * @param trocas Contador de elementos deslocados (acumulado).
+ * @return Nova posição da chave.
+ */
+int atualizarChave(int v[], int tamanho, int posicao, int nova_chave, long *comparacoes, long *trocas)
+{
+    int destino = posicao;
+
+    (*comparacoes)++;
+    if (nova_chave < v[posicao])
+    {
+        destino = buscarPosicao(v, 0, posicao, nova_chave, 0, comparacoes);
+        memmove(&v[destino + 1], &v[destino], (posicao - destino) * sizeof(int));
+        *trocas += posicao - destino;
+    }
+    else
+    {
+        destino = buscarPosicao(v, posicao + 1, tamanho, nova_chave, 1, comparacoes) - 1;
+        memmove(&v[posicao], &v[posicao + 1], (destino - posicao) * sizeof(int));
+        *trocas += destino - posicao;
+    }
+
+    v[destino] = nova_chave;
+    return destino;
+}
+
+/**
+ * @brief Altera várias chaves de uma vez, identificadas pelas posições no vetor ordenado.
+ *        Em vez de reposicionar uma chave por vez (cada uma pode deslocar O(n) elementos),
+ *        as posições alteradas são removidas em uma única compactação e as novas chaves
+ *        são intercaladas com inserirLote(): custo O(n + m log n) para o lote inteiro.
+ * @param v Vetor ordenado.
+ * @param tamanho Quantidade de elementos.
+ * @param posicoes Posições distintas das chaves alteradas (o vetor é reordenado).
+ * @param novas_chaves Novos valores, na mesma ordem de posicoes (o vetor é reordenado).
+ * @param tam_lote Quantidade de chaves alteradas.
+ * @param comparacoes Ponteiro para armazenar o número de comparações realizadas.
+ * @param trocas Ponteiro para armazenar o número de elementos deslocados.
+ * @return void
+ */
+void atualizarLote(int v[], int tamanho, int posicoes[], int novas_chaves[], int tam_lote,
+                   long *comparacoes, long *trocas)
+{
+    long comp_insercao, trocas_insercao;
+
+    *comparacoes = 0;
+    *trocas = 0;
+    if (tam_lote <= 0)
+        return;
+
+    /* As posições só definem o que sai do vetor; a ordem delas em relação às novas chaves não importa */
+    ordenarDelta(posicoes, tam_lote, comparacoes, trocas);
+
+    int escrita = posicoes[0];
+    for (int j = 0; j < tam_lote; j++)
+    {
+        int fim_bloco = j + 1 < tam_lote ? posicoes[j + 1] : tamanho;
+        int bloco = fim_bloco - posicoes[j] - 1;
+        if (bloco > 0)
+        {
+            memmove(&v[escrita], &v[posicoes[j] + 1], bloco * sizeof(int));
+            *trocas += bloco;
+        }
+        escrita += bloco;
+    }
+
+    int restantes = tamanho - tam_lote;
+    inserirLote(v, &restantes, tamanho, novas_chaves, tam_lote, &comp_insercao, &trocas_insercao);
+    *comparacoes += comp_insercao;
+    *trocas += trocas_insercao;
+}
+
+/* ================= ORDENAÇÃO PARALELA (MERGE SORT COM FOLHAS SHELL SORT) ================= */
+/**
+ * @brief Retorna o tamanho da cache L2 em bytes (sysconf), ou L2_PADRAO se não estiver disponível.
+ */
+long tamanhoCacheL2()
+{
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (l2 > 0)
+        return l2;
+#endif
+    return L2_PADRAO;
+}
+
+/**
+ * @brief Retorna o número de núcleos disponíveis, limitado a MAX_THREADS.
+ */
+int numeroNucleos()
+{
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nucleos < 1)
+        return 1;
+    return nucleos > MAX_THREADS ? MAX_THREADS : (int)nucleos;
+}
+
+/**
+ * @brief Merge path: acha quantos elementos de a[0, tam_a) entram nos d primeiros elementos
+ *        da intercalação estável de a com b[0, tam_b) (em caso de empate, a vem primeiro).
+ * @return Quantidade de elementos de a; os outros d - i vêm de b.
+ */
+int diagonalMergePath(const int a[], int tam_a, const int b[], int tam_b, int d)
+{
+    int baixo = d > tam_b ? d - tam_b : 0;
+    int alto = d < tam_a ? d : tam_a;
+
+    while (baixo < alto)
+    {
+        int i = baixo + (alto - baixo) / 2;
+        if (a[i] <= b[d - i - 1])
+            baixo = i + 1;
+        else
+            alto = i;
+    }
+    return baixo;
+}
+
+/**
+ * @brief Executa uma tarefa: ordena a folha com shellSort ou intercala o segmento parte/partes
+ *        da saída, cujos limites em cada entrada são achados pelo merge path.
+ */
+void executarTarefa(const TarefaOrdenacao *t)
+{
+    if (t->tipo == TAREFA_FOLHA)
+    {
+        long comparacoes, trocas;
+        shellSort(t->origem + t->inicio, t->fim - t->inicio, &comparacoes, &trocas);
+        return;
+    }
+
+    const int *a = t->origem + t->inicio;
+    const int *b = t->origem + t->meio;
+    int tam_a = t->meio - t->inicio, tam_b = t->fim - t->meio;
+    int total = tam_a + tam_b;
+
+    int d_inicio = (int)((long long)total * t->parte / t->partes);
+    int d_fim = (int)((long long)total * (t->parte + 1) / t->partes);
+    int i = diagonalMergePath(a, tam_a, b, tam_b, d_inicio);
+    int j = d_inicio - i;
+    int i_fim = diagonalMergePath(a, tam_a, b, tam_b, d_fim);
+    int j_fim = d_fim - i_fim;
+    int *saida = t->destino + t->inicio + d_inicio;
+
+    while (i < i_fim && j < j_fim)
+        *saida++ = b[j] < a[i] ? b[j++] : a[i++];
+    while (i < i_fim)
+        *saida++ = a[i++];
+    while (j < j_fim)
+        *saida++ = b[j++];
+}
+
+/**
+ * @brief Retira uma tarefa da própria fila (pelo fim) ou rouba do início da fila de outra thread.
+ * @return 1 se obteve uma tarefa, 0 se todas as filas estavam vazias.
+ */
+int obterTarefa(PoolTrabalho *pool, int id, TarefaOrdenacao *tarefa)
+{
+    FilaTrabalho *propria = &pool->filas[id];
+
+    pthread_mutex_lock(&propria->trava);
+    if (propria->fim > propria->inicio)
+    {
+        *tarefa = propria->tarefas[--propria->fim];
+        pthread_mutex_unlock(&propria->trava);
+        return 1;
+    }
+    pthread_mutex_unlock(&propria->trava);
+
+    for (int k = 1; k < pool->num_threads; k++)
+    {
+        FilaTrabalho *vitima = &pool->filas[(id + k) % pool->num_threads];
+        pthread_mutex_lock(&vitima->trava);
+        if (vitima->fim > vitima->inicio)
+        {
+            *tarefa = vitima->tarefas[vitima->inicio++];
+            pthread_mutex_unlock(&vitima->trava);
+            pthread_mutex_lock(&propria->trava);
+            propria->roubos++;
+            pthread_mutex_unlock(&propria->trava);
+            return 1;
+        }
+        pthread_mutex_unlock(&vitima->trava);
+    }
+    return 0;
+}
+
+/**
+ * @brief Laço das threads do pool: executa tarefas enquanto houver e dorme até o próximo envio.
+ */
+void *threadTrabalho(void *arg)
+{
+    PoolTrabalho *pool = ((ArgumentoThread *)arg)->pool;
+    int id = ((ArgumentoThread *)arg)->id;
+
+    /* Só a thread do benchmark fica fixada no núcleo verificado; as demais usam todos os núcleos */
+    ambienteLiberarNucleo();
+
+    for (;;)
+    {
+        pthread_mutex_lock(&pool->trava);
+        int geracao = pool->geracao;
+        int encerrar = pool->encerrar;
+        pthread_mutex_unlock(&pool->trava);
+        if (encerrar)
+            return NULL;
+
+        TarefaOrdenacao tarefa;
+        while (obterTarefa(pool, id, &tarefa))
+        {
+            executarTarefa(&tarefa);
+            pthread_mutex_lock(&pool->trava);
+            if (--pool->pendentes == 0)
+                pthread_cond_broadcast(&pool->concluido);
+            pthread_mutex_unlock(&pool->trava);
+        }
+
+        /* Só dorme se nada foi enviado desde a leitura da geração */
+        pthread_mutex_lock(&pool->trava);
+        while (pool->geracao == geracao && !pool->encerrar)
+            pthread_cond_wait(&pool->trabalho, &pool->trava);
+        pthread_mutex_unlock(&pool->trava);
+    }
+}
+
+/**
+ * @brief Distribui as tarefas entre as filas (round-robin), acorda o pool e espera todas terminarem.
+ *        A thread chamadora também executa tarefas durante a espera, como a thread 0 do pool.
+ */
+void executarTarefas(PoolTrabalho *pool, const TarefaOrdenacao tarefas[], int num_tarefas)
+{
+    pthread_mutex_lock(&pool->trava);
+    pool->pendentes += num_tarefas;
+    pthread_mutex_unlock(&pool->trava);
+
+    for (int k = 0; k < num_tarefas; k++)
+    {
+        FilaTrabalho *fila = &pool->filas[k % pool->num_threads];
+        pthread_mutex_lock(&fila->trava);
+        fila->tarefas[fila->fim++] = tarefas[k];
+        pthread_mutex_unlock(&fila->trava);
+    }
+
+    pthread_mutex_lock(&pool->trava);
+    pool->geracao++;
+    pthread_cond_broadcast(&pool->trabalho);
+    pthread_mutex_unlock(&pool->trava);
+
+    TarefaOrdenacao tarefa;
+    while (obterTarefa(pool, 0, &tarefa))
+    {
+        executarTarefa(&tarefa);
+        pthread_mutex_lock(&pool->trava);
+        if (--pool->pendentes == 0)
+            pthread_cond_broadcast(&pool->concluido);
+        pthread_mutex_unlock(&pool->trava);
+    }
+
+    pthread_mutex_lock(&pool->trava);
+    while (pool->pendentes > 0)
+        pthread_cond_wait(&pool->concluido, &pool->trava);
+    pthread_mutex_unlock(&pool->trava);
+
+    /* Filas vazias: reinicia os índices para o próximo envio */
+    for (int k = 0; k < pool->num_threads; k++)
+    {
+        pthread_mutex_lock(&pool->filas[k].trava);
+        pool->filas[k].inicio = pool->filas[k].fim = 0;
+        pthread_mutex_unlock(&pool->filas[k].trava);
+    }
+}
+
+/**
+ * @brief Encerra as threads do pool e libera seus recursos.
+ */
+void destruirPool(PoolTrabalho *pool)
+{
+    if (!pool)
+        return;
+
+    pthread_mutex_lock(&pool->trava);
+    pool->encerrar = 1;
+    pthread_cond_broadcast(&pool->trabalho);
+    pthread_mutex_unlock(&pool->trava);
+    for (int k = 1; k < pool->criadas; k++)
+        pthread_join(pool->threads[k], NULL);
+
+    for (int k = 0; k < pool->num_threads; k++)
+    {
+        free(pool->filas[k].tarefas);
+        pthread_mutex_destroy(&pool->filas[k].trava);
+    }
+    pthread_mutex_destroy(&pool->trava);
+    pthread_cond_destroy(&pool->trabalho);
+    pthread_cond_destroy(&pool->concluido);
+    free(pool);
+}
+
+/**
+ * @brief Cria o pool da ordenação paralela. A thread chamadora de shellSortParaleloPool() é a
+ *        thread 0; as demais são criadas aqui e ficam ociosas entre as ordenações, de modo que
+ *        experimentos com várias medições pagam a criação das threads uma única vez.
+ * @param num_threads Número de threads (1 a MAX_THREADS; 0 usa o perfil de ajuste ou todos os núcleos).
+ * @return Pool pronto, ou NULL em caso de erro de alocação ou criação de threads.
+ */
+PoolTrabalho *criarPool(int num_threads)
+{
+    if (num_threads <= 0)
+        num_threads = perfilAtivo.threads > 0 ? perfilAtivo.threads : numeroNucleos();
+    if (num_threads > MAX_THREADS)
+        num_threads = MAX_THREADS;
+
+    PoolTrabalho *pool = calloc(1, sizeof(PoolTrabalho));
+    if (!pool)
+        return NULL;
+
+    pool->num_threads = num_threads;
+    pool->criadas = 1;
+    pthread_mutex_init(&pool->trava, NULL);
+    pthread_cond_init(&pool->trabalho, NULL);
+    pthread_cond_init(&pool->concluido, NULL);
+    for (int k = 0; k < num_threads; k++)
+        pthread_mutex_init(&pool->filas[k].trava, NULL);
+
+    for (int k = 1; k < num_threads; k++)
+    {
+        pool->argumentos[k].pool = pool;
+        pool->argumentos[k].id = k;
+        if (pthread_create(&pool->threads[k], NULL, threadTrabalho, &pool->argumentos[k]) != 0)
+        {
+            destruirPool(pool);
+            return NULL;
+        }
+        pool->criadas++;
+    }
+    return pool;
+}
+
+/**
+ * @brief Garante filas com espaço para capacidade tarefas. Só é chamada entre ordenações,
+ *        quando as filas estão vazias e as threads do pool ociosas.
+ * @return 1 em caso de sucesso, 0 em caso de erro de alocação.
+ */
+int reservarFilasPool(PoolTrabalho *pool, int capacidade)
+{
+    for (int k = 0; k < pool->num_threads; k++)
+    {
+        FilaTrabalho *fila = &pool->filas[k];
+        if (fila->capacidade >= capacidade)
+            continue;
+        TarefaOrdenacao *tarefas = realloc(fila->tarefas, capacidade * sizeof(TarefaOrdenacao));
+        if (!tarefas)
+            return 0;
+        pthread_mutex_lock(&fila->trava);
+        fila->tarefas = tarefas;
+        fila->capacidade = capacidade;
+        pthread_mutex_unlock(&fila->trava);
+    }
+    return 1;
+}
+
+/**
+ * @brief Ordena o vetor com merge sort paralelo de baixo para cima, nas threads de um pool já criado.
+ *        O vetor é dividido em folhas que cabem na L2 (metade dela, ou o tamanho do perfil
+ *        de ajuste; ao menos uma folha por thread), ordenadas com shellSort. Em cada nível, cada par de sequências é intercalado em
+ *        segmentos independentes via merge path, de modo que todos os níveis usam todas as
+ *        threads mesmo quando restam poucas sequências. As tarefas são distribuídas em filas
+ *        por thread com roubo de trabalho para balancear folhas e segmentos desiguais.
+ * @param pool Pool criado por criarPool() (uma ordenação por vez).
+ * @param v Vetor a ser ordenado.
+ * @param tamanho Quantidade de elementos.
+ * @param roubos Ponteiro para armazenar o número de tarefas roubadas entre threads (pode ser NULL).
+ * @return 1 em caso de sucesso, 0 em caso de erro de alocação.
+ */
+int shellSortParaleloPool(PoolTrabalho *pool, int v[], int tamanho, long *roubos)
+{
+    int num_threads = pool->num_threads;
+    if (roubos)
+        *roubos = 0;
+    if (tamanho < 2)
+        return 1;
+
+    int folha = perfilAtivo.folha_paralela > 0 ? perfilAtivo.folha_paralela : (int)(tamanhoCacheL2() / 2 / sizeof(int));
+    int por_thread = (tamanho + num_threads - 1) / num_threads;
+    if (folha > por_thread)
+        folha = por_thread;
+    int num_folhas = (tamanho + folha - 1) / folha;
+
+    /* Limite de tarefas por envio: folhas no primeiro, segmentos de intercalação nos demais */
+    int max_tarefas = num_folhas + 4 * num_threads + tamanho / SEGMENTO_MINIMO + 1;
+    int *aux = malloc(tamanho * sizeof(int));
+    TarefaOrdenacao *tarefas = malloc(max_tarefas * sizeof(TarefaOrdenacao));
+
+    if (!aux || !tarefas || !reservarFilasPool(pool, max_tarefas))
+    {
+        free(aux);
+        free(tarefas);
+        return 0;
+    }
+    for (int k = 0; k < num_threads; k++)
+        pool->filas[k].roubos = 0;
+
+    for (int f = 0; f < num_folhas; f++)
+    {
+        TarefaOrdenacao t = {TAREFA_FOLHA, v, v, f * folha, 0, 0, 0, 1};
+        t.fim = t.inicio + folha < tamanho ? t.inicio + folha : tamanho;
+        tarefas[f] = t;
+    }
+    executarTarefas(pool, tarefas, num_folhas);
+
+    int *origem = v, *destino = aux;
+    for (int largura = folha; largura < tamanho; largura *= 2)
+    {
+        int num_tarefas = 0;
+        int pares = (tamanho + 2 * largura - 1) / (2 * largura);
+
+        for (int inicio = 0; inicio < tamanho; inicio += 2 * largura)
+        {
+            int meio = inicio + largura < tamanho ? inicio + largura : tamanho;
+            int fim = inicio + 2 * largura < tamanho ? inicio + 2 * largura : tamanho;
+
+            /* Segmentos suficientes para ocupar todas as threads, sem ficarem pequenos demais */
+            int partes = (2 * num_threads + pares - 1) / pares;
+            if (partes > (fim - inicio) / SEGMENTO_MINIMO)
+                partes = (fim - inicio) / SEGMENTO_MINIMO;
+            if (partes < 1)
+                partes = 1;
+
+            for (int p = 0; p < partes; p++)
+            {
+                TarefaOrdenacao t = {TAREFA_INTERCALAR, origem, destino, inicio, meio, fim, p, partes};
+                tarefas[num_tarefas++] = t;
+            }
+        }
+        executarTarefas(pool, tarefas, num_tarefas);
+
+        int *temp = origem;
+        origem = destino;
+        destino = temp;
+    }
+
+    if (origem != v)
+        memcpy(v, origem, tamanho * sizeof(int));
+
+    if (roubos)
+        for (int k = 0; k < num_threads; k++)
+            *roubos += pool->filas[k].roubos;
+    free(tarefas);
+    free(aux);
+    return 1;
+}
+
+/**
+ * @brief Ordenação paralela avulsa: cria um pool, ordena e o destrói (ver shellSortParaleloPool()).
+ *        Para medições repetidas, crie o pool uma vez com criarPool().
+ * @param v Vetor a ser ordenado.
+ * @param tamanho Quantidade de elementos.
+ * @param num_threads Número de threads (1 a MAX_THREADS; 0 usa o perfil de ajuste ou todos os núcleos).
+ * @param roubos Ponteiro para armazenar o número de tarefas roubadas entre threads (pode ser NULL).
+ * @return 1 em caso de sucesso, 0 em caso de erro de alocação ou criação de threads.
+ */
+int shellSortParalelo(int v[], int tamanho, int num_threads, long *roubos)
+{
+    if (roubos)
+        *roubos = 0;
+    if (tamanho < 2)
+        return 1;
+
+    PoolTrabalho *pool = criarPool(num_threads);
+    if (!pool)
+        return 0;
+    int ok = shellSortParaleloPool(pool, v, tamanho, roubos);
+    destruirPool(pool);
+    return ok;
+}
+
+/**
+ * @brief Mede o tempo decorrido entre dois instantes.
+ * @param inicio Instante inicial.
+ * @param fim Instante final.
+ * @return Tempo decorrido em milissegundos.
+*/
+double medirTempo(struct timespec inicio, struct timespec fim)
+{
+    return (fim.tv_sec - inicio.tv_sec) * 1000.0 +
+           (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
+}
+
+/**
+ * @brief Calcula a média dos valores do tipo double em um intervalo do vetor.
+ * @param valores Vetor de valores do tipo double.
+ * @param inicio Índice inicial do intervalo.
+ * @param fim Índice final do intervalo.
+ * @return Média dos valores no intervalo.
+ */
+double calcularMediaDouble(double valores[], int inicio, int fim)
+{
+    double soma = 0.0;
+    for (int i = inicio; i <= fim; i++)
+        soma += valores[i];
+    return soma / (fim - inicio + 1);
+}
+
+/**
+ * @brief Calcula o desvio padrão dos valores em um intervalo do vetor.
+ * @param valores Vetor de valores.
+ * @param inicio Índice inicial do intervalo.
+ * @param fim Índice final do intervalo.
+ * @param media Média dos valores no intervalo.
+ * @return Desvio padrão dos valores no intervalo.
+ */
+double calcularDesvioPadraoDouble(double valores[], int inicio, int fim, double media)
+{
+    double soma = 0.0;
+    for (int i = inicio; i <= fim; i++)
+        soma += pow(valores[i] - media, 2);
+    return sqrt(soma / (fim - inicio + 1));
+}
+
+/**
+ * @brief Calcula a média dos valores do tipo long em um intervalo do vetor.
+ * @param valores Vetor de valores do tipo long.
+ * @param inicio Índice inicial do intervalo.
+ * @param fim Índice final do intervalo.
+ * @return Média dos valores no intervalo convertida para double.
+ */
+double calcularMediaLong(long valores[], int inicio, int fim)
+{
+    long soma = 0;
+    for (int i = inicio; i <= fim; i++)
+        soma += valores[i];
+    return (double)soma / (fim - inicio + 1);
+}
+
+/**
+ * @brief Salva os resultados gerais em um arquivo CSV.
+ * @param resultados Vetor de resultados individuais.
+ * @param num_resultados Número de resultados individuais.
+ * @param estatisticas Vetor de estatísticas calculadas.
+ * @param num_estatisticas Número de estatísticas calculadas.
+ * @return void
+ */
+void salvarCSVGeral(ResultadoCSV resultados[], int num_resultados, Estatisticas estatisticas[], int num_estatisticas)
+{
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/shellSort/shellsort_geral_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV.\n");
+        return;
+    }
+    ambienteCabecalho(csv);
+    for (int i = 0; i < num_estatisticas; i++)
+        cacheCabecalhoReaproveitada(csv, "Shell Sort", estatisticas[i].cenario, estatisticas[i].tamanho,
+                                    estatisticas[i].origem_cache);
+
+    fprintf(csv, "algoritmo;cenario;tamanho;repeticao;tempo_ms;comparacoes;trocas;variante\n");
+
+    for (int i = 0; i < num_resultados; i++)
+    {
+        fprintf(csv, "%s;%s;%d;%d;%.3f;%ld;%ld;%s\n",
+                resultados[i].algoritmo, resultados[i].cenario,
+                resultados[i].tamanho, resultados[i].repeticao,
+                resultados[i].tempo, resultados[i].comparacoes,
+                resultados[i].trocas, resultados[i].variante);
+    }
+
+    fprintf(csv, "\nESTATISTICAS (descartadas as %d primeiras repeticoes)\n", QTD_DESCARTES);
+    fprintf(csv, "algoritmo;cenario;tamanho;media_tempo_ms;desvio_tempo_ms;media_comparacoes;media_trocas;variante\n");
+
+    for (int i = 0; i < num_estatisticas; i++)
+    {
+        fprintf(csv, "Shell Sort;%s;%d;%.3f;%.3f;%.2f;%.2f;%s\n",
+                estatisticas[i].cenario, estatisticas[i].tamanho,
+                estatisticas[i].media_tempo, estatisticas[i].desvio_tempo,
+                estatisticas[i].media_comparacoes, estatisticas[i].media_trocas,
+                nomesVariantes[varianteAtiva]);
+    }
+
+    fclose(csv);
+    printf("\nCSV geral salvo em: %s\n", nomeCSV);
+}
+
+/**
+ * @brief Salva o perfil por passo (gap) de todas as execuções em um arquivo CSV separado.
+ * @param passos Vetor de perfis por passo.
+ * @param num_passos Número de perfis registrados.
+ * @return void
+ */
+void salvarCSVPassos(ResultadoPassoCSV passos[], int num_passos)
+{
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/shellSort/shellsort_passos_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV de passos.\n");
+        return;
+    }
+    ambienteCabecalho(csv);
+
+    fprintf(csv, "algoritmo;cenario;tamanho;repeticao;passo;h;comparacoes;trocas;ciclos;variante\n");
+
+    for (int i = 0; i < num_passos; i++)
+    {
+        fprintf(csv, "Shell Sort;%s;%d;%d;%d;%d;%ld;%ld;%llu;%s\n",
+                passos[i].cenario, passos[i].tamanho, passos[i].repeticao,
+                passos[i].passo, passos[i].perfil.h,
+                passos[i].perfil.comparacoes, passos[i].perfil.trocas,
+                passos[i].perfil.ciclos, nomesVariantes[varianteAtiva]);
+    }
+
+    fclose(csv);
+    printf("CSV de passos salvo em: %s\n", nomeCSV);
+}
+
+/**
+ * @brief Salva os resultados detalhados de um experimento em um arquivo TXT.
+ * @param tipo Tipo de vetor (crescente, decrescente, aleatório).
+ * @param tamanho Tamanho do vetor.
+ * @param tempos Vetor de tempos de execução.
+ * @param comparacoes Vetor de números de comparações.
+ * @param trocas Vetor de números de trocas.
+ * @param mediaTempo Média dos tempos de execução.
+ * @param desvioTempo Desvio padrão dos tempos de execução.
+ * @param mediaComparacoes Média dos números de comparações.
+ * @param mediaTrocas Média dos números de trocas.
+ * @param origem_cache Ambiente da medição, se reaproveitada do cache (NULL ou "" se medida agora).
+ * @return void
+ */
+void salvarResultados(char tipo[], int tamanho, double tempos[], long comparacoes[], long trocas[],
+                      double mediaTempo, double desvioTempo, double mediaComparacoes, double mediaTrocas,
+                      const char *origem_cache)
+{
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeArquivo[150];
+
+    sprintf(nomeArquivo, "../results/files/shellSort/shellsort_%s_%d_%02d-%02d-%04d_%02d-%02d-%02d.txt",
+            tipo, tamanho, info->tm_mday, info->tm_mon + 1,
+            info->tm_year + 1900, info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *arquivo = fopen(nomeArquivo, "w");
+    if (!arquivo)
+    {
+        printf("Erro ao criar o arquivo TXT.\n");
+        return;
+    }
+    ambienteCabecalho(arquivo);
+    cacheCabecalhoReaproveitada(arquivo, "Shell Sort", tipo, tamanho, origem_cache);
+
+    fprintf(arquivo, "============================================================\n");
+    fprintf(arquivo, "                         SHELL SORT                          \n");
+    fprintf(arquivo, "============================================================\n\n");
+    fprintf(arquivo, "Configuracoes do experimento:\n");
+    fprintf(arquivo, "------------------------------------------------------------\n");
+    fprintf(arquivo, "Tamanho do vetor : %d\n", tamanho);
+    fprintf(arquivo, "Repeticoes       : %d (descartadas %d primeiras)\n", REPETICOES, QTD_DESCARTES);
+    fprintf(arquivo, "Repeticoes validas: %d\n", REPETICOES - QTD_DESCARTES);
+    fprintf(arquivo, "Tipo de vetor    : %s\n", tipo);
+    fprintf(arquivo, "Variante         : %s\n", nomesVariantes[varianteAtiva]);
+    fprintf(arquivo, "Sequencia de gaps: %s\n\n", nomesSequencias[perfilAtivo.sequencia_gaps]);
+    fprintf(arquivo, "Resultados individuais:\n");
+    fprintf(arquivo, "------------------------------------------------------------\n");
+
+    for (int i = 0; i < REPETICOES; i++)
+    {
+        fprintf(arquivo, "Execucao %2d", i + 1);
+        if (i < QTD_DESCARTES)
+        {
+            fprintf(arquivo, " (DESCARTADA)");
+        }
+        fprintf(arquivo, "\n");
+        fprintf(arquivo, "  Tempo        : %8.3f ms\n", tempos[i]);
+        fprintf(arquivo, "  Comparacoes  : %8ld\n", comparacoes[i]);
+        fprintf(arquivo, "  Trocas       : %8ld\n\n", trocas[i]);
+    }
+
+    fprintf(arquivo, "Resumo estatistico (descartadas %d primeiras execucoes):\n", QTD_DESCARTES);
+    fprintf(arquivo, "------------------------------------------------------------\n");
+    fprintf(arquivo, "Tempo medio           : %.3f ms\n", mediaTempo);
+    fprintf(arquivo, "Desvio padrao (tempo) : %.3f ms\n\n", desvioTempo);
+    fprintf(arquivo, "Media de comparacoes  : %.2f\n", mediaComparacoes);
+    fprintf(arquivo, "Media de trocas       : %.2f\n", mediaTrocas);
+    fprintf(arquivo, "\n============================================================\n");
+
+    fclose(arquivo);
+    printf("  TXT salvo: %s\n", nomeArquivo);
+}
+
+/**
+ * @brief Executa o teste geral com todos os cenários e tamanhos.
+ * @return void
+ */
+void executarTesteGeral()
+{
+    int tamanhos[] = {20000, 40000, 60000};
+    char *nomes_cenarios[] = {"crescente", "decrescente", "aleatorio"};
+    int tipos_cenarios[] = {1, 2, 3};
+
+    const int TOTAL_COMBINACOES = 3 * 3;
+    const int TOTAL_EXECUCOES = TOTAL_COMBINACOES * REPETICOES;
+
+    ResultadoCSV *resultados = malloc(TOTAL_EXECUCOES * sizeof(ResultadoCSV));
+    Estatisticas *estatisticas = malloc(TOTAL_COMBINACOES * sizeof(Estatisticas));
+    ResultadoPassoCSV *resultados_passos = malloc(TOTAL_EXECUCOES * MAX_PASSOS * sizeof(ResultadoPassoCSV));
+
+    if (!resultados || !estatisticas || !resultados_passos)
+    {
+        printf("Erro ao alocar memoria!\n");
+        free(resultados);
+        free(estatisticas);
+        free(resultados_passos);
+        return;
+    }
+
+    int idx_resultado = 0;
+    int idx_estatistica = 0;
+    int idx_passo = 0;
+    char perfil[160];
+    descreverPerfil(perfil, sizeof(perfil));
+
+    printf("\n========================================\n");
+    printf("        INICIANDO TESTE GERAL           \n");
+    printf("========================================\n\n");
+
+    for (int t = 0; t < 3; t++)
+    {
+        int tamanho = tamanhos[t];
+
+        for (int c = 0; c < 3; c++)
+        {
+            printf("\n[CENARIO: %s | TAMANHO: %d]\n", nomes_cenarios[c], tamanho);
+            telemetriaExperimento(1, "Shell Sort", nomes_cenarios[c], tamanho);
+            printf("Executando %d repeticoes (serao descartadas %d)...\n", REPETICOES, QTD_DESCARTES);
+
+            /* Cada célula usa uma semente fixa, num gerador local (o rand() global fica intacto):
+               entradas reproduzíveis, condição para reaproveitar o cache.
+               O perfil entra na chave: shellSortPerfilado() usa a sequência de gaps dele */
+            MedicaoTesteGeral medicao;
+            CelulaCache celula = {nomesVariantes[varianteAtiva], "Shell Sort", nomes_cenarios[c], tamanho,
+                                  TESTE_GERAL_SEMENTE + 1000u * tipos_cenarios[c] + (unsigned int)tamanho,
+                                  REPETICOES, QTD_DESCARTES, perfil};
+            char ambiente_cache[CACHE_AMBIENTE] = "";
+            int do_cache = cacheCarregar(&celula, &medicao, sizeof(medicao), ambiente_cache);
+            double *tempos = medicao.tempos;
+            long *comparacoes = medicao.comparacoes;
+            long *trocas = medicao.trocas;
+
+            if (do_cache)
+            {
+                printf("  Reaproveitado do cache de resultados (mesmo build, CPU, governador, turbo, semente, repeticoes e perfil).\n");
+                printf("  Medido em: %s\n", ambiente_cache);
+            }
+            else
+                memset(&medicao, 0, sizeof(medicao));
+            uint32_t estado_celula = iniciarGerador(celula.semente);
+
+            for (int r = 0; r < REPETICOES && !do_cache; r++)
+            {
+                int *vetor = malloc(tamanho * sizeof(int));
+                if (!vetor)
+                {
+                    printf("Erro ao alocar vetor!\n");
+                    break;
+                }
+
+                gerarVetorComEstado(vetor, tipos_cenarios[c], tamanho, &estado_celula);
+                ImpressaoVetor impressao = impressaoVetor(vetor, tamanho);
+
+                struct timespec inicio, fim;
+                clock_gettime(CLOCK_MONOTONIC, &inicio);
+                shellSortPerfilado(vetor, tamanho, &comparacoes[r], &trocas[r], medicao.passos[r],
+                                   &medicao.num_passos[r]);
+                clock_gettime(CLOCK_MONOTONIC, &fim);
+
+                tempos[r] = medirTempo(inicio, fim);
+                verificarOrdenacao(&impressao, vetor, tamanho, "Shell Sort", nomes_cenarios[c], r + 1);
+                telemetriaRepeticao("Shell Sort", nomes_cenarios[c], tamanho, r + 1, tempos[r],
+                                    comparacoes[r], trocas[r], nomesVariantes[varianteAtiva]);
+
+                if ((r + 1) % 5 == 0)
+                    printf("  Completadas: %d/%d\n", r + 1, REPETICOES);
+
+                free(vetor);
+
+                if (r == REPETICOES - 1)
+                    cacheSalvar(&celula, &medicao, sizeof(medicao));
+            }
+
+            for (int r = 0; r < REPETICOES; r++)
+            {
+                for (int p = 0; p < medicao.num_passos[r]; p++)
+                {
+                    strcpy(resultados_passos[idx_passo].cenario, nomes_cenarios[c]);
+                    resultados_passos[idx_passo].tamanho = tamanho;
+                    resultados_passos[idx_passo].repeticao = r + 1;
+                    resultados_passos[idx_passo].passo = p + 1;
+                    resultados_passos[idx_passo].perfil = medicao.passos[r][p];
+                    idx_passo++;
+                }
+
+                strcpy(resultados[idx_resultado].algoritmo, "Shell Sort");
+                strcpy(resultados[idx_resultado].variante, nomesVariantes[varianteAtiva]);
+                strcpy(resultados[idx_resultado].cenario, nomes_cenarios[c]);
+                resultados[idx_resultado].tamanho = tamanho;
+                resultados[idx_resultado].repeticao = r + 1;
+                resultados[idx_resultado].tempo = tempos[r];
+                resultados[idx_resultado].comparacoes = comparacoes[r];
+                resultados[idx_resultado].trocas = trocas[r];
+                idx_resultado++;
+            }
+
+            // Calcular estatísticas descartando as primeiras QTD_DESCARTES repetições
+            int inicio_estat = QTD_DESCARTES;
+            int fim_estat = REPETICOES - 1;
+            int repeticoes_validas = REPETICOES - QTD_DESCARTES;
+
+            if (repeticoes_validas > 0)
+            {
+                double media_tempo = calcularMediaDouble(tempos, inicio_estat, fim_estat);
+                double desvio_tempo = calcularDesvioPadraoDouble(tempos, inicio_estat, fim_estat, media_tempo);
+                double media_comparacoes = calcularMediaLong(comparacoes, inicio_estat, fim_estat);
+                double media_trocas = calcularMediaLong(trocas, inicio_estat, fim_estat);
+
+                strcpy(estatisticas[idx_estatistica].cenario, nomes_cenarios[c]);
+                estatisticas[idx_estatistica].tamanho = tamanho;
+                estatisticas[idx_estatistica].media_tempo = media_tempo;
+                estatisticas[idx_estatistica].desvio_tempo = desvio_tempo;
+                estatisticas[idx_estatistica].media_comparacoes = media_comparacoes;
+                estatisticas[idx_estatistica].media_trocas = media_trocas;
+                snprintf(estatisticas[idx_estatistica].origem_cache, CACHE_AMBIENTE, "%s",
+                         do_cache ? ambiente_cache : "");
+                idx_estatistica++;
+
+                salvarResultados(nomes_cenarios[c], tamanho,
+                                 tempos,
+                                 comparacoes,
+                                 trocas,
+                                 media_tempo, desvio_tempo,
+                                 media_comparacoes, media_trocas,
+                                 estatisticas[idx_estatistica - 1].origem_cache);
+
+                printf("  Concluido! Media: %.2f ms (apos descarte de %d execucoes)\n",
+                       media_tempo, QTD_DESCARTES);
+            }
+            else
+            {
+                printf("  Erro: Nenhuma repeticao valida apos descarte!\n");
+            }
+            telemetriaExperimento(0, "Shell Sort", nomes_cenarios[c], tamanho);
+        }
+    }
+
+    salvarCSVGeral(resultados, idx_resultado, estatisticas, idx_estatistica);
+    salvarCSVPassos(resultados_passos, idx_passo);
+
+    free(resultados);
+    free(estatisticas);
+    free(resultados_passos);
+
+    printf("\n========================================\n");
+    printf("     TESTE GERAL CONCLUIDO!             \n");
+    printf("========================================\n");
+    pausar();
+}
+
+/**
+ * @brief Executa o experimento para um tamanho fixo de vetor.
+ * @param tipo Tipo de vetor: 1 - crescente, 2 - decrescente, 3 - aleatório.
+ * @param tempos Vetor para armazenar os tempos de execução.
+ * @param comparacoes Vetor para armazenar o número de comparações.
+ * @param trocas Vetor para armazenar o número de trocas.
+ * @param tamanho Tamanho do vetor.
+ * @return void
+ */
+void executarExperimentoTamanhoFixo(int tipo, double tempos[], long comparacoes[], long trocas[], int tamanho)
+{
+    int *vetor = malloc(tamanho * sizeof(int));
+    struct timespec inicio, fim;
+    char *cenario = tipo == 1 ? "crescente" : (tipo == 2 ? "decrescente" : "aleatorio");
+
+    telemetriaExperimento(1, "Shell Sort", cenario, tamanho);
+    for (int i = 0; i < REPETICOES; i++)
+    {
+        gerarVetor(vetor, tipo, tamanho);
+        ImpressaoVetor impressao = impressaoVetor(vetor, tamanho);
+
+        printf("=====================================\n");
+        printf(" Execução %d", i + 1);
+        if (i < QTD_DESCARTES)
+        {
+            printf(" (SERA DESCARTADA)");
+        }
+        printf("\n");
+        printf("=====================================\n");
+
+        printf("Vetor antes da ordenação:\n");
+        imprimirVetor(vetor, tamanho);
+
+        clock_gettime(CLOCK_MONOTONIC, &inicio);
+        shellSort(vetor, tamanho, &comparacoes[i], &trocas[i]);
+        clock_gettime(CLOCK_MONOTONIC, &fim);
+
+        tempos[i] = medirTempo(inicio, fim);
+        verificarOrdenacao(&impressao, vetor, tamanho, "Shell Sort", cenario, i + 1);
+        telemetriaRepeticao("Shell Sort", cenario, tamanho, i + 1, tempos[i], comparacoes[i], trocas[i],
+                            nomesVariantes[varianteAtiva]);
+
+        printf("\nVetor após a ordenação:\n");
+        imprimirVetor(vetor, tamanho);
+    }
+    telemetriaExperimento(0, "Shell Sort", cenario, tamanho);
+
+    free(vetor);
+}
+
+/**
+ * @brief Processa e salva os resultados do experimento.
+ * @param opcao Tipo de vetor: 1 - crescente, 2 - decrescente, 3 - aleatório.
+ * @param tempos Vetor para armazenar os tempos de execução.
+ * @param comparacoes Vetor para armazenar o número de comparações.
+ * @param trocas Vetor para armazenar o número de trocas.
+ * @return void
+ */
+void processarResultados(int opcao, double tempos[], long comparacoes[], long trocas[])
+{
+    // Calcular estatísticas descartando as primeiras QTD_DESCARTES repetições
+    int inicio_estat = QTD_DESCARTES;
+    int fim_estat = REPETICOES - 1;
+    int repeticoes_validas = REPETICOES - QTD_DESCARTES;
+
+    if (repeticoes_validas <= 0)
+    {
+        printf("Erro: Nenhuma repeticao valida apos descarte!\n");
+        pausar();
+        return;
+    }
+
+    double media = calcularMediaDouble(tempos, inicio_estat, fim_estat);
+    double desvio = calcularDesvioPadraoDouble(tempos, inicio_estat, fim_estat, media);
+    double mediaComparacoes = calcularMediaLong(comparacoes, inicio_estat, fim_estat);
+    double mediaTrocas = calcularMediaLong(trocas, inicio_estat, fim_estat);
+
+    char *tipo;
+    if (opcao == 1)
+        tipo = "crescente";
+    else if (opcao == 2)
+        tipo = "decrescente";
+    else
+        tipo = "aleatorio";
+
+    salvarResultados(tipo, TAM_VETOR, tempos, comparacoes, trocas,
+                     media, desvio, mediaComparacoes, mediaTrocas, NULL);
+
+    printf("\nResultados salvos com sucesso!\n");
+    printf("Estatisticas calculadas com %d repeticoes validas (descartadas %d primeiras)\n",
+           repeticoes_validas, QTD_DESCARTES);
+    pausar();
+}
+
+/**
+ * @brief Verifica se todos os vetores de um lote estão em ordem crescente.
+ * @param dados Vetores armazenados de forma contígua.
+ * @param num_vetores Quantidade de vetores no lote.
+ * @param tamanho Tamanho de cada vetor.
+ * @return 1 se todos estiverem ordenados, 0 caso contrário.
+ */
+int loteOrdenado(int dados[], int num_vetores, int tamanho)
+{
+    for (int k = 0; k < num_vetores; k++)
+    {
+        int *v = dados + (size_t)k * tamanho;
+        for (int i = 1; i < tamanho; i++)
+            if (v[i - 1] > v[i])
+                return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Executa o benchmark de ordenação em lote de vetores pequenos.
+ *        Compara, para cada tamanho de vetor e de lote, uma chamada de shellSort() por vetor,
+ *        o lote escalar e os lotes vetorizados, reportando vetores ordenados por segundo.
+ * @return void
+ */
+void executarBenchmarkLote()
+{
+    int tamanhos_vetor[] = {16, 64, 256, 512};
+    int tamanhos_lote[] = {256, 4096, 32768};
+    const char *metodos[] = {"shellSort por vetor", "lote escalar", "lote AVX2", "lote AVX-512"};
+    const int NUM_METODOS = 4;
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/shellSort/shellsort_lote_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do benchmark de lote.\n");
+        pausar();
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "metodo;tamanho_vetor;num_vetores;media_tempo_ms;vetores_por_segundo\n");
+
+    printf("\n========================================\n");
+    printf("     BENCHMARK DE LOTE (VETORES PEQUENOS)\n");
+    printf("========================================\n");
+    printf("%-20s %8s %8s %12s %16s\n", "metodo", "tamanho", "vetores", "tempo (ms)", "vetores/s");
+
+    for (int t = 0; t < 4; t++)
+    {
+        for (int b = 0; b < 3; b++)
+        {
+            int tamanho = tamanhos_vetor[t];
+            int num_vetores = tamanhos_lote[b];
+            size_t total = (size_t)tamanho * num_vetores;
+
+            int *original = malloc(total * sizeof(int));
+            int *dados = malloc(total * sizeof(int));
+            if (!original || !dados)
+            {
+                printf("Erro ao alocar memoria!\n");
+                free(original);
+                free(dados);
+                fclose(csv);
+                pausar();
+                return;
+            }
+
+            for (int k = 0; k < num_vetores; k++)
+                gerarVetor(original + (size_t)k * tamanho, 3, tamanho);
+
+            for (int m = 0; m < NUM_METODOS; m++)
+            {
+#ifdef SIMD_X86
+                if ((m == 2 && !__builtin_cpu_supports("avx2")) || (m == 3 && !__builtin_cpu_supports("avx512f")))
+                    continue;
+#else
+                if (m >= 2)
+                    continue;
+#endif
+                double soma = 0.0;
+                int correto = 1;
+
+                for (int r = 0; r <= LOTE_REPETICOES; r++)
+                {
+                    memcpy(dados, original, total * sizeof(int));
+
+                    struct timespec inicio, fim;
+                    clock_gettime(CLOCK_MONOTONIC, &inicio);
+                    if (m == 0)
+                    {
+                        long comparacoes, trocas;
+                        for (int k = 0; k < num_vetores; k++)
+                            shellSort(dados + (size_t)k * tamanho, tamanho, &comparacoes, &trocas);
+                    }
+                    else if (m == 1)
+                        shellSortLoteEscalar(dados, num_vetores, tamanho);
+#ifdef SIMD_X86
+                    else if (m == 2)
+                        shellSortLoteEscalar(dados + (size_t)shellSortLoteAVX2(dados, num_vetores, tamanho) * tamanho,
+                                             num_vetores % 8, tamanho);
+                    else
+                        shellSortLoteEscalar(dados + (size_t)shellSortLoteAVX512(dados, num_vetores, tamanho) * tamanho,
+                                             num_vetores % 16, tamanho);
+#endif
+                    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+                    /* A primeira execução é descartada (warm-up) */
+                    if (r > 0)
+                        soma += medirTempo(inicio, fim);
+                    correto = correto && loteOrdenado(dados, num_vetores, tamanho);
+                }
+
+                double media = soma / LOTE_REPETICOES;
+                double vetores_por_segundo = num_vetores / (media / 1000.0);
+
+                printf("%-20s %8d %8d %12.3f %16.0f%s\n", metodos[m], tamanho, num_vetores,
+                       media, vetores_por_segundo, correto ? "" : "  ERRO: lote nao ordenado!");
+                fprintf(csv, "%s;%d;%d;%.3f;%.0f\n", metodos[m], tamanho, num_vetores, media, vetores_por_segundo);
+            }
+
+            free(original);
+            free(dados);
+        }
+    }
+
+    fclose(csv);
+    printf("\nCSV do benchmark de lote salvo em: %s\n", nomeCSV);
+    pausar();
+}
+
+/**
+ * @brief Executa o micro-benchmark das redes de ordenação para tamanhos fixos.
+ *        Para cada tamanho coberto pelas redes, compara shellSort() (inserção com desvios),
+ *        a rede escalar (ordenarFixo) e as redes AVX2/AVX-512 sobre vetores intercalados.
+ * @return void
+ */
+void executarBenchmarkRedes()
+{
+    const char *metodos[] = {"shellSort", "rede escalar", "rede AVX2", "rede AVX-512"};
+    const int NUM_METODOS = 4;
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/shellSort/shellsort_redes_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    int *original = malloc((size_t)REDES_VETORES * REDE_TAM_MAX * sizeof(int));
+    int *dados = malloc((size_t)REDES_VETORES * REDE_TAM_MAX * sizeof(int));
+    if (!csv || !original || !dados)
     {
-        fprintf(csv, "Shell Sort;%s;%d;%.3f;%.3f;%.2f;%.2f\n",
-                estatisticas[i].cenario, estatisticas[i].tamanho,
-                estatisticas[i].media_tempo, estatisticas[i].desvio_tempo,
-                estatisticas[i].media_comparacoes, estatisticas[i].media_trocas);
+        printf("Erro ao preparar o micro-benchmark de redes.\n");
+        if (csv)
+            fclose(csv);
+        free(original);
+        free(dados);
+        pausar();
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "metodo;tamanho_vetor;comparadores_rede;ns_por_vetor;aceleracao\n");
+
+    printf("\n========================================\n");
+    printf("   MICRO-BENCHMARK DE REDES DE ORDENACAO\n");
+    printf("========================================\n");
+    printf("%d vetores aleatorios por medicao, media de %d repeticoes\n\n", REDES_VETORES, LOTE_REPETICOES);
+    printf("%-14s %8s %12s %14s %10s\n", "metodo", "tamanho", "comparadores", "ns por vetor", "aceleracao");
+
+    for (int tamanho = REDE_TAM_MIN; tamanho <= REDE_TAM_MAX; tamanho++)
+    {
+        size_t total = (size_t)REDES_VETORES * tamanho;
+        double ns_referencia = 0.0;
+
+        for (int k = 0; k < REDES_VETORES; k++)
+            for (int i = 0; i < tamanho; i++)
+                original[(size_t)k * tamanho + i] = rand() % TAM_MAX;
+
+        for (int m = 0; m < NUM_METODOS; m++)
+        {
+#ifdef SIMD_X86
+            if ((m == 2 && !__builtin_cpu_supports("avx2")) || (m == 3 && !__builtin_cpu_supports("avx512f")))
+                continue;
+#else
+            if (m >= 2)
+                continue;
+#endif
+            double soma = 0.0;
+            int correto = 1;
+
+            for (int r = 0; r <= LOTE_REPETICOES; r++)
+            {
+                memcpy(dados, original, total * sizeof(int));
+
+                struct timespec inicio, fim;
+                clock_gettime(CLOCK_MONOTONIC, &inicio);
+                if (m == 0)
+                {
+                    long comparacoes, trocas;
+                    for (int k = 0; k < REDES_VETORES; k++)
+                        shellSort(dados + (size_t)k * tamanho, tamanho, &comparacoes, &trocas);
+                }
+                else if (m == 1)
+                {
+                    for (int k = 0; k < REDES_VETORES; k++)
+                        ordenarFixo(dados + (size_t)k * tamanho, tamanho);
+                }
+#ifdef SIMD_X86
+                else if (m == 2)
+                    shellSortLoteAVX2(dados, REDES_VETORES, tamanho);
+                else
+                    shellSortLoteAVX512(dados, REDES_VETORES, tamanho);
+#endif
+                clock_gettime(CLOCK_MONOTONIC, &fim);
+
+                if (r > 0)
+                    soma += medirTempo(inicio, fim);
+                correto = correto && loteOrdenado(dados, REDES_VETORES, tamanho);
+            }
+
+            double ns_por_vetor = soma / LOTE_REPETICOES * 1e6 / REDES_VETORES;
+            if (m == 0)
+                ns_referencia = ns_por_vetor;
+            double aceleracao = ns_referencia / ns_por_vetor;
+
+            printf("%-14s %8d %12d %14.1f %9.2fx%s\n", metodos[m], tamanho, redesComparadores[tamanho],
+                   ns_por_vetor, aceleracao, correto ? "" : "  ERRO: vetor nao ordenado!");
+            fprintf(csv, "%s;%d;%d;%.2f;%.3f\n", metodos[m], tamanho, redesComparadores[tamanho],
+                    ns_por_vetor, aceleracao);
+        }
+    }
+
+    fclose(csv);
+    free(original);
+    free(dados);
+    printf("\nCSV do micro-benchmark de redes salvo em: %s\n", nomeCSV);
+    pausar();
+}
+
+/**
+ * @brief Executa o benchmark de ordenação de registros grandes (64 a 256 bytes).
+ *        Compara o Shell Sort direto sobre os registros com a ordenação indireta
+ *        (índices ou pares chave+índice) seguida de aplicarPermutacao().
+ * @return void
+ */
+void executarBenchmarkRegistros()
+{
+    int tamanhos[] = {20000, 40000, 60000};
+    size_t tamanhos_registro[] = {64, 128, 256};
+    const char *metodos[] = {"direto", "indices + permutacao", "pares + permutacao"};
+    const int NUM_METODOS = 3;
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/shellSort/shellsort_registros_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do benchmark de registros.\n");
+        pausar();
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "metodo;tamanho;tam_registro;media_tempo_ms;registros_escritos\n");
+
+    printf("\n========================================\n");
+    printf("  BENCHMARK DE REGISTROS (ORDENACAO INDIRETA)\n");
+    printf("========================================\n");
+    printf("%-22s %8s %9s %12s %20s\n", "metodo", "tamanho", "registro", "tempo (ms)", "registros escritos");
+
+    for (int t = 0; t < 3; t++)
+    {
+        for (int b = 0; b < 3; b++)
+        {
+            int tamanho = tamanhos[t];
+            size_t tam_registro = tamanhos_registro[b];
+
+            char *original = malloc((size_t)tamanho * tam_registro);
+            char *registros = malloc((size_t)tamanho * tam_registro);
+            int *chaves = malloc(tamanho * sizeof(int));
+            int *indices = malloc(tamanho * sizeof(int));
+            ParChaveIndice *pares = malloc(tamanho * sizeof(ParChaveIndice));
+
+            if (!original || !registros || !chaves || !indices || !pares)
+            {
+                printf("Erro ao alocar memoria!\n");
+                free(original);
+                free(registros);
+                free(chaves);
+                free(indices);
+                free(pares);
+                fclose(csv);
+                pausar();
+                return;
+            }
+
+            gerarVetor(chaves, 3, tamanho);
+            preencherRegistros(original, tam_registro, chaves, tamanho);
+
+            for (int m = 0; m < NUM_METODOS; m++)
+            {
+                double soma = 0.0;
+                long escritas = 0;
+                int correto = 1;
+
+                for (int r = 0; r <= LOTE_REPETICOES; r++)
+                {
+                    long comparacoes, trocas;
+                    memcpy(registros, original, (size_t)tamanho * tam_registro);
+
+                    struct timespec inicio, fim;
+                    clock_gettime(CLOCK_MONOTONIC, &inicio);
+                    if (m == 0)
+                    {
+                        shellSortRegistros(registros, tam_registro, tamanho, &comparacoes, &trocas);
+                        /* Deslocamentos + a escrita final de cada inserção em todos os passos */
+                        escritas = trocas;
+                        for (int h = gapInicialKnuth(tamanho); h >= 1; h = (h - 1) / 3)
+                            escritas += tamanho - h;
+                    }
+                    else
+                    {
+                        /* A extração das chaves faz parte do custo da ordenação indireta */
+                        if (m == 1)
+                        {
+                            for (int i = 0; i < tamanho; i++)
+                                chaves[i] = CHAVE_REGISTRO(registros, tam_registro, i);
+                            shellSortIndices(chaves, indices, tamanho, &comparacoes, &trocas);
+                        }
+                        else
+                        {
+                            for (int i = 0; i < tamanho; i++)
+                            {
+                                pares[i].chave = CHAVE_REGISTRO(registros, tam_registro, i);
+                                pares[i].indice = i;
+                            }
+                            shellSortPares(pares, tamanho, &comparacoes, &trocas);
+                            for (int i = 0; i < tamanho; i++)
+                                indices[i] = pares[i].indice;
+                        }
+                        escritas = aplicarPermutacao(registros, tam_registro, indices, tamanho);
+                    }
+                    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+                    if (escritas < 0)
+                        break;
+
+                    if (r > 0)
+                        soma += medirTempo(inicio, fim);
+                    correto = correto && registrosCorretos(registros, tam_registro, tamanho);
+                }
+
+                if (escritas < 0)
+                {
+                    printf("%-22s %8d %7zu B  ERRO: falha de alocacao na ordenacao indireta!\n", metodos[m], tamanho,
+                           tam_registro);
+                    continue;
+                }
+
+                double media = soma / LOTE_REPETICOES;
+                printf("%-22s %8d %7zu B %12.3f %20ld%s\n", metodos[m], tamanho, tam_registro, media, escritas,
+                       correto ? "" : "  ERRO: registros incorretos!");
+                fprintf(csv, "%s;%d;%zu;%.3f;%ld\n", metodos[m], tamanho, tam_registro, media, escritas);
+            }
+
+            free(original);
+            free(registros);
+            free(chaves);
+            free(indices);
+            free(pares);
+        }
+    }
+
+    fclose(csv);
+    printf("\nCSV do benchmark de registros salvo em: %s\n", nomeCSV);
+    pausar();
+}
+
+/**
+ * @brief Valor esperado do byte b da coluna c de carga associada a uma chave (usado na verificação).
+ */
+#define BYTE_CARGA(chave, c, b) ((char)((chave) + (c) * 31 + (int)(b)))
+
+/**
+ * @brief Confere se as chaves estão ordenadas e se cada linha das colunas de carga acompanha sua chave.
+ * @param chaves Vetor de chaves.
+ * @param tamanho Quantidade de elementos.
+ * @param colunas Colunas de carga.
+ * @param num_colunas Número de colunas.
+ * @return 1 se estiverem corretas, 0 caso contrário.
+ */
+int colunasCorretas(const int chaves[], int tamanho, const ColunaCarga colunas[], int num_colunas)
+{
+    for (int i = 0; i < tamanho; i++)
+    {
+        if (i > 0 && chaves[i - 1] > chaves[i])
+            return 0;
+        for (int c = 0; c < num_colunas; c++)
+        {
+            const char *elem = (const char *)colunas[c].dados + (size_t)i * colunas[c].largura;
+            for (size_t b = 0; b < colunas[c].largura; b++)
+                if (elem[b] != BYTE_CARGA(chaves[i], c, b))
+                    return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Executa o benchmark de ordenação AoS contra SoA para diferentes larguras de carga.
+ *        Métodos: registros AoS ordenados diretamente; tabela SoA convertida para AoS,
+ *        ordenada e convertida de volta; e os dois modos de shellSortSoA().
+ * @return void
+ */
+void executarBenchmarkSoA()
+{
+    int tamanhos[] = {60000, 250000};
+    size_t larguras_carga[] = {4, 16, 64, 256};
+    const char *metodos[] = {"AoS direto", "SoA->AoS->SoA", "SoA junto", "SoA passo final"};
+    const int NUM_METODOS = 4;
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/shellSort/shellsort_soa_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do benchmark SoA.\n");
+        pausar();
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "metodo;tamanho;largura_carga;num_colunas;media_tempo_ms\n");
+
+    printf("\n========================================\n");
+    printf("      BENCHMARK AoS x SoA (CHAVE + CARGA)\n");
+    printf("========================================\n");
+    printf("%-16s %8s %8s %8s %12s\n", "metodo", "tamanho", "carga", "colunas", "tempo (ms)");
+
+    for (int t = 0; t < 2; t++)
+    {
+        for (int l = 0; l < 4; l++)
+        {
+            int tamanho = tamanhos[t];
+            size_t largura = larguras_carga[l];
+            int num_colunas = largura >= 16 ? 4 : 1;
+            size_t largura_coluna = largura / num_colunas;
+            size_t tam_registro = sizeof(int) + largura;
+
+            int *chaves_originais = malloc(tamanho * sizeof(int));
+            int *chaves = malloc(tamanho * sizeof(int));
+            char *registros = malloc((size_t)tamanho * tam_registro);
+            ColunaCarga originais[MAX_COLUNAS], colunas[MAX_COLUNAS];
+            int alocado = chaves_originais && chaves && registros;
+
+            for (int c = 0; c < num_colunas; c++)
+            {
+                originais[c].largura = colunas[c].largura = largura_coluna;
+                originais[c].dados = malloc((size_t)tamanho * largura_coluna);
+                colunas[c].dados = malloc((size_t)tamanho * largura_coluna);
+                alocado = alocado && originais[c].dados && colunas[c].dados;
+            }
+
+            if (alocado)
+            {
+                gerarVetor(chaves_originais, 3, tamanho);
+                for (int c = 0; c < num_colunas; c++)
+                    for (int i = 0; i < tamanho; i++)
+                        for (size_t b = 0; b < largura_coluna; b++)
+                            ((char *)originais[c].dados)[(size_t)i * largura_coluna + b] = BYTE_CARGA(chaves_originais[i], c, b);
+            }
+
+            for (int m = 0; m < NUM_METODOS && alocado; m++)
+            {
+                double soma = 0.0;
+                int correto = 1;
+
+                for (int r = 0; r <= LOTE_REPETICOES; r++)
+                {
+                    long comparacoes, trocas;
+                    memcpy(chaves, chaves_originais, tamanho * sizeof(int));
+                    for (int c = 0; c < num_colunas; c++)
+                        memcpy(colunas[c].dados, originais[c].dados, (size_t)tamanho * largura_coluna);
+
+                    /* No método AoS direto a tabela já está em registros; a montagem fica fora da medição */
+                    if (m == 0)
+                    {
+                        for (int i = 0; i < tamanho; i++)
+                        {
+                            char *registro = registros + (size_t)i * tam_registro;
+                            memcpy(registro, &chaves[i], sizeof(int));
+                            for (int c = 0; c < num_colunas; c++)
+                                memcpy(registro + sizeof(int) + c * largura_coluna,
+                                       (char *)colunas[c].dados + (size_t)i * largura_coluna, largura_coluna);
+                        }
+                    }
+
+                    struct timespec inicio, fim;
+                    int ok = 1;
+                    clock_gettime(CLOCK_MONOTONIC, &inicio);
+                    if (m <= 1)
+                    {
+                        if (m == 1)
+                        {
+                            for (int i = 0; i < tamanho; i++)
+                            {
+                                char *registro = registros + (size_t)i * tam_registro;
+                                memcpy(registro, &chaves[i], sizeof(int));
+                                for (int c = 0; c < num_colunas; c++)
+                                    memcpy(registro + sizeof(int) + c * largura_coluna,
+                                           (char *)colunas[c].dados + (size_t)i * largura_coluna, largura_coluna);
+                            }
+                        }
+                        shellSortRegistros(registros, tam_registro, tamanho, &comparacoes, &trocas);
+                        if (m == 1)
+                        {
+                            for (int i = 0; i < tamanho; i++)
+                            {
+                                char *registro = registros + (size_t)i * tam_registro;
+                                memcpy(&chaves[i], registro, sizeof(int));
+                                for (int c = 0; c < num_colunas; c++)
+                                    memcpy((char *)colunas[c].dados + (size_t)i * largura_coluna,
+                                           registro + sizeof(int) + c * largura_coluna, largura_coluna);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        ok = shellSortSoA(chaves, tamanho, colunas, num_colunas,
+                                          m == 2 ? SOA_JUNTO : SOA_PASSO_FINAL, &comparacoes, &trocas);
+                    }
+                    clock_gettime(CLOCK_MONOTONIC, &fim);
+                    correto = correto && ok;
+
+                    if (r > 0)
+                        soma += medirTempo(inicio, fim);
+
+                    /* Conferência fora da medição (no AoS direto, a partir dos registros) */
+                    if (m == 0)
+                    {
+                        for (int i = 0; i < tamanho; i++)
+                        {
+                            char *registro = registros + (size_t)i * tam_registro;
+                            memcpy(&chaves[i], registro, sizeof(int));
+                            for (int c = 0; c < num_colunas; c++)
+                                memcpy((char *)colunas[c].dados + (size_t)i * largura_coluna,
+                                       registro + sizeof(int) + c * largura_coluna, largura_coluna);
+                        }
+                    }
+                    ok = colunasCorretas(chaves, tamanho, colunas, num_colunas);
+                    correto = correto && ok;
+                }
+
+                double media = soma / LOTE_REPETICOES;
+                printf("%-16s %8d %6zu B %8d %12.3f%s\n", metodos[m], tamanho, largura, num_colunas, media,
+                       correto ? "" : "  ERRO: colunas incorretas!");
+                fprintf(csv, "%s;%d;%zu;%d;%.3f\n", metodos[m], tamanho, largura, num_colunas, media);
+            }
+
+            if (!alocado)
+                printf("Erro ao alocar memoria para tamanho %d e carga %zu B!\n", tamanho, largura);
+
+            free(chaves_originais);
+            free(chaves);
+            free(registros);
+            for (int c = 0; c < num_colunas; c++)
+            {
+                free(originais[c].dados);
+                free(colunas[c].dados);
+            }
+        }
+    }
+
+    fclose(csv);
+    printf("\nCSV do benchmark SoA salvo em: %s\n", nomeCSV);
+    pausar();
+}
+
+/**
+ * @brief Executa o benchmark de ordenação de strings: Shell Sort e qsort() sobre chaves com
+ *        prefixo em linha contra os mesmos kernels sobre ponteiros com strcmp, nas distribuições
+ *        aleatória, de prefixo comum e de URLs. A preparação das chaves entra no tempo medido.
+ *        Cada saída é conferida, posição a posição, com a do qsort() com strcmp (fora da medição).
+ * @return void
+ */
+void executarBenchmarkStrings()
+{
+    int tamanhos[] = {20000, 60000, 200000};
+    const char *metodos[] = {"shell prefixo", "shell strcmp", "qsort prefixo", "qsort strcmp"};
+    const int NUM_TAMANHOS = 3, NUM_METODOS = 4;
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/shellSort/shellsort_strings_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do benchmark de strings.\n");
+        pausar();
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "metodo;distribuicao;tamanho;prefixo_comum;media_tempo_ms;comparacoes;desempates\n");
+
+    printf("\n========================================\n");
+    printf("  BENCHMARK DE STRINGS (PREFIXO EM LINHA)\n");
+    printf("========================================\n");
+    printf("%-14s %-14s %8s %7s %12s %14s %14s\n", "metodo", "distribuicao", "tamanho", "comum", "tempo (ms)",
+           "comparacoes", "desempates");
+
+    for (int t = 0; t < NUM_TAMANHOS; t++)
+    {
+        for (int d = 0; d < NUM_DISTRIBUICOES_STRINGS; d++)
+        {
+            int tamanho = tamanhos[t];
+            char *area = malloc((size_t)tamanho * STRING_MAX);
+            char **original = malloc(tamanho * sizeof(char *));
+            char **referencia = malloc(tamanho * sizeof(char *));
+            char **textos = malloc(tamanho * sizeof(char *));
+            ChaveString *chaves = malloc(tamanho * sizeof(ChaveString));
+
+            if (!area || !original || !referencia || !textos || !chaves)
+            {
+                printf("Erro ao alocar memoria!\n");
+                free(area);
+                free(original);
+                free(referencia);
+                free(textos);
+                free(chaves);
+                fclose(csv);
+                pausar();
+                return;
+            }
+
+            srand(TESTE_GERAL_SEMENTE + 1000u * d + (unsigned int)tamanho);
+            gerarStrings(area, original, d, tamanho);
+            memcpy(referencia, original, tamanho * sizeof(char *));
+            qsort(referencia, tamanho, sizeof(char *), compararStringsQsort);
+
+            for (int m = 0; m < NUM_METODOS; m++)
+            {
+                double soma = 0.0;
+                long comparacoes = 0, trocas = 0, desempates = 0;
+                uint32_t comum = 0;
+                int correto = 1;
+
+                for (int r = 0; r <= LOTE_REPETICOES; r++)
+                {
+                    memcpy(textos, original, tamanho * sizeof(char *));
+                    comparacoesQsort = desempatesQsort = 0;
+
+                    struct timespec inicio, fim;
+                    clock_gettime(CLOCK_MONOTONIC, &inicio);
+                    if (m == 0)
+                    {
+                        comum = prepararChavesString(textos, tamanho, chaves);
+                        shellSortStrings(chaves, tamanho, &comparacoes, &trocas, &desempates);
+                        extrairStrings(chaves, tamanho, comum, textos);
+                    }
+                    else if (m == 1)
+                    {
+                        shellSortStringsDireto(textos, tamanho, &comparacoes, &trocas);
+                        desempates = comparacoes;
+                    }
+                    else if (m == 2)
+                    {
+                        comum = prepararChavesString(textos, tamanho, chaves);
+                        qsort(chaves, tamanho, sizeof(ChaveString), compararChavesQsort);
+                        extrairStrings(chaves, tamanho, comum, textos);
+                    }
+                    else
+                        qsort(textos, tamanho, sizeof(char *), compararStringsQsort);
+                    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+                    if (m >= 2)
+                    {
+                        comparacoes = comparacoesQsort;
+                        desempates = desempatesQsort;
+                    }
+                    if (r > 0)
+                        soma += medirTempo(inicio, fim);
+                    for (int i = 0; i < tamanho && correto; i++)
+                        correto = strcmp(textos[i], referencia[i]) == 0;
+                }
+
+                double media = soma / LOTE_REPETICOES;
+                printf("%-14s %-14s %8d %7u %12.3f %14ld %14ld%s\n", metodos[m], nomesDistribuicoesStrings[d],
+                       tamanho, comum, media, comparacoes, desempates, correto ? "" : "  ERRO: ordem incorreta!");
+                fprintf(csv, "%s;%s;%d;%u;%.3f;%ld;%ld\n", metodos[m], nomesDistribuicoesStrings[d], tamanho, comum,
+                        media, comparacoes, desempates);
+            }
+
+            free(area);
+            free(original);
+            free(referencia);
+            free(textos);
+            free(chaves);
+        }
+    }
+
+    srand(time(NULL)); /* As sementes fixas acima não devem valer para as próximas opções */
+    fclose(csv);
+    printf("\nCSV do benchmark de strings salvo em: %s\n", nomeCSV);
+    pausar();
+}
+
+/**
+ * @brief Executa o benchmark das APIs de seleção contra um shellSort completo, variando k de 1 a n.
+ *        Os resultados são conferidos com um vetor de referência ordenado (fora da medição).
+ * @return void
+ */
+void executarBenchmarkSelecao()
+{
+    int tamanhos[] = {60000, 1000000};
+    const char *metodos[] = {"shellSort completo", "nth_element", "top-k (heap)", "ordenacao parcial"};
+    const int NUM_METODOS = 4;
+
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/shellSort/shellsort_selecao_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do benchmark de selecao.\n");
+        pausar();
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "metodo;tamanho;k;media_tempo_ms;media_comparacoes\n");
+
+    printf("\n========================================\n");
+    printf("   BENCHMARK DE SELECAO (TOP-K / N-ESIMO)\n");
+    printf("========================================\n");
+    printf("%-20s %8s %8s %12s %16s\n", "metodo", "tamanho", "k", "tempo (ms)", "comparacoes");
+
+    for (int t = 0; t < 2; t++)
+    {
+        int tamanho = tamanhos[t];
+        int ks[] = {1, 10, 100, 1000, 10000, tamanho / 2, tamanho};
+        const int NUM_KS = 7;
+
+        int *original = malloc(tamanho * sizeof(int));
+        int *referencia = malloc(tamanho * sizeof(int));
+        int *v = malloc(tamanho * sizeof(int));
+        int *saida = malloc(tamanho * sizeof(int));
+
+        if (!original || !referencia || !v || !saida)
+        {
+            printf("Erro ao alocar memoria!\n");
+            free(original);
+            free(referencia);
+            free(v);
+            free(saida);
+            fclose(csv);
+            pausar();
+            return;
+        }
+
+        long comparacoes, trocas;
+        gerarVetor(original, 3, tamanho);
+        memcpy(referencia, original, tamanho * sizeof(int));
+        shellSort(referencia, tamanho, &comparacoes, &trocas);
+
+        for (int q = 0; q < NUM_KS; q++)
+        {
+            int k = ks[q];
+
+            for (int m = 0; m < NUM_METODOS; m++)
+            {
+                double soma = 0.0;
+                long soma_comparacoes = 0;
+                int correto = 1;
+
+                for (int r = 0; r <= LOTE_REPETICOES; r++)
+                {
+                    memcpy(v, original, tamanho * sizeof(int));
+
+                    struct timespec inicio, fim;
+                    clock_gettime(CLOCK_MONOTONIC, &inicio);
+                    if (m == 0)
+                        shellSort(v, tamanho, &comparacoes, &trocas);
+                    else if (m == 1)
+                        selecionarNesimo(v, tamanho, k - 1, &comparacoes, &trocas);
+                    else if (m == 2)
+                        selecionarMenores(v, tamanho, k, saida, &comparacoes, &trocas);
+                    else
+                        ordenarParcial(v, tamanho, k, &comparacoes, &trocas);
+                    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+                    if (r > 0)
+                    {
+                        soma += medirTempo(inicio, fim);
+                        soma_comparacoes += comparacoes;
+                    }
+
+                    if (m == 0)
+                        correto = correto && memcmp(v, referencia, tamanho * sizeof(int)) == 0;
+                    else if (m == 1)
+                    {
+                        /* Posição final e partição em torno do k-ésimo */
+                        correto = correto && v[k - 1] == referencia[k - 1];
+                        for (int i = 0; i < tamanho && correto; i++)
+                            correto = i < k - 1 ? v[i] <= v[k - 1] : v[i] >= v[k - 1];
+                    }
+                    else if (m == 2)
+                        correto = correto && memcmp(saida, referencia, k * sizeof(int)) == 0;
+                    else
+                        correto = correto && memcmp(v, referencia, k * sizeof(int)) == 0;
+                }
+
+                double media = soma / LOTE_REPETICOES;
+                double media_comparacoes = (double)soma_comparacoes / LOTE_REPETICOES;
+                printf("%-20s %8d %8d %12.3f %16.0f%s\n", metodos[m], tamanho, k, media, media_comparacoes,
+                       correto ? "" : "  ERRO: selecao incorreta!");
+                fprintf(csv, "%s;%d;%d;%.3f;%.0f\n", metodos[m], tamanho, k, media, media_comparacoes);
+            }
+        }
+
+        free(original);
+        free(referencia);
+        free(v);
+        free(saida);
     }
 
     fclose(csv);
-    printf("\nCSV geral salvo em: %s\n", nomeCSV);
+    printf("\nCSV do benchmark de selecao salvo em: %s\n", nomeCSV);
+    pausar();
 }
 
 /**
- * @brief Salva os resultados detalhados de um experimento em um arquivo TXT.
- * @param tipo Tipo de vetor (crescente, decrescente, aleatório).
- * @param tamanho Tamanho do vetor.
- * @param tempos Vetor de tempos de execução.
- * @param comparacoes Vetor de números de comparações.
- * @param trocas Vetor de números de trocas.
- * @param mediaTempo Média dos tempos de execução.
- * @param desvioTempo Desvio padrão dos tempos de execução.
- * @param mediaComparacoes Média dos números de comparações.
- * @param mediaTrocas Média dos números de trocas.
+ * @brief Executa o benchmark de atualização incremental de um vetor ordenado (inserções, remoções
+ *        e alterações de chave em lote) contra reordenar tudo com shellSort, com lotes de 0,01%
+ *        a 10% de n. Inserções e remoções são conferidas com um vetor de referência; alterações,
+ *        pela ordenação e pela soma das chaves.
  * @return void
  */
-void salvarResultados(char tipo[], int tamanho, double tempos[], long comparacoes[], long trocas[],
-                      double mediaTempo, double desvioTempo, double mediaComparacoes, double mediaTrocas)
+void executarBenchmarkIncremental()
 {
+    const int tamanho = 1000000;
+    double percentuais[] = {0.01, 0.1, 1.0, 10.0};
+    const char *operacoes[] = {"insercao", "remocao", "atualizacao"};
+
     time_t agora = time(NULL);
     struct tm *info = localtime(&agora);
-    char nomeArquivo[150];
+    char nomeCSV[150];
 
-    sprintf(nomeArquivo, "../results/files/shellSort/shellsort_%s_%d_%02d-%02d-%04d_%02d-%02d-%02d.txt",
-            tipo, tamanho, info->tm_mday, info->tm_mon + 1,
-            info->tm_year + 1900, info->tm_hour, info->tm_min, info->tm_sec);
+    sprintf(nomeCSV, "../results/files/shellSort/shellsort_incremental_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
 
-    FILE *arquivo = fopen(nomeArquivo, "w");
-    if (!arquivo)
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
     {
-        printf("Erro ao criar o arquivo TXT.\n");
+        printf("Erro ao criar o arquivo CSV do benchmark incremental.\n");
+        pausar();
         return;
     }
+    ambienteCabecalho(csv);
+    fprintf(csv, "operacao;metodo;tamanho;delta;delta_percentual;media_tempo_ms;media_deslocamentos\n");
 
-    fprintf(arquivo, "============================================================\n");
-    fprintf(arquivo, "               SHELL SORT - SEQUENCIA DE KNUTH               \n");
-    fprintf(arquivo, "============================================================\n\n");
-    fprintf(arquivo, "Configuracoes do experimento:\n");
-    fprintf(arquivo, "------------------------------------------------------------\n");
-    fprintf(arquivo, "Tamanho do vetor : %d\n", tamanho);
-    fprintf(arquivo, "Repeticoes       : %d (descartadas %d primeiras)\n", REPETICOES, QTD_DESCARTES);
-    fprintf(arquivo, "Repeticoes validas: %d\n", REPETICOES - QTD_DESCARTES);
-    fprintf(arquivo, "Tipo de vetor    : %s\n\n", tipo);
-    fprintf(arquivo, "Resultados individuais:\n");
-    fprintf(arquivo, "------------------------------------------------------------\n");
+    int capacidade = tamanho + tamanho / 10;
+    int *base = malloc(tamanho * sizeof(int));
+    int *v = malloc(capacidade * sizeof(int));
+    int *referencia = malloc(capacidade * sizeof(int));
+    int *delta = malloc(capacidade * sizeof(int));
+    int *lote = malloc(capacidade * sizeof(int));
+    int *posicoes = malloc(capacidade * sizeof(int));
+    int *posicoes_lote = malloc(capacidade * sizeof(int));
+    char *marcado = malloc(tamanho);
 
-    for (int i = 0; i < REPETICOES; i++)
+    if (!base || !v || !referencia || !delta || !lote || !posicoes || !posicoes_lote || !marcado)
     {
-        fprintf(arquivo, "Execucao %2d", i + 1);
-        if (i < QTD_DESCARTES)
+        printf("Erro ao alocar memoria!\n");
+        free(base);
+        free(v);
+        free(referencia);
+        free(delta);
+        free(lote);
+        free(posicoes);
+        free(posicoes_lote);
+        free(marcado);
+        fclose(csv);
+        pausar();
+        return;
+    }
+
+    long comparacoes, trocas;
+    gerarVetor(base, 3, tamanho);
+    shellSort(base, tamanho, &comparacoes, &trocas);
+
+    printf("\n========================================\n");
+    printf("   BENCHMARK DE ATUALIZACAO INCREMENTAL\n");
+    printf("========================================\n");
+    printf("%-12s %-22s %8s %8s %12s %14s\n", "operacao", "metodo", "delta", "%", "tempo (ms)", "deslocamentos");
+
+    for (int p = 0; p < 4; p++)
+    {
+        int tam_delta = (int)(tamanho * percentuais[p] / 100.0);
+
+        for (int op = 0; op < 3; op++)
         {
-            fprintf(arquivo, " (DESCARTADA)");
+            /* Lote da operação: novas chaves, chaves existentes (posições distintas) ou posições + novas chaves */
+            memset(marcado, 0, tamanho);
+            for (int i = 0; i < tam_delta; i++)
+            {
+                delta[i] = rand() % TAM_MAX;
+                int pos;
+                do
+                    pos = rand() % tamanho;
+                while (marcado[pos]);
+                marcado[pos] = 1;
+                posicoes[i] = pos;
+            }
+
+            /* Referência de inserção e remoção, montada sem as funções incrementais */
+            int tam_referencia = 0;
+            long long soma_esperada = 0;
+            if (op == 0)
+            {
+                memcpy(referencia, base, tamanho * sizeof(int));
+                memcpy(referencia + tamanho, delta, tam_delta * sizeof(int));
+                tam_referencia = tamanho + tam_delta;
+                shellSort(referencia, tam_referencia, &comparacoes, &trocas);
+            }
+            else if (op == 1)
+            {
+                for (int i = 0; i < tamanho; i++)
+                    if (!marcado[i])
+                        referencia[tam_referencia++] = base[i];
+            }
+            else
+            {
+                for (int i = 0; i < tamanho; i++)
+                    soma_esperada += base[i];
+            }
+
+            /* Reposicionamento chave a chave só nos lotes pequenos: cada chave pode deslocar O(n) elementos */
+            int num_metodos = op == 2 && tam_delta <= LIMITE_REPOSICIONAMENTO ? 3 : 2;
+            for (int metodo = 0; metodo < num_metodos; metodo++)
+            {
+                double soma = 0.0;
+                long soma_trocas = 0;
+                int correto = 1;
+
+                for (int r = 0; r <= LOTE_REPETICOES; r++)
+                {
+                    int n = tamanho;
+                    long long soma_chaves = soma_esperada;
+                    memcpy(v, base, tamanho * sizeof(int));
+                    if (op == 1)
+                        for (int i = 0; i < tam_delta; i++)
+                            lote[i] = base[posicoes[i]];
+                    else
+                        memcpy(lote, delta, tam_delta * sizeof(int));
+                    memcpy(posicoes_lote, posicoes, tam_delta * sizeof(int));
+
+                    struct timespec inicio, fim;
+                    clock_gettime(CLOCK_MONOTONIC, &inicio);
+                    if (metodo == 0)
+                    {
+                        /* Reordenação completa: aplica o lote ao vetor e chama shellSort sobre tudo */
+                        if (op == 0)
+                        {
+                            memcpy(v + n, lote, tam_delta * sizeof(int));
+                            n += tam_delta;
+                        }
+                        else if (op == 1)
+                        {
+                            n = 0;
+                            for (int i = 0; i < tamanho; i++)
+                                if (!marcado[i])
+                                    v[n++] = v[i];
+                        }
+                        else
+                        {
+                            for (int i = 0; i < tam_delta; i++)
+                            {
+                                soma_chaves += lote[i] - v[posicoes[i]];
+                                v[posicoes[i]] = lote[i];
+                            }
+                        }
+                        shellSort(v, n, &comparacoes, &trocas);
+                    }
+                    else if (op == 0)
+                        inserirLote(v, &n, capacidade, lote, tam_delta, &comparacoes, &trocas);
+                    else if (op == 1)
+                        removerLote(v, &n, lote, tam_delta, &comparacoes, &trocas);
+                    else if (metodo == 1)
+                    {
+                        for (int i = 0; i < tam_delta; i++)
+                            soma_chaves += lote[i] - v[posicoes_lote[i]];
+                        atualizarLote(v, n, posicoes_lote, lote, tam_delta, &comparacoes, &trocas);
+                    }
+                    else
+                    {
+                        comparacoes = trocas = 0;
+                        for (int i = 0; i < tam_delta; i++)
+                        {
+                            soma_chaves += lote[i] - v[posicoes[i]];
+                            atualizarChave(v, n, posicoes[i], lote[i], &comparacoes, &trocas);
+                        }
+                    }
+                    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+                    if (r > 0)
+                    {
+                        soma += medirTempo(inicio, fim);
+                        soma_trocas += trocas;
+                    }
+
+                    if (op == 2)
+                    {
+                        long long soma_final = 0;
+                        for (int i = 0; i < n; i++)
+                        {
+                            soma_final += v[i];
+                            if (i > 0 && v[i - 1] > v[i])
+                                correto = 0;
+                        }
+                        correto = correto && soma_final == soma_chaves;
+                    }
+                    else
+                        correto = correto && n == tam_referencia && memcmp(v, referencia, n * sizeof(int)) == 0;
+                }
+
+                const char *nome_metodo = metodo == 0 ? "shellSort completo"
+                                          : metodo == 1 ? "incremental"
+                                                        : "reposicionamento local";
+                double media = soma / LOTE_REPETICOES;
+                double media_trocas = (double)soma_trocas / LOTE_REPETICOES;
+                printf("%-12s %-22s %8d %8.2f %12.3f %14.0f%s\n", operacoes[op], nome_metodo, tam_delta,
+                       percentuais[p], media, media_trocas, correto ? "" : "  ERRO: vetor incorreto!");
+                fprintf(csv, "%s;%s;%d;%d;%.2f;%.3f;%.0f\n", operacoes[op], nome_metodo, tamanho, tam_delta,
+                        percentuais[p], media, media_trocas);
+            }
         }
-        fprintf(arquivo, "\n");
-        fprintf(arquivo, "  Tempo        : %8.3f ms\n", tempos[i]);
-        fprintf(arquivo, "  Comparacoes  : %8ld\n", comparacoes[i]);
-        fprintf(arquivo, "  Trocas       : %8ld\n\n", trocas[i]);
     }
 
-    fprintf(arquivo, "Resumo estatistico (descartadas %d primeiras execucoes):\n", QTD_DESCARTES);
-    fprintf(arquivo, "------------------------------------------------------------\n");
-    fprintf(arquivo, "Tempo medio           : %.3f ms\n", mediaTempo);
-    fprintf(arquivo, "Desvio padrao (tempo) : %.3f ms\n\n", desvioTempo);
-    fprintf(arquivo, "Media de comparacoes  : %.2f\n", mediaComparacoes);
-    fprintf(arquivo, "Media de trocas       : %.2f\n", mediaTrocas);
-    fprintf(arquivo, "\n============================================================\n");
+    free(base);
+    free(v);
+    free(referencia);
+    free(delta);
+    free(lote);
+    free(posicoes);
+    free(posicoes_lote);
+    free(marcado);
+    fclose(csv);
+    printf("\nCSV do benchmark incremental salvo em: %s\n", nomeCSV);
+    pausar();
+}
 
-    fclose(arquivo);
-    printf("  TXT salvo: %s\n", nomeArquivo);
+/**
+ * @brief Mede uma configuração da ordenação paralela (vetor aleatório, ESCALA_REPETICOES após
+ *        1 warm-up) e confere a ordenação. O pool já vem criado, de modo que a criação das
+ *        threads fica fora da região medida. Com pool NULL, mede o shellSort sequencial.
+ * @return Tempo médio em ms, ou -1 em caso de erro.
+ */
+double medirOrdenacaoParalela(int original[], int v[], int tamanho, PoolTrabalho *pool, long *roubos)
+{
+    double soma = 0.0;
+    long comparacoes, trocas;
+
+    for (int r = 0; r <= ESCALA_REPETICOES; r++)
+    {
+        memcpy(v, original, tamanho * sizeof(int));
+
+        struct timespec inicio, fim;
+        clock_gettime(CLOCK_MONOTONIC, &inicio);
+        if (!pool)
+            shellSort(v, tamanho, &comparacoes, &trocas);
+        else if (!shellSortParaleloPool(pool, v, tamanho, roubos))
+            return -1.0;
+        clock_gettime(CLOCK_MONOTONIC, &fim);
+
+        if (r > 0)
+            soma += medirTempo(inicio, fim);
+        for (int i = 1; i < tamanho; i++)
+            if (v[i - 1] > v[i])
+                return -1.0;
+    }
+    return soma / ESCALA_REPETICOES;
 }
 
 /**
- * @brief Executa o teste geral com todos os cenários e tamanhos.
+ * @brief Executa os relatórios de escalabilidade da ordenação paralela.
+ *        Forte: tamanho fixo com 1, 2, 4, ... threads (speedup sobre 1 thread e sobre o shellSort
+ *        sequencial). Fraca: tamanho proporcional ao número de threads (eficiência = t1 / tN).
+ *        Um pool por contagem de threads é criado antes das medições e reutilizado nas duas
+ *        escalas; o tempo de criação é registrado à parte (criacao_pool_ms).
  * @return void
  */
-void executarTesteGeral()
+void executarBenchmarkParalelo()
 {
-    int tamanhos[] = {20000, 40000, 60000};
-    char *nomes_cenarios[] = {"crescente", "decrescente", "aleatorio"};
-    int tipos_cenarios[] = {1, 2, 3};
+    const int TAMANHO_FORTE = 10000000;
+    const int TAMANHO_POR_THREAD = 2000000;
+    int max_threads;
 
-    const int TOTAL_COMBINACOES = 3 * 3;
-    const int TOTAL_EXECUCOES = TOTAL_COMBINACOES * REPETICOES;
+    printf("Numero maximo de threads (0 = todos os %d nucleos): ", numeroNucleos());
+    if (scanf("%d", &max_threads) != 1 || max_threads <= 0)
+        max_threads = numeroNucleos();
+    if (max_threads > MAX_THREADS)
+        max_threads = MAX_THREADS;
 
-    ResultadoCSV *resultados = malloc(TOTAL_EXECUCOES * sizeof(ResultadoCSV));
-    Estatisticas *estatisticas = malloc(TOTAL_COMBINACOES * sizeof(Estatisticas));
+    int contagens[MAX_THREADS], num_contagens = 0;
+    for (int t = 1; t < max_threads; t *= 2)
+        contagens[num_contagens++] = t;
+    contagens[num_contagens++] = max_threads;
 
-    if (!resultados || !estatisticas)
+    int maior = TAMANHO_POR_THREAD * max_threads > TAMANHO_FORTE ? TAMANHO_POR_THREAD * max_threads : TAMANHO_FORTE;
+    int *original = malloc(maior * sizeof(int));
+    int *v = malloc(maior * sizeof(int));
+    if (!original || !v)
     {
         printf("Erro ao alocar memoria!\n");
-        free(resultados);
-        free(estatisticas);
+        free(original);
+        free(v);
+        pausar();
         return;
     }
 
-    int idx_resultado = 0;
-    int idx_estatistica = 0;
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
+
+    sprintf(nomeCSV, "../results/files/shellSort/shellsort_paralelo_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
+
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do benchmark paralelo.\n");
+        free(original);
+        free(v);
+        pausar();
+        return;
+    }
+    ambienteCabecalho(csv);
+    fprintf(csv, "escala;metodo;threads;tamanho;media_tempo_ms;speedup;eficiencia;roubos;criacao_pool_ms\n");
 
     printf("\n========================================\n");
-    printf("        INICIANDO TESTE GERAL           \n");
-    printf("========================================\n\n");
+    printf("   ORDENACAO PARALELA (L2 = %ld KB, folha = %ld elementos)\n",
+           tamanhoCacheL2() / 1024,
+           perfilAtivo.folha_paralela > 0 ? perfilAtivo.folha_paralela : tamanhoCacheL2() / 2 / (long)sizeof(int));
+    printf("========================================\n");
 
-    for (int t = 0; t < 3; t++)
+    gerarVetor(original, 3, maior);
+    long roubos = 0;
+
+    PoolTrabalho *pools[MAX_THREADS];
+    double criacao[MAX_THREADS];
+    for (int c = 0; c < num_contagens; c++)
     {
-        int tamanho = tamanhos[t];
+        struct timespec inicio, fim;
+        clock_gettime(CLOCK_MONOTONIC, &inicio);
+        pools[c] = criarPool(contagens[c]);
+        clock_gettime(CLOCK_MONOTONIC, &fim);
+        criacao[c] = medirTempo(inicio, fim);
+    }
 
-        for (int c = 0; c < 3; c++)
+    /* Escalabilidade forte */
+    double sequencial = medirOrdenacaoParalela(original, v, TAMANHO_FORTE, NULL, NULL);
+    printf("\nForte (n = %d)\n", TAMANHO_FORTE);
+    printf("%8s %12s %10s %12s %10s %8s %10s\n", "threads", "tempo (ms)", "speedup", "vs sequen.", "eficiencia",
+           "roubos", "pool (ms)");
+    printf("%8s %12.3f %10s %12s %10s %8s %10s\n", "seq.", sequencial, "-", "1.00", "-", "-", "-");
+    fprintf(csv, "forte;shellSort sequencial;1;%d;%.3f;1.000;1.000;0;0.000\n", TAMANHO_FORTE, sequencial);
+
+    double base = 0.0;
+    for (int c = 0; c < num_contagens; c++)
+    {
+        double media = pools[c] ? medirOrdenacaoParalela(original, v, TAMANHO_FORTE, pools[c], &roubos) : -1.0;
+        if (media < 0)
         {
-            printf("\n[CENARIO: %s | TAMANHO: %d]\n", nomes_cenarios[c], tamanho);
-            printf("Executando %d repeticoes (serao descartadas %d)...\n", REPETICOES, QTD_DESCARTES);
+            printf("ERRO: ordenacao paralela falhou com %d threads!\n", contagens[c]);
+            continue;
+        }
+        if (c == 0)
+            base = media;
+        double speedup = base / media;
+        printf("%8d %12.3f %10.2f %12.2f %10.2f %8ld %10.3f\n", contagens[c], media, speedup, sequencial / media,
+               speedup / contagens[c], roubos, criacao[c]);
+        fprintf(csv, "forte;paralelo;%d;%d;%.3f;%.3f;%.3f;%ld;%.3f\n", contagens[c], TAMANHO_FORTE, media,
+                speedup, speedup / contagens[c], roubos, criacao[c]);
+    }
 
-            double tempos[REPETICOES];
-            long comparacoes[REPETICOES];
-            long trocas[REPETICOES];
+    /* Escalabilidade fraca */
+    printf("\nFraca (n = %d por thread)\n", TAMANHO_POR_THREAD);
+    printf("%8s %12s %12s %10s %8s\n", "threads", "tamanho", "tempo (ms)", "eficiencia", "roubos");
+    for (int c = 0; c < num_contagens; c++)
+    {
+        int tamanho = TAMANHO_POR_THREAD * contagens[c];
+        double media = pools[c] ? medirOrdenacaoParalela(original, v, tamanho, pools[c], &roubos) : -1.0;
+        if (media < 0)
+        {
+            printf("ERRO: ordenacao paralela falhou com %d threads!\n", contagens[c]);
+            continue;
+        }
+        if (c == 0)
+            base = media;
+        printf("%8d %12d %12.3f %10.2f %8ld\n", contagens[c], tamanho, media, base / media, roubos);
+        fprintf(csv, "fraca;paralelo;%d;%d;%.3f;%.3f;%.3f;%ld;%.3f\n", contagens[c], tamanho, media,
+                base / media, base / media, roubos, criacao[c]);
+    }
 
-            for (int r = 0; r < REPETICOES; r++)
-            {
-                int *vetor = malloc(tamanho * sizeof(int));
-                if (!vetor)
-                {
-                    printf("Erro ao alocar vetor!\n");
-                    break;
-                }
+    for (int c = 0; c < num_contagens; c++)
+        destruirPool(pools[c]);
 
-                gerarVetor(vetor, tipos_cenarios[c], tamanho);
+    fclose(csv);
+    free(original);
+    free(v);
+    printf("\nCSV do benchmark paralelo salvo em: %s\n", nomeCSV);
+    pausar();
+}
 
-                struct timespec inicio, fim;
-                clock_gettime(CLOCK_MONOTONIC, &inicio);
-                shellSort(vetor, tamanho, &comparacoes[r], &trocas[r]);
-                clock_gettime(CLOCK_MONOTONIC, &fim);
+/**
+ * @brief Mediana de AJUSTE_REPETICOES medições (após 1 warm-up) de uma operação do autoajuste.
+ *        operacao: 0 - shellSort, 1 - selecionarNesimo (k = n/2), 2 - shellSortParalelo.
+ * @return Mediana em ms, ou -1 se a ordenação falhar ou o resultado estiver incorreto.
+ */
+double medirAjuste(int operacao, const int original[], int v[], int tamanho, int threads)
+{
+    double tempos[AJUSTE_REPETICOES];
+    long comparacoes, trocas;
+    PoolTrabalho *pool = NULL;
+    int falhou = 0;
 
-                tempos[r] = medirTempo(inicio, fim);
+    /* O pool da operação paralela é criado fora da região medida */
+    if (operacao == 2 && !(pool = criarPool(threads)))
+        return -1.0;
 
-                strcpy(resultados[idx_resultado].algoritmo, "Shell Sort");
-                strcpy(resultados[idx_resultado].cenario, nomes_cenarios[c]);
-                resultados[idx_resultado].tamanho = tamanho;
-                resultados[idx_resultado].repeticao = r + 1;
-                resultados[idx_resultado].tempo = tempos[r];
-                resultados[idx_resultado].comparacoes = comparacoes[r];
-                resultados[idx_resultado].trocas = trocas[r];
-                idx_resultado++;
+    for (int r = 0; r <= AJUSTE_REPETICOES; r++)
+    {
+        memcpy(v, original, tamanho * sizeof(int));
 
-                if ((r + 1) % 5 == 0)
-                    printf("  Completadas: %d/%d\n", r + 1, REPETICOES);
+        struct timespec inicio, fim;
+        clock_gettime(CLOCK_MONOTONIC, &inicio);
+        if (operacao == 0)
+            shellSort(v, tamanho, &comparacoes, &trocas);
+        else if (operacao == 1)
+            selecionarNesimo(v, tamanho, tamanho / 2, &comparacoes, &trocas);
+        else if (!shellSortParaleloPool(pool, v, tamanho, NULL))
+            falhou = 1;
+        clock_gettime(CLOCK_MONOTONIC, &fim);
 
-                free(vetor);
-            }
+        if (r > 0)
+            tempos[r - 1] = medirTempo(inicio, fim);
+        if (operacao != 1)
+        {
+            for (int i = 1; i < tamanho && !falhou; i++)
+                if (v[i - 1] > v[i])
+                    falhou = 1;
+        }
+        if (falhou)
+            break;
+    }
+    destruirPool(pool);
+    if (falhou)
+        return -1.0;
 
-            // Calcular estatísticas descartando as primeiras QTD_DESCARTES repetições
-            int inicio_estat = QTD_DESCARTES;
-            int fim_estat = REPETICOES - 1;
-            int repeticoes_validas = REPETICOES - QTD_DESCARTES;
+    /* Ordenação por inserção das poucas medições para tirar a mediana */
+    for (int i = 1; i < AJUSTE_REPETICOES; i++)
+        for (int j = i; j > 0 && tempos[j - 1] > tempos[j]; j--)
+        {
+            double temp = tempos[j];
+            tempos[j] = tempos[j - 1];
+            tempos[j - 1] = temp;
+        }
+    return tempos[AJUSTE_REPETICOES / 2];
+}
 
-            if (repeticoes_validas > 0)
-            {
-                double media_tempo = calcularMediaDouble(tempos, inicio_estat, fim_estat);
-                double desvio_tempo = calcularDesvioPadraoDouble(tempos, inicio_estat, fim_estat, media_tempo);
-                double media_comparacoes = calcularMediaLong(comparacoes, inicio_estat, fim_estat);
-                double media_trocas = calcularMediaLong(trocas, inicio_estat, fim_estat);
+/**
+ * @brief Autoajuste: procura os melhores parâmetros para este host e grava o perfil de ajuste.
+ *        1. variante x sequência de gaps do shellSort, sobre vetores crescentes, decrescentes e
+ *           aleatórios de vários tamanhos (pontuação: média geométrica do tempo relativo à
+ *           primeira combinação, para que os tamanhos pequenos também pesem);
+ *        2. corte da seleção para pequenos intervalos (selecionarNesimo, k = n/2);
+ *        3. threads e tamanho de folha da ordenação paralela.
+ *        Os vencedores passam a valer imediatamente e são gravados em caminhoPerfil().
+ * @return void
+ */
+void executarAutoajuste()
+{
+    int tamanhos[] = {1000, 20000, 150000};
+    const int NUM_TAMANHOS = 3;
+    const int TAMANHO_SELECAO = 1000000;
+    const int TAMANHO_PARALELO = 4000000;
+    int cortes[] = {8, 16, 32, 64, 128};
+    const int NUM_CORTES = 5;
 
-                strcpy(estatisticas[idx_estatistica].cenario, nomes_cenarios[c]);
-                estatisticas[idx_estatistica].tamanho = tamanho;
-                estatisticas[idx_estatistica].media_tempo = media_tempo;
-                estatisticas[idx_estatistica].desvio_tempo = desvio_tempo;
-                estatisticas[idx_estatistica].media_comparacoes = media_comparacoes;
-                estatisticas[idx_estatistica].media_trocas = media_trocas;
-                idx_estatistica++;
+    int *original = malloc(TAMANHO_PARALELO * sizeof(int));
+    int *v = malloc(TAMANHO_PARALELO * sizeof(int));
+    if (!original || !v)
+    {
+        printf("Erro ao alocar memoria!\n");
+        free(original);
+        free(v);
+        pausar();
+        return;
+    }
 
-                salvarResultados(nomes_cenarios[c], tamanho,
-                                 tempos,
-                                 comparacoes,
-                                 trocas,
-                                 media_tempo, desvio_tempo,
-                                 media_comparacoes, media_trocas);
+    printf("\n========================================\n");
+    printf("        AUTOAJUSTE DE PARAMETROS\n");
+    printf("========================================\n");
 
-                printf("  Concluido! Media: %.2f ms (apos descarte de %d execucoes)\n",
-                       media_tempo, QTD_DESCARTES);
+    /* 1. Variante x sequência de gaps */
+    printf("\n[1/3] Variante x sequencia de gaps (shellSort)\n");
+    printf("%-12s %-10s %12s\n", "variante", "gaps", "tempo rel.");
+
+    double referencia[3][3] = {{0.0}}; /* Tempo da primeira combinação medida com sucesso em cada célula */
+    double melhor_pontuacao = -1.0;
+    int melhor_variante = varianteAtiva, melhor_sequencia = perfilAtivo.sequencia_gaps;
+    int variante_inicial = varianteAtiva;
+
+    for (int var = 0; var < NUM_VARIANTES; var++)
+    {
+        if (!varianteSuportada(var))
+            continue;
+        varianteAtiva = var;
+
+        for (int seq = 0; seq < NUM_SEQUENCIAS; seq++)
+        {
+            perfilAtivo.sequencia_gaps = seq;
+            double soma_log = 0.0;
+            int medicoes = 0;
+
+            for (int t = 0; t < NUM_TAMANHOS; t++)
+            {
+                for (int tipo = 1; tipo <= 3; tipo++)
+                {
+                    srand(tipo * 7919 + t); /* Mesmas entradas em todas as combinações */
+                    gerarVetor(original, tipo, tamanhos[t]);
+                    double tempo = medirAjuste(0, original, v, tamanhos[t], 0);
+                    if (tempo < 0)
+                    {
+                        printf("ERRO: ordenacao incorreta com %s/%s!\n", nomesVariantes[var], nomesSequencias[seq]);
+                        continue;
+                    }
+                    if (referencia[t][tipo - 1] <= 0.0)
+                        referencia[t][tipo - 1] = tempo;
+                    soma_log += log(tempo / referencia[t][tipo - 1]);
+                    medicoes++;
+                }
             }
-            else
+
+            /* Só concorrem as combinações medidas em todas as células */
+            if (medicoes < NUM_TAMANHOS * 3)
             {
-                printf("  Erro: Nenhuma repeticao valida apos descarte!\n");
+                printf("%-12s %-10s %12s\n", nomesVariantes[var], nomesSequencias[seq], "descartada");
+                continue;
+            }
+            double pontuacao = exp(soma_log / medicoes);
+            printf("%-12s %-10s %12.3f\n", nomesVariantes[var], nomesSequencias[seq], pontuacao);
+            if (melhor_pontuacao < 0 || pontuacao < melhor_pontuacao)
+            {
+                melhor_pontuacao = pontuacao;
+                melhor_variante = var;
+                melhor_sequencia = seq;
             }
         }
     }
+    varianteAtiva = melhor_variante;
+    perfilAtivo.variante = melhor_variante;
+    perfilAtivo.sequencia_gaps = melhor_sequencia;
+    printf("  => variante %s, gaps %s\n", nomesVariantes[melhor_variante], nomesSequencias[melhor_sequencia]);
+
+    /* 2. Corte da seleção */
+    printf("\n[2/3] Corte para pequenos intervalos na selecao (n = %d)\n", TAMANHO_SELECAO);
+    srand(12345);
+    gerarVetor(original, 3, TAMANHO_SELECAO);
+    /* Em cada etapa, melhor_tempo < 0 indica que nenhum candidato foi medido com sucesso;
+       medições que falham (-1) são descartadas e, sem nenhuma válida, o valor anterior é mantido */
+    double melhor_tempo = -1.0;
+    int melhor_corte = perfilAtivo.corte_selecao;
+    for (int c = 0; c < NUM_CORTES; c++)
+    {
+        perfilAtivo.corte_selecao = cortes[c];
+        double tempo = medirAjuste(1, original, v, TAMANHO_SELECAO, 0);
+        if (tempo < 0)
+        {
+            printf("  corte %4d: falhou (descartado)\n", cortes[c]);
+            continue;
+        }
+        printf("  corte %4d: %10.3f ms\n", cortes[c], tempo);
+        if (melhor_tempo < 0 || tempo < melhor_tempo)
+        {
+            melhor_tempo = tempo;
+            melhor_corte = cortes[c];
+        }
+    }
+    perfilAtivo.corte_selecao = melhor_corte;
+    printf("  => corte %d\n", perfilAtivo.corte_selecao);
+
+    /* 3. Threads e folha da ordenação paralela */
+    printf("\n[3/3] Ordenacao paralela (n = %d)\n", TAMANHO_PARALELO);
+    srand(54321);
+    gerarVetor(original, 3, TAMANHO_PARALELO);
+    int folha_anterior = perfilAtivo.folha_paralela;
+    perfilAtivo.folha_paralela = 0;
+    int contagens[MAX_THREADS], num_contagens = 0, melhor_threads = perfilAtivo.threads;
+    for (int t = 1; t < numeroNucleos(); t *= 2)
+        contagens[num_contagens++] = t;
+    contagens[num_contagens++] = numeroNucleos();
+
+    melhor_tempo = -1.0;
+    for (int c = 0; c < num_contagens; c++)
+    {
+        double tempo = medirAjuste(2, original, v, TAMANHO_PARALELO, contagens[c]);
+        if (tempo < 0)
+        {
+            printf("  %2d threads: falhou (descartado)\n", contagens[c]);
+            continue;
+        }
+        printf("  %2d threads: %10.3f ms\n", contagens[c], tempo);
+        if (melhor_tempo < 0 || tempo < melhor_tempo)
+        {
+            melhor_tempo = tempo;
+            melhor_threads = contagens[c];
+        }
+    }
+    perfilAtivo.threads = melhor_threads;
 
-    salvarCSVGeral(resultados, idx_resultado, estatisticas, idx_estatistica);
+    long folha_l2 = tamanhoCacheL2() / 2 / (long)sizeof(int);
+    int melhor_folha = folha_anterior;
+    melhor_tempo = -1.0;
+    for (long folha = folha_l2 / 4; folha <= folha_l2 * 4; folha *= 2)
+    {
+        perfilAtivo.folha_paralela = (int)folha;
+        double tempo = medirAjuste(2, original, v, TAMANHO_PARALELO, melhor_threads);
+        if (tempo < 0)
+        {
+            printf("  folha %8ld: falhou (descartada)\n", folha);
+            continue;
+        }
+        printf("  folha %8ld: %10.3f ms\n", folha, tempo);
+        if (melhor_tempo < 0 || tempo < melhor_tempo)
+        {
+            melhor_tempo = tempo;
+            melhor_folha = (int)folha;
+        }
+    }
+    perfilAtivo.folha_paralela = melhor_folha;
+    printf("  => %d threads, folha de %d elementos\n", melhor_threads, melhor_folha);
 
-    free(resultados);
-    free(estatisticas);
+    srand(time(NULL));
+    free(original);
+    free(v);
 
-    printf("\n========================================\n");
-    printf("     TESTE GERAL CONCLUIDO!             \n");
-    printf("========================================\n");
+    if (salvarPerfil(caminhoPerfil()))
+    {
+        snprintf(arquivoPerfil, sizeof(arquivoPerfil), "%s", caminhoPerfil());
+        printf("\nPerfil de ajuste salvo em: %s\n", caminhoPerfil());
+    }
+    else
+    {
+        printf("\nErro ao salvar o perfil de ajuste em %s\n", caminhoPerfil());
+    }
+    if (getenv("ORDENACAO_VARIANTE") && varianteAtiva != variante_inicial)
+        printf("AVISO: ORDENACAO_VARIANTE continua tendo prioridade sobre o perfil na proxima execucao.\n");
     pausar();
 }
 
+/* ================= LATÊNCIA DE ORDENAÇÕES PEQUENAS ================= */
 /**
- * @brief Executa o experimento para um tamanho fixo de vetor.
- * @param tipo Tipo de vetor: 1 - crescente, 2 - decrescente, 3 - aleatório.
- * @param tempos Vetor para armazenar os tempos de execução.
- * @param comparacoes Vetor para armazenar o número de comparações.
- * @param trocas Vetor para armazenar o número de trocas.
- * @param tamanho Tamanho do vetor.
+ * @brief Benchmark de latência de ordenações pequenas (8 a 4096 elementos) com o TSC, com o
+ *        shellSort() como kernel (latenciaExecutar(), execucaoLonga.h).
  * @return void
  */
-void executarExperimentoTamanhoFixo(int tipo, double tempos[], long comparacoes[], long trocas[], int tamanho)
+void executarBenchmarkLatencia()
 {
-    int *vetor = malloc(tamanho * sizeof(int));
-    struct timespec inicio, fim;
+    latenciaExecutar("shellSort", shellSort, gerarVetor, nomesVariantes[varianteAtiva]);
+    pausar();
+}
 
-    for (int i = 0; i < REPETICOES; i++)
+/* ================= HIERARQUIA DE CACHE ================= */
+/**
+ * @brief Benchmark de escalabilidade na hierarquia de cache. Os tamanhos do vetor (em bytes) vêm de
+ *        tamanhosHierarquia() (potências de 2 e pontos em torno de cada nível lido de /sys), até o
+ *        maior vetor escolhido. Cada variante suportada do shellSort() ordena o mesmo vetor aleatório
+ *        (prefixos de uma única entrada) com medirHierarquia().
+ *        Por tamanho, o CSV traz elementos/s, bytes acessados por elemento (uma leitura de int por
+ *        comparação e uma escrita por deslocamento) e a largura de banda efetiva resultante; os
+ *        níveis de cache vêm numa segunda tabela, após uma linha em branco, para os gráficos.
+ * @return void
+ */
+void executarBenchmarkHierarquia()
+{
+    NivelCache niveis[MAX_NIVEIS_CACHE];
+    int num_niveis = lerHierarquiaCache(niveis, MAX_NIVEIS_CACHE);
+
+    long limite = (long)HIERARQUIA_LIMITE_MB << 20;
+    if (num_niveis > 0 && 4 * niveis[num_niveis - 1].bytes < limite)
+        limite = 4 * niveis[num_niveis - 1].bytes;
+
+    long limite_mb;
+    printf("Maior vetor em MB (0 = padrao, %ld MB): ", (limite + (1 << 20) - 1) >> 20);
+    if (scanf("%ld", &limite_mb) == 1 && limite_mb > 0)
+        limite = limite_mb << 20;
+    if (limite / (long)sizeof(int) > 1L << 30)
+        limite = (1L << 30) * (long)sizeof(int);
+
+    long tamanhos[MAX_TAMANHOS_HIERARQUIA];
+    int num_tamanhos = tamanhosHierarquia(niveis, num_niveis, limite, tamanhos);
+
+    long maior = tamanhos[num_tamanhos - 1] / (long)sizeof(int);
+    int *original = malloc(maior * sizeof(int));
+    int *v = malloc(maior * sizeof(int));
+    double *tempos = malloc(HIERARQUIA_MAX_REPETICOES * sizeof(double));
+    if (!original || !v || !tempos)
     {
-        gerarVetor(vetor, tipo, tamanho);
+        printf("Erro ao alocar memoria!\n");
+        free(original);
+        free(v);
+        free(tempos);
+        pausar();
+        return;
+    }
 
-        printf("=====================================\n");
-        printf(" Execução %d", i + 1);
-        if (i < QTD_DESCARTES)
-        {
-            printf(" (SERA DESCARTADA)");
-        }
-        printf("\n");
-        printf("=====================================\n");
+    time_t agora = time(NULL);
+    struct tm *info = localtime(&agora);
+    char nomeCSV[150];
 
-        printf("Vetor antes da ordenação:\n");
-        imprimirVetor(vetor, tamanho);
+    sprintf(nomeCSV, "../results/files/shellSort/shellsort_hierarquia_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+            info->tm_year + 1900, info->tm_mon + 1, info->tm_mday,
+            info->tm_hour, info->tm_min, info->tm_sec);
 
-        clock_gettime(CLOCK_MONOTONIC, &inicio);
-        shellSort(vetor, tamanho, &comparacoes[i], &trocas[i]);
-        clock_gettime(CLOCK_MONOTONIC, &fim);
+    FILE *csv = fopen(nomeCSV, "w");
+    if (!csv)
+    {
+        printf("Erro ao criar o arquivo CSV do benchmark de hierarquia.\n");
+        free(original);
+        free(v);
+        free(tempos);
+        pausar();
+        return;
+    }
+    ambienteCabecalho(csv);
+    cabecalhoCSVHierarquia(csv);
 
-        tempos[i] = medirTempo(inicio, fim);
+    printf("\n========================================\n");
+    printf("   HIERARQUIA DE CACHE (gaps %s)\n", nomesSequencias[perfilAtivo.sequencia_gaps]);
+    printf("========================================\n");
+    exibirNiveisHierarquia(niveis, num_niveis, tamanhos, num_tamanhos);
 
-        printf("\nVetor após a ordenação:\n");
-        imprimirVetor(vetor, tamanho);
+    uint32_t estado = iniciarGerador(TESTE_GERAL_SEMENTE); /* Local: não fixa o rand() das próximas opções */
+    gerarVetorComEstado(original, 3, (int)maior, &estado);
+    int variante_inicial = varianteAtiva;
+
+    for (int var = 0; var < NUM_VARIANTES; var++)
+    {
+        if (!varianteSuportada(var))
+            continue;
+        varianteAtiva = var;
+        cabecalhoTabelaHierarquia(nomesVariantes[var]);
+
+        for (int t = 0; t < num_tamanhos; t++)
+        {
+            char nivel[8];
+            nivelDoTamanho(tamanhos[t], niveis, num_niveis, nivel, sizeof(nivel));
+            MedicaoHierarquia m = medirHierarquia(shellSort, "Shell Sort", original, v,
+                                                  (int)(tamanhos[t] / (long)sizeof(int)), tempos);
+            registrarHierarquia(csv, nomesVariantes[var], nomesSequencias[perfilAtivo.sequencia_gaps], tamanhos[t],
+                                nivel, m);
+        }
     }
+    varianteAtiva = variante_inicial;
+    salvarNiveisHierarquia(csv, niveis, num_niveis);
 
-    free(vetor);
+    fclose(csv);
+    free(original);
+    free(v);
+    free(tempos);
+    printf("\nCSV do benchmark de hierarquia salvo em: %s\n", nomeCSV);
+    pausar();
 }
 
+/* ================= MODO SOAK ================= */
 /**
- * @brief Processa e salva os resultados do experimento.
- * @param opcao Tipo de vetor: 1 - crescente, 2 - decrescente, 3 - aleatório.
- * @param tempos Vetor para armazenar os tempos de execução.
- * @param comparacoes Vetor para armazenar o número de comparações.
- * @param trocas Vetor para armazenar o número de trocas.
+ * @brief Modo soak com o shellSort() como kernel: ordenações contínuas com histograma HDR de latência
+ *        por janela e sensores do processador (soakExecutar(), execucaoLonga.h).
  * @return void
  */
-void processarResultados(int opcao, double tempos[], long comparacoes[], long trocas[])
+void executarSoak()
 {
-    // Calcular estatísticas descartando as primeiras QTD_DESCARTES repetições
-    int inicio_estat = QTD_DESCARTES;
-    int fim_estat = REPETICOES - 1;
-    int repeticoes_validas = REPETICOES - QTD_DESCARTES;
+    soakExecutar("shellSort", shellSort, gerarVetor, TAM_MAX, nomesVariantes[varianteAtiva]);
+    pausar();
+}
 
-    if (repeticoes_validas <= 0)
-    {
-        printf("Erro: Nenhuma repeticao valida apos descarte!\n");
-        pausar();
-        return;
-    }
+/**
+ * @brief Consulta e manutenção do cache de resultados do teste geral (cacheResultados.h).
+ * @return void
+ */
+void executarMenuCache()
+{
+    int escolha;
+    char filtro[128] = "";
 
-    double media = calcularMediaDouble(tempos, inicio_estat, fim_estat);
-    double desvio = calcularDesvioPadraoDouble(tempos, inicio_estat, fim_estat, media);
-    double mediaComparacoes = calcularMediaLong(comparacoes, inicio_estat, fim_estat);
-    double mediaTrocas = calcularMediaLong(trocas, inicio_estat, fim_estat);
+    limpar_tela();
+    printf("=====================================\n");
+    printf("      CACHE DE RESULTADOS\n");
+    printf("=====================================\n");
+    printf("Pasta: %s%s\n", cacheEstado.pasta, cacheEstado.ativo ? "" : " (desligado: ORDENACAO_CACHE=0)");
+    printf("1 - Listar entradas\n");
+    printf("2 - Invalidar todas as entradas\n");
+    printf("3 - Invalidar por filtro (trecho da descricao, ex.: ;aleatorio;60000 ou ;crescente;)\n");
+    printf("4 - Remover entradas de outros builds\n");
+    printf("Escolha: ");
+    if (scanf("%d", &escolha) != 1)
+        escolha = 0;
 
-    char *tipo;
-    if (opcao == 1)
-        tipo = "crescente";
-    else if (opcao == 2)
-        tipo = "decrescente";
+    if (escolha == 1)
+        cachePercorrer(NULL, 0, 0);
+    else if (escolha == 2)
+        cachePercorrer(NULL, 0, 1);
+    else if (escolha == 3)
+    {
+        printf("Filtro: ");
+        if (scanf("%127s", filtro) == 1)
+            cachePercorrer(filtro, 0, 1);
+    }
+    else if (escolha == 4)
+        cachePercorrer(NULL, 1, 1);
     else
-        tipo = "aleatorio";
+        printf("Opcao invalida!\n");
 
-    salvarResultados(tipo, TAM_VETOR, tempos, comparacoes, trocas,
-                     media, desvio, mediaComparacoes, mediaTrocas);
-
-    printf("\nResultados salvos com sucesso!\n");
-    printf("Estatisticas calculadas com %d repeticoes validas (descartadas %d primeiras)\n",
-           repeticoes_validas, QTD_DESCARTES);
     pausar();
 }
 
@@ -592,11 +4641,27 @@ int menu()
     printf("  Repeticoes: %d\n", REPETICOES);
     printf("  Descartes: %d\n", QTD_DESCARTES);
     printf("  Repeticoes validas: %d\n", REPETICOES - QTD_DESCARTES);
+    printf("  Variante: %s (ORDENACAO_VARIANTE; auto = mais larga da CPU)\n", nomesVariantes[varianteAtiva]);
+    printf("  Perfil de ajuste: %s (gaps %s)\n", arquivoPerfil[0] ? arquivoPerfil : "padrao",
+           nomesSequencias[perfilAtivo.sequencia_gaps]);
     printf("=====================================\n");
     printf(" 1 - Vetor Crescente\n");
     printf(" 2 - Vetor Decrescente\n");
     printf(" 3 - Vetor Aleatorio\n");
     printf(" 4 - Teste Geral (todos os casos)\n");
+    printf(" 5 - Benchmark de Lote (vetores pequenos)\n");
+    printf(" 6 - Micro-benchmark de Redes de Ordenacao\n");
+    printf(" 7 - Benchmark de Registros (ordenacao indireta)\n");
+    printf(" 8 - Benchmark AoS x SoA (chave + colunas de carga)\n");
+    printf(" 9 - Benchmark de Selecao (top-k, n-esimo, ordenacao parcial)\n");
+    printf("10 - Benchmark de Atualizacao Incremental (insercao/remocao/alteracao em lote)\n");
+    printf("11 - Ordenacao Paralela (escalabilidade forte e fraca)\n");
+    printf("12 - Autoajuste (gera o perfil de ajuste deste host)\n");
+    printf("13 - Modo Soak (execucao continua com histograma de latencia)\n");
+    printf("14 - Latencia de Ordenacoes Pequenas (TSC, 8 a 4096 elementos)\n");
+    printf("15 - Cache de Resultados do Teste Geral (listar / invalidar)\n");
+    printf("16 - Hierarquia de Cache (L1/L2/L3/DRAM: elementos/s e largura de banda)\n");
+    printf("17 - Benchmark de Strings (prefixo em linha x strcmp)\n");
     printf(" 0 - Sair\n");
     printf("=====================================\n");
     printf(" Escolha uma opcao: ");
@@ -620,10 +4685,68 @@ void executarOpcao(int opcao)
 
     if (confirmar("Deseja iniciar a execucao?"))
     {
+        /* Pré-voo: impressão digital do ambiente e fontes de ruído (o menu do cache não mede nada) */
+        if (opcao != 15 && !ambientePreparar("shellSort"))
+        {
+            pausar();
+            return;
+        }
         if (opcao == 4)
         {
             executarTesteGeral();
         }
+        else if (opcao == 5)
+        {
+            executarBenchmarkLote();
+        }
+        else if (opcao == 6)
+        {
+            executarBenchmarkRedes();
+        }
+        else if (opcao == 7)
+        {
+            executarBenchmarkRegistros();
+        }
+        else if (opcao == 8)
+        {
+            executarBenchmarkSoA();
+        }
+        else if (opcao == 9)
+        {
+            executarBenchmarkSelecao();
+        }
+        else if (opcao == 10)
+        {
+            executarBenchmarkIncremental();
+        }
+        else if (opcao == 11)
+        {
+            executarBenchmarkParalelo();
+        }
+        else if (opcao == 12)
+        {
+            executarAutoajuste();
+        }
+        else if (opcao == 13)
+        {
+            executarSoak();
+        }
+        else if (opcao == 14)
+        {
+            executarBenchmarkLatencia();
+        }
+        else if (opcao == 15)
+        {
+            executarMenuCache();
+        }
+        else if (opcao == 16)
+        {
+            executarBenchmarkHierarquia();
+        }
+        else if (opcao == 17)
+        {
+            executarBenchmarkStrings();
+        }
         else
         {
             executarExperimentoTamanhoFixo(opcao, tempos, comparacoes, trocas, TAM_VETOR);
@@ -632,10 +4755,288 @@ void executarOpcao(int opcao)
     }
 }
 
+#ifdef ORDENACAO_BIBLIOTECA
+/* ================= INTERFACE DA BIBLIOTECA ================= */
+#include "ordenacao.h"
+
+pthread_once_t inicializacaoBiblioteca = PTHREAD_ONCE_INIT;
+
+/* Pool de ordenacaoShellSortParalelo(), criado na primeira chamada e reaproveitado nas seguintes.
+   Chamadas simultâneas usam o pool uma por vez: cada uma já ocupa todas as threads dele */
+PoolTrabalho *poolBiblioteca = NULL;
+int threadsPoolBiblioteca = 0; /* Número de threads pedido na criação (0 = perfil ou todos os núcleos) */
+pthread_mutex_t travaPoolBiblioteca = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Configuração que main() faz nos programas: perfil de ajuste e variante do kernel.
+ */
+void inicializarBiblioteca()
+{
+    carregarPerfil(caminhoPerfil());
+    selecionarVariante();
+}
+
+/**
+ * @brief Valida vetor e tamanho recebidos pela interface e inicializa a biblioteca na primeira chamada.
+ * @return ORDENACAO_OK ou o código de erro.
+ */
+int validarEntradaBiblioteca(const int32_t *v, int64_t n)
+{
+    if (n < 0 || n > INT32_MAX)
+        return ORDENACAO_ERRO_TAMANHO;
+    if (!v && n > 0)
+        return ORDENACAO_ERRO_ARGUMENTO;
+    pthread_once(&inicializacaoBiblioteca, inicializarBiblioteca);
+    return ORDENACAO_OK;
+}
+
+ORDENACAO_API const char *ordenacaoVarianteShellSort(void)
+{
+    pthread_once(&inicializacaoBiblioteca, inicializarBiblioteca);
+    return nomesVariantes[varianteAtiva];
+}
+
+ORDENACAO_API int ordenacaoShellSort(int32_t *v, int64_t n, ContadoresOrdenacao *contadores)
+{
+    int erro = validarEntradaBiblioteca(v, n);
+    if (erro != ORDENACAO_OK)
+        return erro;
+
+    long comparacoes = 0, trocas = 0;
+    if (n > 1)
+        shellSort(v, (int)n, &comparacoes, &trocas);
+    if (contadores)
+    {
+        contadores->comparacoes = comparacoes;
+        contadores->trocas = trocas;
+    }
+    return ORDENACAO_OK;
+}
+
+ORDENACAO_API int ordenacaoShellSortParalelo(int32_t *v, int64_t n, int threads)
+{
+    int erro = validarEntradaBiblioteca(v, n);
+    if (erro != ORDENACAO_OK)
+        return erro;
+    if (threads < 0)
+        return ORDENACAO_ERRO_ARGUMENTO;
+    if (n < 2)
+        return ORDENACAO_OK;
+    if (threads > MAX_THREADS)
+        threads = MAX_THREADS;
+
+    pthread_mutex_lock(&travaPoolBiblioteca);
+    if (poolBiblioteca && threadsPoolBiblioteca != threads)
+    {
+        destruirPool(poolBiblioteca);
+        poolBiblioteca = NULL;
+    }
+    if (!poolBiblioteca)
+    {
+        poolBiblioteca = criarPool(threads);
+        threadsPoolBiblioteca = threads;
+    }
+    int ok = poolBiblioteca && shellSortParaleloPool(poolBiblioteca, v, (int)n, NULL);
+    pthread_mutex_unlock(&travaPoolBiblioteca);
+    return ok ? ORDENACAO_OK : ORDENACAO_ERRO_MEMORIA;
+}
+
+ORDENACAO_API int ordenacaoSelecionarNesimo(int32_t *v, int64_t n, int64_t k, int32_t *valor)
+{
+    int erro = validarEntradaBiblioteca(v, n);
+    if (erro != ORDENACAO_OK)
+        return erro;
+    if (k < 0 || k >= n)
+        return ORDENACAO_ERRO_ARGUMENTO;
+
+    long comparacoes = 0, trocas = 0;
+    int resultado = selecionarNesimo(v, (int)n, (int)k, &comparacoes, &trocas);
+    if (valor)
+        *valor = resultado;
+    return ORDENACAO_OK;
+}
+
+ORDENACAO_API int ordenacaoOrdenarParcial(int32_t *v, int64_t n, int64_t k)
+{
+    int erro = validarEntradaBiblioteca(v, n);
+    if (erro != ORDENACAO_OK)
+        return erro;
+    if (k < 0 || k > n)
+        return ORDENACAO_ERRO_ARGUMENTO;
+
+    long comparacoes = 0, trocas = 0;
+    if (k > 0)
+        ordenarParcial(v, (int)n, (int)k, &comparacoes, &trocas);
+    return ORDENACAO_OK;
+}
+
+ORDENACAO_API int ordenacaoGerarVetor(int32_t *v, int64_t n, int tipo, unsigned int semente)
+{
+    int erro = validarEntradaBiblioteca(v, n);
+    if (erro != ORDENACAO_OK)
+        return erro;
+    if (tipo < 1 || tipo > 3)
+        return ORDENACAO_ERRO_ARGUMENTO;
+    if (tipo != 3 && n > TAM_MAX)
+        return ORDENACAO_ERRO_TAMANHO;
+
+    /* Gerador local: não toca no rand() do processo hospedeiro e é seguro entre threads */
+    uint32_t estado = iniciarGerador(semente);
+    if (n > 0)
+        gerarVetorComEstado(v, tipo, (int)n, &estado);
+    return ORDENACAO_OK;
+}
+#else
+/* ================= MODOS DE LINHA DE COMANDO ================= */
+/**
+ * @brief Ordena uma cópia de entrada com a função indicada e verifica a saída.
+ * @return Número de ordenações executadas (1).
+ */
+int treinarOrdenacao(const int entrada[], int v[], int tamanho, const char *cenario, int tipo_ordenacao)
+{
+    long comparacoes, trocas;
+    memcpy(v, entrada, tamanho * sizeof(int));
+    ImpressaoVetor impressao = impressaoVetor(v, tamanho);
+
+    if (tipo_ordenacao == 0)
+        shellSort(v, tamanho, &comparacoes, &trocas);
+    else
+        shellSortParalelo(v, tamanho, 0, NULL);
+
+    verificarOrdenacao(&impressao, v, tamanho, "Shell Sort (treino)", cenario, 1);
+    return 1;
+}
+
+/**
+ * @brief Modo --treino: percorre sem interação uma mistura representativa dos cenários do harness
+ *        (teste geral, vetores pequenos, vetores grandes, seleção e ordenação paralela), com todas as
+ *        saídas verificadas e nenhum arquivo gravado. Usado para coletar o perfil da compilação PGO.
+ * @return 0 em caso de sucesso, 1 em caso de erro de alocação.
+ */
+int executarTreino()
+{
+    const int TAMANHO_GRANDE = 1000000;
+    int tamanhos_gerais[] = {20000, 40000, 60000};
+    int tamanhos_pequenos[] = {8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+    char *nomes_cenarios[] = {"crescente", "decrescente", "aleatorio"};
+    int *entrada = malloc(TAMANHO_GRANDE * sizeof(int));
+    int *v = malloc(TAMANHO_GRANDE * sizeof(int));
+    long comparacoes, trocas;
+    int ordenacoes = 0;
+
+    if (!entrada || !v)
+    {
+        printf("Erro ao alocar memoria!\n");
+        free(entrada);
+        free(v);
+        return 1;
+    }
+
+    struct timespec inicio, fim;
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+    srand(TREINO_SEMENTE);
+
+    /* Mesma mistura do teste geral */
+    for (int t = 0; t < 3; t++)
+        for (int c = 0; c < 3; c++)
+            for (int r = 0; r < TREINO_REPETICOES; r++)
+            {
+                gerarVetor(entrada, c + 1, tamanhos_gerais[t]);
+                ordenacoes += treinarOrdenacao(entrada, v, tamanhos_gerais[t], nomes_cenarios[c], 0);
+            }
+
+    /* Vetores pequenos, como no benchmark de latência */
+    for (int t = 0; t < 10; t++)
+    {
+        int tamanho = tamanhos_pequenos[t];
+        for (int e = 0; e + tamanho <= LATENCIA_ELEMENTOS; e += tamanho)
+        {
+            gerarVetor(entrada, 3, tamanho);
+            ordenacoes += treinarOrdenacao(entrada, v, tamanho, "aleatorio", 0);
+        }
+    }
+
+    /* Vetor grande: sequencial, paralelo, seleção e ordenação parcial */
+    gerarVetor(entrada, 3, TAMANHO_GRANDE);
+    ordenacoes += treinarOrdenacao(entrada, v, TAMANHO_GRANDE, "aleatorio", 0);
+    ordenacoes += treinarOrdenacao(entrada, v, TAMANHO_GRANDE, "aleatorio", 1);
+
+    memcpy(v, entrada, TAMANHO_GRANDE * sizeof(int));
+    selecionarNesimo(v, TAMANHO_GRANDE, TAMANHO_GRANDE / 2, &comparacoes, &trocas);
+    memcpy(v, entrada, TAMANHO_GRANDE * sizeof(int));
+    ordenarParcial(v, TAMANHO_GRANDE, 1000, &comparacoes, &trocas);
+
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+    printf("Treino concluido: %d ordenacoes verificadas em %.1f s (variante %s)\n",
+           ordenacoes, medirTempo(inicio, fim) / 1000.0, nomesVariantes[varianteAtiva]);
+
+    free(entrada);
+    free(v);
+    return 0;
+}
+
+/**
+ * @brief Trata as opções de linha de comando (modo não interativo).
+ *          --treino  mistura de cenários para coleta de perfil (PGO)
+ *          --geral   teste geral sem menus, gravando os arquivos de sempre em ../results/files/
+ *          --cache-* consulta e invalidação do cache de resultados do teste geral
+ * @return Código de saída do programa.
+ */
+int executarLinhaComando(int argc, char *argv[])
+{
+    const char *opcao = argv[1];
+    const char *filtro = argc > 2 ? argv[2] : NULL;
+
+    if (strcmp(opcao, "--treino") == 0)
+        return executarTreino();
+
+    if (strcmp(opcao, "--geral") == 0)
+    {
+        modoInterativo = 0;
+        if (!ambientePreparar("shellSort"))
+            return 1;
+        executarTesteGeral();
+        return 0;
+    }
+
+    if (strcmp(opcao, "--cache-listar") == 0)
+    {
+        cachePercorrer(filtro, 0, 0);
+        return 0;
+    }
+
+    if (strcmp(opcao, "--cache-invalidar") == 0)
+    {
+        cachePercorrer(filtro, 0, 1);
+        return 0;
+    }
+
+    if (strcmp(opcao, "--cache-obsoletas") == 0)
+    {
+        cachePercorrer(filtro, 1, 1);
+        return 0;
+    }
+
+    printf("Uso: %s [--treino | --geral | --cache-listar [filtro] | --cache-invalidar [filtro] | "
+           "--cache-obsoletas]\n", argv[0]);
+    printf("  sem opcoes  menu interativo\n");
+    printf("  --treino    executa a mistura de cenarios usada para coletar o perfil PGO\n");
+    printf("  --geral     executa o teste geral sem interacao (ORDENACAO_ESTRITO=1 recusa ambientes ruidosos)\n");
+    printf("  --cache-listar [filtro]     lista as celulas do teste geral guardadas no cache\n");
+    printf("  --cache-invalidar [filtro]  remove as celulas cuja descricao contem o filtro (todas se omitido)\n");
+    printf("  --cache-obsoletas           remove as celulas gravadas por outros builds do programa\n");
+    return 1;
+}
+
 /* ================= MAIN ================= */
-int main()
+int main(int argc, char *argv[])
 {
     srand(time(NULL));
+    carregarPerfil(caminhoPerfil());
+    selecionarVariante();
+    cacheIniciar("shellSort");
+    if (telemetriaIniciar("shellSort"))
+        telemetriaAmbiente(nomesVariantes[varianteAtiva]);
     int executando = 1;
 
     // Validação das constantes
@@ -648,6 +5049,13 @@ int main()
         return 1;
     }
 
+    if (argc > 1)
+    {
+        int codigo = executarLinhaComando(argc, argv);
+        telemetriaEncerrar();
+        return codigo;
+    }
+
     while (executando)
     {
         int opcao = menu();
@@ -665,6 +5073,19 @@ int main()
         case 2:
         case 3:
         case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+        case 15:
+        case 16:
+        case 17:
             executarOpcao(opcao);
             break;
 
@@ -675,5 +5096,7 @@ int main()
         }
     }
 
+    telemetriaEncerrar();
     return 0;
-}
\ No newline at end of file
+}
+#endif
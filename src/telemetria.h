@@ -0,0 +1,393 @@
+/*  ==================================================================
+ *  TELEMETRIA ESTRUTURADA DOS BENCHMARKS
+ *  Fluxo de eventos em JSON lines (um objeto por linha) para acompanhar
+ *  varreduras longas ao vivo: início/fim de cada experimento, cada
+ *  repetição medida e instantâneos do ambiente.
+ *
+ *  O destino é lido da variável ORDENACAO_TELEMETRIA (arquivo comum ou
+ *  pipe nomeado criado com mkfifo). Sem ela, os eventos são descartados
+ *  sem custo. O destino é aberto e gravado sem bloquear: um pipe sem
+ *  leitor é reaberto em intervalos fixos por até TELEMETRIA_TENTATIVAS
+ *  vezes, e um leitor parado faz a gravação desistir após um prazo. Nos
+ *  dois casos os eventos são descartados e contados, e o encerramento
+ *  espera o escritor por tempo limitado.
+ *
+ *  O programa só copia campos de tamanho fixo para um buffer circular
+ *  lock-free (um produtor, um consumidor, atomics do C11). Uma thread em
+ *  segundo plano formata o JSON e grava no destino, de modo que emitir um
+ *  evento não faz syscalls nem formatação. Se o buffer encher, o evento é
+ *  descartado e contado; o benchmark nunca espera pelo escritor.
+ *  ==================================================================*/
+#ifndef TELEMETRIA_H
+#define TELEMETRIA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define TELEMETRIA_CAPACIDADE 4096 /* Eventos no buffer circular (potência de 2) */
+#define TELEMETRIA_ESPERA_NS 1000000L /* Pausa do escritor quando o buffer está vazio (1 ms) */
+#define TELEMETRIA_REABRIR_NS 100000000LL /* Intervalo entre tentativas de abrir um pipe sem leitor (100 ms) */
+#define TELEMETRIA_TENTATIVAS 50 /* Tentativas de abertura (5 s) antes de desistir do destino */
+#define TELEMETRIA_LIMITE_ESCRITA_MS 1000 /* Espera máxima por espaço no pipe a cada gravação */
+#define TELEMETRIA_LIMITE_ENCERRAR_MS 2000 /* Espera máxima pelo escritor no encerramento */
+#define TELEMETRIA_LOTE 16384 /* Bytes formatados por gravação */
+#define TELEMETRIA_MAX_LINHA 512 /* Maior linha JSON de um evento */
+
+#define EVENTO_REPETICAO 0
+#define EVENTO_INICIO_EXPERIMENTO 1
+#define EVENTO_FIM_EXPERIMENTO 2
+#define EVENTO_AMBIENTE 3
+
+typedef struct
+{
+    int tipo; /* EVENTO_* */
+    long long instante_ns; /* CLOCK_REALTIME no momento da emissão */
+    char algoritmo[24];
+    char cenario[20];
+    char variante[16];
+    int tamanho;
+    int repeticao;
+    double tempo_ms;
+    long comparacoes;
+    long trocas;
+} EventoTelemetria;
+
+typedef struct
+{
+    EventoTelemetria eventos[TELEMETRIA_CAPACIDADE];
+    atomic_size_t cabeca;     /* Próxima posição a escrever (só o produtor altera) */
+    atomic_size_t cauda;      /* Próxima posição a ler (só o escritor altera) */
+    atomic_int encerrar;
+    atomic_int terminou;      /* O escritor saiu do laço e fechou o destino */
+    atomic_long descartados;  /* Eventos perdidos por buffer cheio ou destino fechado */
+    int ativa;
+    char destino[256];
+    char programa[32];
+    pthread_t escritor;
+} EstadoTelemetria;
+
+static EstadoTelemetria telemetria;
+
+/**
+ * @brief Copia uma string para um campo de tamanho fixo, truncando se preciso.
+ */
+static inline void telemetriaCopiar(char destino[], size_t tamanho, const char *origem)
+{
+    size_t n = origem ? strlen(origem) : 0;
+    if (n >= tamanho)
+        n = tamanho - 1;
+    memcpy(destino, origem ? origem : "", n);
+    destino[n] = '\0';
+}
+
+/**
+ * @brief Acrescenta texto formatado ao lote (truncado se não couber).
+ */
+static inline void telemetriaAnexar(char lote[], size_t tamanho, size_t *usado, const char *formato, ...)
+{
+    if (*usado >= tamanho)
+        return;
+    va_list args;
+    va_start(args, formato);
+    int n = vsnprintf(lote + *usado, tamanho - *usado, formato, args);
+    va_end(args);
+    if (n > 0)
+        *usado = (size_t)n < tamanho - *usado ? *usado + (size_t)n : tamanho - 1;
+}
+
+/**
+ * @brief Formata um evento como uma linha JSON no lote (executado apenas na thread escritora).
+ */
+static inline void telemetriaGravar(char lote[], size_t tamanho, size_t *usado, const EventoTelemetria *e)
+{
+    static const char *nomes[] = {"repeticao", "inicio_experimento", "fim_experimento", "ambiente"};
+
+    telemetriaAnexar(lote, tamanho, usado, "{\"ts_ns\":%lld,\"programa\":\"%s\",\"evento\":\"%s\"",
+                     e->instante_ns, telemetria.programa, nomes[e->tipo]);
+
+    if (e->tipo == EVENTO_AMBIENTE)
+    {
+        char host[64] = "";
+        double carga[3] = {0.0, 0.0, 0.0};
+        FILE *loadavg = fopen("/proc/loadavg", "r");
+        if (loadavg)
+        {
+            if (fscanf(loadavg, "%lf %lf %lf", &carga[0], &carga[1], &carga[2]) != 3)
+                carga[0] = carga[1] = carga[2] = 0.0;
+            fclose(loadavg);
+        }
+        gethostname(host, sizeof(host) - 1);
+        telemetriaAnexar(lote, tamanho, usado,
+                         ",\"pid\":%d,\"host\":\"%s\",\"nucleos\":%ld,\"carga\":[%.2f,%.2f,%.2f],\"variante\":\"%s\"",
+                         (int)getpid(), host, sysconf(_SC_NPROCESSORS_ONLN), carga[0], carga[1], carga[2],
+                         e->variante);
+    }
+    else
+    {
+        telemetriaAnexar(lote, tamanho, usado, ",\"algoritmo\":\"%s\",\"cenario\":\"%s\",\"tamanho\":%d",
+                         e->algoritmo, e->cenario, e->tamanho);
+        if (e->tipo == EVENTO_REPETICAO)
+            telemetriaAnexar(lote, tamanho, usado,
+                             ",\"repeticao\":%d,\"tempo_ms\":%.3f,\"comparacoes\":%ld,\"trocas\":%ld,\"variante\":\"%s\"",
+                             e->repeticao, e->tempo_ms, e->comparacoes, e->trocas, e->variante);
+    }
+    telemetriaAnexar(lote, tamanho, usado, "}\n");
+}
+
+static inline long long telemetriaAgoraNs()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (long long)t.tv_sec * 1000000000LL + t.tv_nsec;
+}
+
+/**
+ * @brief Grava o lote no destino não bloqueante, esperando (poll) por até TELEMETRIA_LIMITE_ESCRITA_MS
+ *        se o pipe estiver cheio.
+ * @return 1 se tudo foi gravado, 0 se o prazo esgotou ou a gravação falhou (leitor parado ou fechado).
+ */
+static inline int telemetriaEnviar(int fd, const char *dados, size_t n)
+{
+    long long prazo = telemetriaAgoraNs() + TELEMETRIA_LIMITE_ESCRITA_MS * 1000000LL;
+
+    while (n > 0)
+    {
+        ssize_t escritos = write(fd, dados, n);
+        if (escritos > 0)
+        {
+            dados += escritos;
+            n -= (size_t)escritos;
+            continue;
+        }
+        if (escritos < 0 && errno == EINTR)
+            continue;
+        if (escritos == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+            return 0;
+
+        long long agora = telemetriaAgoraNs();
+        if (agora >= prazo)
+            return 0;
+        struct pollfd monitorado = {.fd = fd, .events = POLLOUT};
+        if (poll(&monitorado, 1, (int)((prazo - agora + 999999LL) / 1000000LL)) < 0 && errno != EINTR)
+            return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Thread escritora: esvazia o buffer circular no destino e dorme quando não há eventos.
+ *        O destino é aberto com O_NONBLOCK: um pipe sem leitor falha com ENXIO e é reaberto a cada
+ *        TELEMETRIA_REABRIR_NS, até TELEMETRIA_TENTATIVAS vezes. Sem destino aberto, ou depois de
+ *        uma gravação que esgotou o prazo, os eventos são descartados e contados.
+ */
+static inline void *telemetriaEscritor(void *arg)
+{
+    (void)arg;
+    char lote[TELEMETRIA_LOTE];
+    int fd = -1;
+    int tentativas = 0;
+    long long proxima_tentativa = 0;
+
+    /* Leitor que fecha o pipe: write() devolve EPIPE em vez de encerrar o processo */
+    sigset_t sinais;
+    sigemptyset(&sinais);
+    sigaddset(&sinais, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &sinais, NULL);
+
+    for (;;)
+    {
+        if (fd < 0 && tentativas < TELEMETRIA_TENTATIVAS && telemetriaAgoraNs() >= proxima_tentativa)
+        {
+            fd = open(telemetria.destino, O_WRONLY | O_NONBLOCK | O_APPEND | O_CREAT, 0644);
+            if (fd < 0)
+            {
+                tentativas = errno == ENXIO ? tentativas + 1 : TELEMETRIA_TENTATIVAS;
+                proxima_tentativa = telemetriaAgoraNs() + TELEMETRIA_REABRIR_NS;
+                if (tentativas == TELEMETRIA_TENTATIVAS)
+                    fprintf(stderr, "AVISO: nao foi possivel abrir o destino da telemetria: %s (%s)\n",
+                            telemetria.destino, errno == ENXIO ? "pipe sem leitor" : strerror(errno));
+            }
+        }
+
+        size_t cauda = atomic_load_explicit(&telemetria.cauda, memory_order_relaxed);
+        size_t cabeca = atomic_load_explicit(&telemetria.cabeca, memory_order_acquire);
+
+        if (cauda == cabeca)
+        {
+            if (atomic_load_explicit(&telemetria.encerrar, memory_order_acquire) &&
+                atomic_load_explicit(&telemetria.cabeca, memory_order_acquire) == cauda)
+                break;
+            struct timespec pausa = {0, TELEMETRIA_ESPERA_NS};
+            nanosleep(&pausa, NULL);
+            continue;
+        }
+
+        size_t usado = 0;
+        for (; cauda != cabeca; cauda++)
+        {
+            if (fd < 0)
+            {
+                atomic_fetch_add_explicit(&telemetria.descartados, 1, memory_order_relaxed);
+                continue;
+            }
+            telemetriaGravar(lote, sizeof(lote), &usado, &telemetria.eventos[cauda & (TELEMETRIA_CAPACIDADE - 1)]);
+            if (usado > sizeof(lote) - TELEMETRIA_MAX_LINHA || cauda + 1 == cabeca)
+            {
+                if (!telemetriaEnviar(fd, lote, usado))
+                {
+                    fprintf(stderr, "AVISO: leitor da telemetria parado ou fechado; eventos seguintes descartados\n");
+                    close(fd);
+                    fd = -1;
+                    tentativas = TELEMETRIA_TENTATIVAS;
+                }
+                usado = 0;
+            }
+        }
+        atomic_store_explicit(&telemetria.cauda, cauda, memory_order_release);
+    }
+
+    if (fd >= 0)
+    {
+        long descartados = atomic_load(&telemetria.descartados);
+        if (descartados > 0)
+        {
+            size_t usado = 0;
+            telemetriaAnexar(lote, sizeof(lote), &usado,
+                             "{\"programa\":\"%s\",\"evento\":\"descartados\",\"quantidade\":%ld}\n",
+                             telemetria.programa, descartados);
+            telemetriaEnviar(fd, lote, usado);
+        }
+        close(fd);
+    }
+    atomic_store_explicit(&telemetria.terminou, 1, memory_order_release);
+    return NULL;
+}
+
+/**
+ * @brief Inicia a telemetria se ORDENACAO_TELEMETRIA estiver definida.
+ * @param programa Nome do programa gravado em cada evento.
+ * @return 1 se a telemetria foi ativada, 0 caso contrário.
+ */
+static inline int telemetriaIniciar(const char *programa)
+{
+    const char *destino = getenv("ORDENACAO_TELEMETRIA");
+    if (!destino || !*destino || telemetria.ativa)
+        return 0;
+
+    telemetriaCopiar(telemetria.destino, sizeof(telemetria.destino), destino);
+    telemetriaCopiar(telemetria.programa, sizeof(telemetria.programa), programa);
+    atomic_init(&telemetria.cabeca, 0);
+    atomic_init(&telemetria.cauda, 0);
+    atomic_init(&telemetria.encerrar, 0);
+    atomic_init(&telemetria.terminou, 0);
+    atomic_init(&telemetria.descartados, 0);
+
+    if (pthread_create(&telemetria.escritor, NULL, telemetriaEscritor, NULL) != 0)
+        return 0;
+    telemetria.ativa = 1;
+    return 1;
+}
+
+/**
+ * @brief Coloca um evento no buffer circular. Chamado apenas pela thread do benchmark,
+ *        fora das regiões medidas; descarta o evento se o buffer estiver cheio.
+ */
+static inline void telemetriaEmitir(int tipo, const char *algoritmo, const char *cenario, int tamanho,
+                                    int repeticao, double tempo_ms, long comparacoes, long trocas,
+                                    const char *variante)
+{
+    if (!telemetria.ativa)
+        return;
+
+    size_t cabeca = atomic_load_explicit(&telemetria.cabeca, memory_order_relaxed);
+    if (cabeca - atomic_load_explicit(&telemetria.cauda, memory_order_acquire) >= TELEMETRIA_CAPACIDADE)
+    {
+        atomic_fetch_add_explicit(&telemetria.descartados, 1, memory_order_relaxed);
+        return;
+    }
+
+    EventoTelemetria *e = &telemetria.eventos[cabeca & (TELEMETRIA_CAPACIDADE - 1)];
+    struct timespec agora;
+    clock_gettime(CLOCK_REALTIME, &agora);
+
+    e->tipo = tipo;
+    e->instante_ns = (long long)agora.tv_sec * 1000000000LL + agora.tv_nsec;
+    telemetriaCopiar(e->algoritmo, sizeof(e->algoritmo), algoritmo);
+    telemetriaCopiar(e->cenario, sizeof(e->cenario), cenario);
+    telemetriaCopiar(e->variante, sizeof(e->variante), variante);
+    e->tamanho = tamanho;
+    e->repeticao = repeticao;
+    e->tempo_ms = tempo_ms;
+    e->comparacoes = comparacoes;
+    e->trocas = trocas;
+
+    atomic_store_explicit(&telemetria.cabeca, cabeca + 1, memory_order_release);
+}
+
+/**
+ * @brief Evento de uma repetição medida.
+ */
+static inline void telemetriaRepeticao(const char *algoritmo, const char *cenario, int tamanho, int repeticao,
+                                       double tempo_ms, long comparacoes, long trocas, const char *variante)
+{
+    telemetriaEmitir(EVENTO_REPETICAO, algoritmo, cenario, tamanho, repeticao, tempo_ms, comparacoes, trocas, variante);
+}
+
+/**
+ * @brief Evento de início (inicio = 1) ou fim (inicio = 0) de um experimento.
+ */
+static inline void telemetriaExperimento(int inicio, const char *algoritmo, const char *cenario, int tamanho)
+{
+    telemetriaEmitir(inicio ? EVENTO_INICIO_EXPERIMENTO : EVENTO_FIM_EXPERIMENTO,
+                     algoritmo, cenario, tamanho, 0, 0.0, 0, 0, "");
+}
+
+/**
+ * @brief Instantâneo do ambiente (host, pid, núcleos, carga, variante); a leitura de
+ *        /proc/loadavg e do hostname é feita pela thread escritora.
+ */
+static inline void telemetriaAmbiente(const char *variante)
+{
+    telemetriaEmitir(EVENTO_AMBIENTE, "", "", 0, 0, 0.0, 0, 0, variante);
+}
+
+/**
+ * @brief Encerra a telemetria, esperando o escritor esvaziar o buffer por até
+ *        TELEMETRIA_LIMITE_ENCERRAR_MS. Se o escritor não terminar nesse prazo (leitor do pipe
+ *        parado), a thread é desanexada e os eventos restantes se perdem.
+ */
+static inline void telemetriaEncerrar()
+{
+    if (!telemetria.ativa)
+        return;
+    atomic_store_explicit(&telemetria.encerrar, 1, memory_order_release);
+
+    long long limite = telemetriaAgoraNs() + TELEMETRIA_LIMITE_ENCERRAR_MS * 1000000LL;
+    while (!atomic_load_explicit(&telemetria.terminou, memory_order_acquire) && telemetriaAgoraNs() < limite)
+    {
+        struct timespec pausa = {0, TELEMETRIA_ESPERA_NS};
+        nanosleep(&pausa, NULL);
+    }
+
+    if (atomic_load_explicit(&telemetria.terminou, memory_order_acquire))
+        pthread_join(telemetria.escritor, NULL);
+    else
+    {
+        fprintf(stderr, "AVISO: escritor da telemetria nao terminou em %d ms; eventos pendentes descartados\n",
+                TELEMETRIA_LIMITE_ENCERRAR_MS);
+        pthread_detach(telemetria.escritor);
+    }
+    telemetria.ativa = 0;
+}
+
+#endif
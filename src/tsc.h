@@ -0,0 +1,161 @@
+/*  ==================================================================
+ *  CONTADOR DE CICLOS (TSC) PARA MEDIÇÕES CURTAS
+ *  Leitura do time-stamp counter com serialização (lfence/rdtscp),
+ *  calibração contra o relógio monotônico e estimativa da sobrecarga da
+ *  própria medição. Usado onde clock_gettime custa tanto quanto o código
+ *  medido (ordenações de poucas dezenas a milhares de elementos).
+ *
+ *  Fora de x86 as funções usam o relógio monotônico em nanossegundos,
+ *  com 1 "ciclo" = 1 ns.
+ *  ==================================================================*/
+#ifndef TSC_H
+#define TSC_H
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TSC_X86 1
+#endif
+
+#define TSC_CALIBRACAO_NS 50000000L /* Duração da calibração contra CLOCK_MONOTONIC (50 ms) */
+#define TSC_AMOSTRAS_SOBRECARGA 1000
+
+static inline unsigned long long tscRelogioNs()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long long)t.tv_sec * 1000000000ULL + t.tv_nsec;
+}
+
+/**
+ * @brief Lê o contador de ciclos do processador (rdtsc), com custo de poucos ciclos.
+ *        Em arquiteturas sem rdtsc, usa o relógio monotônico em nanossegundos.
+ * @return Valor atual do contador.
+ */
+static inline unsigned long long lerCiclos()
+{
+#ifdef TSC_X86
+    return __rdtsc();
+#else
+    return tscRelogioNs();
+#endif
+}
+
+/**
+ * @brief Início de um trecho medido: o lfence anterior espera as instruções anteriores
+ *        terminarem e o posterior impede que o código medido comece antes da leitura.
+ */
+static inline unsigned long long lerCiclosInicio()
+{
+#ifdef TSC_X86
+    _mm_lfence();
+    unsigned long long t = __rdtsc();
+    _mm_lfence();
+    return t;
+#else
+    return tscRelogioNs();
+#endif
+}
+
+/**
+ * @brief Fim de um trecho medido: rdtscp só lê o contador depois que o código medido
+ *        terminou, e o lfence impede que o código seguinte entre na medição.
+ */
+static inline unsigned long long lerCiclosFim()
+{
+#ifdef TSC_X86
+    unsigned int auxiliar;
+    unsigned long long t = __rdtscp(&auxiliar);
+    _mm_lfence();
+    return t;
+#else
+    return tscRelogioNs();
+#endif
+}
+
+/**
+ * @brief Ciclos de TSC por nanossegundo, medidos uma vez contra CLOCK_MONOTONIC.
+ */
+static inline double tscCiclosPorNs()
+{
+    static double ciclos_por_ns = 0.0;
+    if (ciclos_por_ns > 0.0)
+        return ciclos_por_ns;
+#ifdef TSC_X86
+    unsigned long long ns_inicio = tscRelogioNs(), ciclos_inicio = lerCiclosInicio();
+    unsigned long long ns_fim;
+    while ((ns_fim = tscRelogioNs()) - ns_inicio < (unsigned long long)TSC_CALIBRACAO_NS)
+        ;
+    unsigned long long ciclos_fim = lerCiclosFim();
+    ciclos_por_ns = (double)(ciclos_fim - ciclos_inicio) / (double)(ns_fim - ns_inicio);
+#else
+    ciclos_por_ns = 1.0;
+#endif
+    return ciclos_por_ns;
+}
+
+static inline double ciclosParaNs(unsigned long long ciclos)
+{
+    return (double)ciclos / tscCiclosPorNs();
+}
+
+/**
+ * @brief Menor custo observado de um par lerCiclosInicio/lerCiclosFim sem nada entre eles,
+ *        a descontar de medições individuais.
+ */
+static inline unsigned long long tscSobrecarga()
+{
+    unsigned long long menor = ~0ULL;
+    for (int i = 0; i < TSC_AMOSTRAS_SOBRECARGA; i++)
+    {
+        unsigned long long inicio = lerCiclosInicio();
+        unsigned long long fim = lerCiclosFim();
+        if (fim - inicio < menor)
+            menor = fim - inicio;
+    }
+    return menor;
+}
+
+/**
+ * @brief Menor custo observado, em ns, de um par de chamadas clock_gettime (para comparação).
+ */
+static inline double relogioSobrecargaNs()
+{
+    unsigned long long menor = ~0ULL;
+    for (int i = 0; i < TSC_AMOSTRAS_SOBRECARGA; i++)
+    {
+        unsigned long long inicio = tscRelogioNs();
+        unsigned long long fim = tscRelogioNs();
+        if (fim - inicio < menor)
+            menor = fim - inicio;
+    }
+    return (double)menor;
+}
+
+/**
+ * @brief Indica se o TSC é invariante (constant_tsc e nonstop_tsc em /proc/cpuinfo), isto é,
+ *        se conta em ritmo fixo independente de mudanças de frequência e estados de economia.
+ */
+static inline int tscInvariante()
+{
+#ifdef TSC_X86
+    FILE *f = fopen("/proc/cpuinfo", "r");
+    char linha[8192];
+    int invariante = 0;
+    while (f && fgets(linha, sizeof(linha), f))
+        if (strncmp(linha, "flags", 5) == 0)
+        {
+            invariante = strstr(linha, " constant_tsc") && strstr(linha, " nonstop_tsc");
+            break;
+        }
+    if (f)
+        fclose(f);
+    return invariante;
+#else
+    return 1;
+#endif
+}
+
+#endif
@@ -0,0 +1,163 @@
+"""
+VARREDURA DAS VARIANTES DE COMPILAÇÃO
+=====================================
+Constrói todas as variantes do Makefile (o2, o3nativo, lto e pgo, esta com a
+execução de treino), executa o teste geral de cada uma sem interação
+(`shellSort --geral` e `cycleSort --geral`) e compara os tempos com a
+variante de referência -O2:
+  - compararResultados decide, por combinação, se a diferença é significativa
+    (Mann-Whitney U), com a saída completa exibida para cada variante;
+  - a tabela final traz o ganho (mediana o2 / mediana da variante) por
+    algoritmo, cenário e tamanho, e a média geométrica de cada variante.
+
+Cada variante roda em build/varredura/<variante>/src, para que os arquivos
+de resultados de uma não se misturem com os das outras nem com os de
+results/files/. A tabela é gravada em ../results/files/variantes_<data>.csv.
+
+USO (a partir da pasta src/):
+    python3 varrer_variantes.py             # constrói e mede todas
+    python3 varrer_variantes.py --sem-build # reaproveita build/
+"""
+
+import csv
+import math
+import statistics
+import subprocess
+import sys
+from datetime import datetime
+from pathlib import Path
+
+# ============================================
+# CONFIGURAÇÕES
+# ============================================
+
+PASTA_SRC = Path(__file__).resolve().parent
+PASTA_BUILD = PASTA_SRC / "build"
+PASTA_RESULTADOS = PASTA_SRC.parent / "results" / "files"
+VARIANTES = ["o2", "o3nativo", "lto", "pgo"]
+REFERENCIA = "o2"
+PROGRAMAS = {"shellSort": "shellsort", "cycleSort": "cyclesort"}
+QTD_DESCARTES = 1  # Mesmo valor de compararResultados.c e dos programas
+
+# ============================================
+# EXECUÇÃO
+# ============================================
+
+def construir():
+    """Executa `make variantes` (inclui o treino e a recompilação PGO)."""
+    print("Construindo as variantes (make variantes)...")
+    subprocess.run(["make", "variantes"], cwd=PASTA_SRC, check=True)
+
+
+def executar_teste_geral(variante):
+    """
+    Roda o teste geral dos dois programas da variante numa pasta de trabalho própria.
+    Retorna {programa: caminho do CSV geral gerado}.
+    """
+    trabalho = PASTA_BUILD / "varredura" / variante / "src"
+    for programa in PROGRAMAS:
+        (trabalho.parent / "results" / "files" / programa).mkdir(parents=True, exist_ok=True)
+    trabalho.mkdir(parents=True, exist_ok=True)
+
+    csvs = {}
+    for programa, prefixo in PROGRAMAS.items():
+        pasta = trabalho.parent / "results" / "files" / programa
+        anteriores = set(pasta.glob(f"{prefixo}_geral_*.csv"))
+        print(f"  [{variante}] {programa} --geral")
+        subprocess.run([str(PASTA_BUILD / variante / programa), "--geral"], cwd=trabalho,
+                       stdout=subprocess.DEVNULL, stdin=subprocess.DEVNULL, check=True)
+        novos = sorted(set(pasta.glob(f"{prefixo}_geral_*.csv")) - anteriores)
+        if not novos:
+            raise RuntimeError(f"{programa} da variante {variante} nao gerou o CSV geral em {pasta}")
+        csvs[programa] = novos[-1]
+    return csvs
+
+
+def carregar_medianas(caminho):
+    """
+    Lê o CSV geral (até a linha em branco que precede as estatísticas, sem as linhas
+    '#' do ambiente) e retorna {(algoritmo, cenario, tamanho): mediana dos tempos
+    válidos em ms}.
+    """
+    tempos = {}
+    with open(caminho, newline="", encoding="utf-8") as arquivo:
+        linhas = []
+        for linha in arquivo:
+            if linha.startswith("#"):
+                continue  # Cabeçalho de ambiente (ambiente.h)
+            if not linha.strip():
+                break
+            linhas.append(linha)
+    for registro in csv.DictReader(linhas, delimiter=";"):
+        if int(registro["repeticao"]) <= QTD_DESCARTES:
+            continue
+        chave = (registro["algoritmo"], registro["cenario"], int(registro["tamanho"]))
+        tempos.setdefault(chave, []).append(float(registro["tempo_ms"]))
+    return {chave: statistics.median(valores) for chave, valores in tempos.items()}
+
+# ============================================
+# MAIN
+# ============================================
+
+def main():
+    if "--sem-build" not in sys.argv[1:]:
+        construir()
+
+    csvs = {variante: executar_teste_geral(variante) for variante in VARIANTES}
+    medianas = {variante: {} for variante in VARIANTES}
+    for variante in VARIANTES:
+        for caminho in csvs[variante].values():
+            medianas[variante].update(carregar_medianas(caminho))
+
+    comparador = PASTA_BUILD / REFERENCIA / "compararResultados"
+    for variante in VARIANTES:
+        if variante == REFERENCIA:
+            continue
+        for programa in PROGRAMAS:
+            # Código 1 (regressão) é um resultado, não uma falha da varredura
+            subprocess.run([str(comparador), str(csvs[REFERENCIA][programa]), str(csvs[variante][programa])])
+
+    referencia = medianas[REFERENCIA]
+    ganhos = {variante: [] for variante in VARIANTES}
+    linhas = []
+    for chave in sorted(referencia):
+        linha = list(chave) + [f"{referencia[chave]:.3f}"]
+        for variante in VARIANTES[1:]:
+            mediana = medianas[variante].get(chave)
+            if mediana is None or mediana <= 0.0 or referencia[chave] <= 0.0:
+                linha.append("")
+                continue
+            ganho = referencia[chave] / mediana
+            ganhos[variante].append(ganho)
+            linha.append(f"{ganho:.3f}")
+        linhas.append(linha)
+
+    cabecalho = ["algoritmo", "cenario", "tamanho", f"{REFERENCIA}_ms"] + [f"ganho_{v}" for v in VARIANTES[1:]]
+    print("\n" + "=" * 78)
+    print(f" GANHO SOBRE A VARIANTE {REFERENCIA} (mediana {REFERENCIA} / mediana da variante)")
+    print("=" * 78)
+    print(f"{'algoritmo':<12} {'cenario':<12} {'tamanho':>8} {REFERENCIA + ' (ms)':>10}" +
+          "".join(f" {v:>9}" for v in VARIANTES[1:]))
+    print("-" * 78)
+    for linha in linhas:
+        print(f"{linha[0]:<12} {linha[1]:<12} {linha[2]:>8} {linha[3]:>10}" +
+              "".join(f" {valor + 'x' if valor else '-':>9}" for valor in linha[4:]))
+    print("-" * 78)
+    medias = []
+    for variante in VARIANTES[1:]:
+        valores = ganhos[variante]
+        medias.append(math.exp(sum(math.log(g) for g in valores) / len(valores)) if valores else float("nan"))
+    print(f"{'media geometrica':<45}" + "".join(f" {m:>8.3f}x" for m in medias))
+
+    PASTA_RESULTADOS.mkdir(parents=True, exist_ok=True)
+    saida = PASTA_RESULTADOS / f"variantes_{datetime.now().strftime('%Y-%m-%d_%H-%M-%S')}.csv"
+    with open(saida, "w", newline="", encoding="utf-8") as arquivo:
+        escritor = csv.writer(arquivo, delimiter=";")
+        escritor.writerow(cabecalho)
+        escritor.writerows(linhas)
+        escritor.writerow(["media_geometrica", "", "", ""] + [f"{m:.3f}" for m in medias])
+    print(f"\nTabela salva em {saida}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,210 @@
+/*  ==================================================================
+ *  VERIFICAÇÃO DAS ORDENAÇÕES
+ *  Conferência, fora da região medida, de que a saída de cada ordenação
+ *  está em ordem não decrescente e é uma permutação da entrada:
+ *    - ordem: comparação vetorial (AVX2) de v[i] com v[i + 1], 8 pares
+ *      por instrução;
+ *    - permutação: impressão digital do multiconjunto independente da
+ *      ordem (soma dos valores em 64 bits e duas somas de hashes de 32
+ *      bits com sementes diferentes), calculada na entrada e na saída.
+ *  As duas passadas são limitadas pela largura de banda da memória, o que
+ *  permite mantê-las ligadas em todas as repetições, inclusive com 10^8
+ *  elementos. Qualquer divergência encerra o programa com erro.
+ *  ==================================================================*/
+#ifndef VERIFICACAO_H
+#define VERIFICACAO_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#if defined(__GNUC__)
+#define VERIFICACAO_AVX2 1
+#endif
+#endif
+
+#define HASH_SEMENTE_A 0x9E3779B9u
+#define HASH_SEMENTE_B 0x7F4A7C15u
+
+typedef struct
+{
+    long long soma;      /* Soma dos valores */
+    unsigned int hash_a; /* Soma (mod 2^32) de fmix32(x ^ semente A) */
+    unsigned int hash_b; /* Soma (mod 2^32) de fmix32(x ^ semente B) */
+} ImpressaoVetor;
+
+/**
+ * @brief Finalizador do MurmurHash3 (32 bits): mistura todos os bits da entrada.
+ */
+static inline unsigned int hashMistura32(unsigned int x)
+{
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35u;
+    x ^= x >> 16;
+    return x;
+}
+
+/**
+ * @brief Posição da primeira inversão (v[i] > v[i + 1]) a partir de inicio, versão escalar.
+ * @return Índice i da inversão, ou -1 se o trecho estiver em ordem.
+ */
+static inline long primeiraInversaoEscalar(const int v[], long inicio, long n)
+{
+    for (long i = inicio; i + 1 < n; i++)
+        if (v[i] > v[i + 1])
+            return i;
+    return -1;
+}
+
+static inline void impressaoEscalar(const int v[], long inicio, long n, ImpressaoVetor *impressao)
+{
+    for (long i = inicio; i < n; i++)
+    {
+        impressao->soma += v[i];
+        impressao->hash_a += hashMistura32((unsigned int)v[i] ^ HASH_SEMENTE_A);
+        impressao->hash_b += hashMistura32((unsigned int)v[i] ^ HASH_SEMENTE_B);
+    }
+}
+
+#ifdef VERIFICACAO_AVX2
+__attribute__((target("avx2"))) static inline __m256i hashMistura32AVX2(__m256i x)
+{
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+    x = _mm256_mullo_epi32(x, _mm256_set1_epi32((int)0x85EBCA6Bu));
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 13));
+    x = _mm256_mullo_epi32(x, _mm256_set1_epi32((int)0xC2B2AE35u));
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+    return x;
+}
+
+/**
+ * @brief Primeira inversão com AVX2: compara blocos de 32 pares e só procura a posição exata
+ *        (escalar) no bloco em que alguma comparação falhou.
+ */
+__attribute__((target("avx2"))) static inline long primeiraInversaoAVX2(const int v[], long n)
+{
+    long i = 0;
+    for (; i + 33 <= n; i += 32)
+    {
+        __m256i falhas = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i *)&v[i]),
+                                               _mm256_loadu_si256((const __m256i *)&v[i + 1])),
+                            _mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i *)&v[i + 8]),
+                                               _mm256_loadu_si256((const __m256i *)&v[i + 9]))),
+            _mm256_or_si256(_mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i *)&v[i + 16]),
+                                               _mm256_loadu_si256((const __m256i *)&v[i + 17])),
+                            _mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i *)&v[i + 24]),
+                                               _mm256_loadu_si256((const __m256i *)&v[i + 25]))));
+        if (!_mm256_testz_si256(falhas, falhas))
+            return primeiraInversaoEscalar(v, i, i + 33);
+    }
+    return primeiraInversaoEscalar(v, i, n);
+}
+
+__attribute__((target("avx2"))) static inline void impressaoAVX2(const int v[], long n, ImpressaoVetor *impressao)
+{
+    __m256i soma = _mm256_setzero_si256();
+    __m256i hash_a = _mm256_setzero_si256(), hash_b = _mm256_setzero_si256();
+    const __m256i semente_a = _mm256_set1_epi32((int)HASH_SEMENTE_A);
+    const __m256i semente_b = _mm256_set1_epi32((int)HASH_SEMENTE_B);
+    long i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i *)&v[i]);
+        soma = _mm256_add_epi64(soma, _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)),
+                                                       _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1))));
+        hash_a = _mm256_add_epi32(hash_a, hashMistura32AVX2(_mm256_xor_si256(x, semente_a)));
+        hash_b = _mm256_add_epi32(hash_b, hashMistura32AVX2(_mm256_xor_si256(x, semente_b)));
+    }
+
+    long long somas[4];
+    unsigned int parciais_a[8], parciais_b[8];
+    _mm256_storeu_si256((__m256i *)somas, soma);
+    _mm256_storeu_si256((__m256i *)parciais_a, hash_a);
+    _mm256_storeu_si256((__m256i *)parciais_b, hash_b);
+    for (int k = 0; k < 4; k++)
+        impressao->soma += somas[k];
+    for (int k = 0; k < 8; k++)
+    {
+        impressao->hash_a += parciais_a[k];
+        impressao->hash_b += parciais_b[k];
+    }
+    impressaoEscalar(v, i, n, impressao);
+}
+#endif
+
+static inline int verificacaoUsaAVX2()
+{
+#ifdef VERIFICACAO_AVX2
+    static int suportada = -1;
+    if (suportada < 0)
+        suportada = __builtin_cpu_supports("avx2") ? 1 : 0;
+    return suportada;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Posição da primeira inversão do vetor.
+ * @return Índice i com v[i] > v[i + 1], ou -1 se o vetor estiver ordenado.
+ */
+static inline long primeiraInversao(const int v[], long n)
+{
+#ifdef VERIFICACAO_AVX2
+    if (verificacaoUsaAVX2())
+        return primeiraInversaoAVX2(v, n);
+#endif
+    return primeiraInversaoEscalar(v, 0, n);
+}
+
+/**
+ * @brief Impressão digital do multiconjunto de valores do vetor (não depende da ordem).
+ */
+static inline ImpressaoVetor impressaoVetor(const int v[], long n)
+{
+    ImpressaoVetor impressao = {0, 0, 0};
+#ifdef VERIFICACAO_AVX2
+    if (verificacaoUsaAVX2())
+    {
+        impressaoAVX2(v, n, &impressao);
+        return impressao;
+    }
+#endif
+    impressaoEscalar(v, 0, n, &impressao);
+    return impressao;
+}
+
+/**
+ * @brief Confere a saída de uma ordenação; em caso de falha, informa o contexto e encerra o programa.
+ * @param entrada Impressão digital calculada sobre a entrada antes da ordenação.
+ * @param v Vetor ordenado.
+ * @param n Tamanho do vetor.
+ * @param algoritmo, cenario, repeticao Contexto exibido na mensagem de erro.
+ */
+static inline void verificarOrdenacao(const ImpressaoVetor *entrada, const int v[], long n,
+                                      const char *algoritmo, const char *cenario, int repeticao)
+{
+    long inversao = primeiraInversao(v, n);
+    ImpressaoVetor saida = impressaoVetor(v, n);
+
+    if (inversao < 0 && saida.soma == entrada->soma && saida.hash_a == entrada->hash_a &&
+        saida.hash_b == entrada->hash_b)
+        return;
+
+    fprintf(stderr, "\n!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!\n");
+    fprintf(stderr, "ERRO FATAL: saida invalida do %s (cenario %s, n = %ld, repeticao %d)\n",
+            algoritmo, cenario, n, repeticao);
+    if (inversao >= 0)
+        fprintf(stderr, "  Fora de ordem na posicao %ld: %d > %d\n", inversao, v[inversao], v[inversao + 1]);
+    if (saida.soma != entrada->soma || saida.hash_a != entrada->hash_a || saida.hash_b != entrada->hash_b)
+        fprintf(stderr, "  A saida nao e uma permutacao da entrada (soma %lld -> %lld, hashes %08x/%08x -> %08x/%08x)\n",
+                entrada->soma, saida.soma, entrada->hash_a, entrada->hash_b, saida.hash_a, saida.hash_b);
+    fprintf(stderr, "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!\n");
+    exit(EXIT_FAILURE);
+}
+
+#endif